@@ -84,42 +84,192 @@ void BLEConnectivityManager::FilterMatch(bt_scan_device_info *device_info, bt_sc
 
 	scannedDevices[scannedDevicesCounter].mUuid = BT_UUID_16(filter_match->uuid.uuid[0])->val;
 	Instance().mScannedDevicesCounter++;
+
+	/* Do not wait for the recovery scan to finish, re-connect the lost device as soon as it is found. */
+	if (Instance().IsRecoveryScanActive()) {
+		DeviceLayer::PlatformMgr().ScheduleWork(RecoveryScanMatch, scannedDevicesCounter);
+	}
 }
 
-int BLEConnectivityManager::StartGattDiscovery(bt_conn *conn, BLEBridgedDeviceProvider *provider)
+void BLEConnectivityManager::StartGattDiscovery(BLEBridgedDeviceProvider *provider)
 {
-	/* Start GATT discovery for the device's service UUID. */
-	int err = bt_gatt_dm_start(conn, provider->GetServiceUuid(), &discovery_cb, provider);
-	if (err) {
-		LOG_ERR("Could not start the discovery procedure, error "
-			"code: %d",
-			err);
+	/* The GATT Discovery Manager handles one discovery at a time, until its data is released. Queue the discovery in
+	 * the Matter thread, it is started once the ongoing one is finished. */
+	CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(
+		[](intptr_t context) {
+			BLEBridgedDeviceProvider *provider = reinterpret_cast<BLEBridgedDeviceProvider *>(context);
+
+			if (!Recovery::PutProvider(provider, &Instance().mListToDiscover)) {
+				LOG_ERR("Could not queue the discovery procedure");
+				Instance().DiscoveryStartFailed(provider);
+				return;
+			}
+
+			Instance().StartNextGattDiscovery();
+		},
+		reinterpret_cast<intptr_t>(provider));
+
+	if (err != CHIP_NO_ERROR) {
+		LOG_ERR("Could not schedule the discovery procedure (err %s)", ErrorStr(err));
+		Instance().DiscoveryStartFailed(provider);
+	}
+}
+
+void BLEConnectivityManager::StartNextGattDiscovery()
+{
+	while (!mDiscovering && !sys_slist_is_empty(&mListToDiscover)) {
+		BLEBridgedDeviceProvider *provider = Recovery::GetProvider(&mListToDiscover);
+
+		/* Skip the devices that were removed or disconnected while waiting for the discovery. */
+		if (!IsBLEProviderAdded(provider) || !provider->GetConnectionObject()) {
+			continue;
+		}
+
+		/* Start GATT discovery for the device's service UUID. */
+		int err = bt_gatt_dm_start(provider->GetConnectionObject(), provider->GetServiceUuid(), &discovery_cb,
+					   provider);
+		if (err) {
+			LOG_ERR("Could not start the discovery procedure, error "
+				"code: %d",
+				err);
+			DiscoveryStartFailed(provider);
+			continue;
+		}
+
+		mDiscovering = provider;
+	}
+}
+
+void BLEConnectivityManager::FinishGattDiscovery()
+{
+	mDiscovering = nullptr;
+	StartNextGattDiscovery();
+}
+
+void BLEConnectivityManager::DiscoveryStartFailed(BLEBridgedDeviceProvider *provider)
+{
+	/* Disconnect the device, a lost device is re-connected by the next recovery attempt. */
+	if (provider->GetConnectionObject()) {
+		bt_conn_disconnect(provider->GetConnectionObject(), BT_HCI_ERR_REMOTE_USER_TERM_CONN);
+	}
+
+	mRecovery.FinishInProgress(provider);
+
+	if (!provider->IsInitiallyConnected()) {
+		/* Trigger the connection callback to inform the application that the connection procedure failed. */
+		provider->GetBLEBridgedDevice().mFirstConnectionCallback(
+			false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
+	} else {
+		provider->NotifyFailedRecovery();
 	}
-	return err;
+
+	UpdateRecovery();
 }
 
 void BLEConnectivityManager::UpdateRecovery()
 {
 	if (!sys_slist_is_empty(&Instance().mRecovery.mListToReconnect)) {
-		/* There is another provider to re-connect, schedule this operation. */
-		BLEBridgedDeviceProvider *providerToRecover =
-			Instance().mRecovery.GetProvider(&Instance().mRecovery.mListToReconnect);
-		DeviceLayer::PlatformMgr().ScheduleWork(
-			[](intptr_t context) {
-				Instance().Reconnect(reinterpret_cast<BLEBridgedDeviceProvider *>(context));
-			},
-			reinterpret_cast<intptr_t>(providerToRecover));
+		/* There are other providers to re-connect, schedule this operation. */
+		DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t context) { Instance().ReconnectNext(); }, 0);
 		/* We have still a device to recover, keep the LostDevice state active */
 		Instance().UpdateStateFlag(State::LostDevice, true);
 	} else if (!sys_slist_is_empty(&Instance().mRecovery.mListToRecover)) {
-		/* There are pending providers to recover and no more scanned ones, schedule next scan operation. */
-		Instance().mRecovery.StartTimer();
+		/* There are pending providers to recover and no more scanned ones, schedule next scan operation unless
+		 * the ongoing recovery scan can still find them. */
+		if (!Instance().mScanActive) {
+			Instance().mRecovery.StartTimer();
+		}
 	} else {
-		/* All devices have been recovered, disable LostDevice state */
+		/* All devices have been recovered, finish the recovery scan and disable LostDevice state */
+		DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t context) { Instance().FinishRecoveryScan(); }, 0);
 		Instance().UpdateStateFlag(State::LostDevice, false);
 	}
 }
 
+void BLEConnectivityManager::ReconnectNext()
+{
+	/* Only one connection can be created at a time, the next one is created once the pending one is established.
+	 * The GATT discovery of the already connected devices continues in the meantime. */
+	if (mRecovery.mConnecting) {
+		return;
+	}
+
+	while (!sys_slist_is_empty(&mRecovery.mListToReconnect) && mRecovery.HasFreeSlot()) {
+		BLEBridgedDeviceProvider *provider = mRecovery.GetProvider(&mRecovery.mListToReconnect);
+
+		if (Reconnect(provider) == CHIP_NO_ERROR) {
+			return;
+		}
+
+		provider->NotifyFailedRecovery();
+	}
+
+	/* No connection is pending, look for the remaining lost devices. */
+	ResumeRecoveryScan();
+}
+
+void BLEConnectivityManager::RecoveryScanMatch(intptr_t context)
+{
+	uint8_t index = static_cast<uint8_t>(context);
+
+	VerifyOrReturn(Instance().IsRecoveryScanActive() && index < Instance().mScannedDevicesCounter);
+
+	BLEBridgedDeviceProvider *provider = Instance().mRecovery.FindProvider(&Instance().mScannedDevices[index].mAddr,
+									      &Instance().mRecovery.mListToRecover);
+
+	/* Skip devices that are not lost or that are already being re-connected. */
+	VerifyOrReturn(provider && !Instance().mRecovery.IsInProgress(provider));
+
+	Instance().mRecovery.PutProvider(provider, &Instance().mRecovery.mListToReconnect);
+	Instance().ReconnectNext();
+}
+
+void BLEConnectivityManager::PauseRecoveryScan()
+{
+	if (!IsRecoveryScanActive() || mScanPaused) {
+		return;
+	}
+
+	int err = bt_scan_stop();
+	if (err) {
+		LOG_ERR("Recovery scan failed to pause (err %d)", err);
+		return;
+	}
+
+	/* The scan timeout is restarted once the scan is resumed. */
+	k_timer_stop(&mScanTimer);
+	mScanPaused = true;
+}
+
+void BLEConnectivityManager::ResumeRecoveryScan()
+{
+	if (!mScanPaused) {
+		return;
+	}
+
+	/* Keep scanning as long as lost devices are being found, up to the recovery scan timeout without a new one. */
+	int err = bt_scan_start(BT_SCAN_TYPE_SCAN_ACTIVE);
+	if (err) {
+		/* Finish the recovery scan immediately, the scan remains marked as paused to not stop it again. */
+		LOG_ERR("Recovery scan failed to resume (err %d)", err);
+		k_timer_start(&mScanTimer, K_NO_WAIT, K_NO_WAIT);
+		return;
+	}
+
+	mScanPaused = false;
+	k_timer_start(&mScanTimer, K_MSEC(Recovery::kRecoveryScanTimeoutMs), K_NO_WAIT);
+}
+
+void BLEConnectivityManager::FinishRecoveryScan()
+{
+	if (!IsRecoveryScanActive()) {
+		return;
+	}
+
+	k_timer_stop(&mScanTimer);
+	StopScan();
+}
+
 void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 {
 	const bt_addr_le_t *dstAddr = bt_conn_get_dst(conn);
@@ -145,6 +295,25 @@ void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 		return;
 	}
 
+	if (provider == Instance().mRecovery.mConnecting) {
+		Instance().mRecovery.mConnecting = nullptr;
+
+		if (conn_err) {
+			LOG_ERR("The reconnection failed (%u)", conn_err);
+			bt_conn_unref(provider->GetConnectionObject());
+			provider->RemoveConnectionObject();
+			Instance().mRecovery.FinishInProgress(provider);
+			provider->NotifyFailedRecovery();
+		}
+
+		/* Connect the next lost device while this one is being discovered. */
+		DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t context) { Instance().ReconnectNext(); }, 0);
+
+		if (conn_err) {
+			return;
+		}
+	}
+
 	/* If there was an error during the initial connection, we should notify the application */
 	bool firstConnFailed = (conn_err && !provider->IsInitiallyConnected());
 	VerifyOrExit(!firstConnFailed, err = conn_err);
@@ -162,12 +331,10 @@ void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 	/* Start GATT discovery only if this specific device was successfully connected before. Otherwise, it will be
 	 * called after a successful pairing. */
 	if (provider->IsInitiallyConnected()) {
-		err = StartGattDiscovery(conn, provider);
-		VerifyOrExit(err == 0, );
+		StartGattDiscovery(provider);
 	}
 #else
-	err = StartGattDiscovery(conn, provider);
-	VerifyOrExit(err == 0, );
+	StartGattDiscovery(provider);
 #endif
 
 	return;
@@ -187,6 +354,9 @@ exit:
 		/* Trigger the connection callback to inform the application that the connection procedure failed. */
 		provider->GetBLEBridgedDevice().mFirstConnectionCallback(
 			false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
+	} else if (Instance().mRecovery.FinishInProgress(provider)) {
+		/* Release the parallel recovery slot, the device is not going to be discovered. */
+		provider->NotifyFailedRecovery();
 	}
 
 	Instance().UpdateRecovery();
@@ -205,6 +375,11 @@ void BLEConnectivityManager::DisconnectionHandler(bt_conn *conn, uint8_t reason)
 		bt_conn_unref(provider->GetBLEBridgedDevice().mConn);
 		provider->SetConnectionObject(nullptr);
 
+		/* Release the parallel recovery slot if the device disconnected before the recovery was completed. */
+		if (Instance().mRecovery.FinishInProgress(provider)) {
+			Instance().UpdateRecovery();
+		}
+
 		/* Verify whether the device should be recovered. */
 		if (reason == BT_HCI_ERR_CONN_TIMEOUT) {
 			provider->RemoveConnectionObject();
@@ -306,7 +481,7 @@ void BLEConnectivityManager::PairingComplete(struct bt_conn *conn, bool bonded)
 	Instance().UpdateStateFlag(State::Pairing, false);
 
 	/* Once pairing completed successfully, start GATT discovery procedure. */
-	StartGattDiscovery(conn, provider);
+	StartGattDiscovery(provider);
 }
 
 void BLEConnectivityManager::PairingFailed(struct bt_conn *conn, enum bt_security_err reason)
@@ -359,7 +534,9 @@ void BLEConnectivityManager::DiscoveryCompletedHandler(bt_gatt_dm *dm, void *con
 	/* The device was successfully recovered. */
 	if (provider->IsInitiallyConnected()) {
 		Instance().mRecovery.RemoveRecovered(provider);
+		Instance().mRecovery.FinishInProgress(provider);
 		provider->NotifySuccessfulRecovery();
+		LOG_INF("The device recovered in %u ms", provider->GetLastRecoveryTime());
 	}
 
 exit:
@@ -382,6 +559,7 @@ exit:
 					ctx->mProvider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
 				ctx->mProvider->ConfirmInitialConnection();
 				VerifyOrReturn(CHIP_NO_ERROR == err, bt_gatt_dm_data_release(ctx->mDiscoveryData);
+					       Instance().FinishGattDiscovery();
 					       Instance().RemoveBLEProvider(ctx->mProvider->GetBtAddress()););
 			}
 
@@ -393,6 +571,7 @@ exit:
 				LOG_ERR("Cannot parse the GATT discovered data.");
 			}
 			bt_gatt_dm_data_release(ctx->mDiscoveryData);
+			Instance().FinishGattDiscovery();
 		},
 		reinterpret_cast<intptr_t>(discoveryCtx.get()));
 
@@ -400,6 +579,7 @@ exit:
 		discoveryCtx.release();
 	} else {
 		bt_gatt_dm_data_release(dm);
+		Instance().FinishGattDiscovery();
 	}
 
 	Instance().UpdateRecovery();
@@ -409,8 +589,13 @@ void BLEConnectivityManager::DiscoveryNotFound(bt_conn *conn, void *context)
 {
 	LOG_ERR("GATT service could not be found during the discovery");
 
+	/* The discovery data is already released, the next discovery can be started. */
+	DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t context) { Instance().FinishGattDiscovery(); }, 0);
+
 	BLEBridgedDeviceProvider *provider = reinterpret_cast<BLEBridgedDeviceProvider *>(context);
 	if (provider) {
+		Instance().mRecovery.FinishInProgress(provider);
+
 		if (!provider->IsInitiallyConnected()) {
 			provider->GetBLEBridgedDevice().mFirstConnectionCallback(
 				false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
@@ -426,8 +611,13 @@ void BLEConnectivityManager::DiscoveryError(bt_conn *conn, int err, void *contex
 {
 	LOG_ERR("The GATT discovery procedure failed with %d", err);
 
+	/* The discovery data is already released, the next discovery can be started. */
+	DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t context) { Instance().FinishGattDiscovery(); }, 0);
+
 	BLEBridgedDeviceProvider *provider = reinterpret_cast<BLEBridgedDeviceProvider *>(context);
 
+	Instance().mRecovery.FinishInProgress(provider);
+
 	if (!provider->IsInitiallyConnected()) {
 		provider->GetBLEBridgedDevice().mFirstConnectionCallback(
 			false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
@@ -451,6 +641,8 @@ CHIP_ERROR BLEConnectivityManager::Init(const bt_uuid **serviceUuids, uint8_t se
 	k_timer_init(&mScanTimer, BLEConnectivityManager::ScanTimeoutCallback, nullptr);
 	k_timer_user_data_set(&mScanTimer, this);
 
+	sys_slist_init(&mListToDiscover);
+
 #ifdef CONFIG_BT_SMP
 	int err = bt_conn_auth_cb_register(&auth_callbacks);
 	if (err) {
@@ -595,55 +787,34 @@ void BLEConnectivityManager::Recovery::RemoveRecovered(BLEBridgedDeviceProvider
 
 void BLEConnectivityManager::ReScanCallback(ScanResult &result, void *context)
 {
-	DeviceLayer::PlatformMgr().ScheduleWork(
-		[](intptr_t context) {
-			BLEBridgedDeviceProvider *provider;
-			ScanResult result = *reinterpret_cast<ScanResult *>(context);
-			sys_snode_t *node;
-			sys_snode_t *tmpNodeSafe;
-			Recovery::ListItem *item;
-			bool providerFound = false;
-			bt_addr_le_t providerAddress;
-
-			/* Filter out devices to recover from a scan result and put them to the queue to reconnect. */
-			SYS_SLIST_FOR_EACH_NODE_SAFE (&Instance().mRecovery.mListToRecover, node, tmpNodeSafe) {
-				item = reinterpret_cast<Recovery::ListItem *>(node);
-
-				if (!item) {
-					return;
-				}
+	sys_snode_t *node;
+	sys_snode_t *tmpNodeSafe;
+	Recovery::ListItem *item;
+	bool providerFound = false;
+	bt_addr_le_t providerAddress;
 
-				providerFound = false;
+	/* The devices found during the scan have been already queued to reconnect by RecoveryScanMatch(). */
+	SYS_SLIST_FOR_EACH_NODE_SAFE (&Instance().mRecovery.mListToRecover, node, tmpNodeSafe) {
+		item = reinterpret_cast<Recovery::ListItem *>(node);
 
-				for (uint8_t i = 0; i < result.mCount && !providerFound; i++) {
-					providerAddress = item->mProvider->GetBtAddress();
-					if (memcmp(&providerAddress, &result.mDevices[i].mAddr,
-						   sizeof(result.mDevices[i].mAddr)) == 0) {
-						providerFound = true;
-						Instance().mRecovery.PutProvider(
-							item->mProvider, &Instance().mRecovery.mListToReconnect);
-					}
-				}
+		if (!item) {
+			return;
+		}
 
-				/* Increase failed attempts counter of all devices to recover that were not detected. */
-				if (!providerFound) {
-					item->mProvider->NotifyFailedRecovery();
-				}
-			}
+		providerFound = false;
+		providerAddress = item->mProvider->GetBtAddress();
 
-			if (sys_slist_is_empty(&Instance().mRecovery.mListToReconnect)) {
-				Instance().mRecovery.StartTimer();
-			} else {
-				provider = Instance().mRecovery.GetProvider(&Instance().mRecovery.mListToReconnect);
-				DeviceLayer::PlatformMgr().ScheduleWork(
-					[](intptr_t context) {
-						Instance().Reconnect(
-							reinterpret_cast<BLEBridgedDeviceProvider *>(context));
-					},
-					reinterpret_cast<intptr_t>(provider));
-			}
-		},
-		reinterpret_cast<intptr_t>(&result));
+		for (uint8_t i = 0; i < result.mCount && !providerFound; i++) {
+			providerFound = (bt_addr_le_cmp(&providerAddress, &result.mDevices[i].mAddr) == 0);
+		}
+
+		/* Increase failed attempts counter of all devices to recover that were not detected. */
+		if (!providerFound) {
+			item->mProvider->NotifyFailedRecovery();
+		}
+	}
+
+	Instance().UpdateRecovery();
 }
 
 CHIP_ERROR BLEConnectivityManager::StopScan()
@@ -652,12 +823,15 @@ CHIP_ERROR BLEConnectivityManager::StopScan()
 		return CHIP_NO_ERROR;
 	}
 
-	int err = bt_scan_stop();
+	/* The paused recovery scan has been already stopped. */
+	int err = mScanPaused ? 0 : bt_scan_stop();
 	if (err) {
 		LOG_ERR("Scanning failed to stop (err %d)", err);
 		return System::MapErrorZephyr(err);
 	}
 
+	mScanPaused = false;
+
 	if (mScanDoneCallback != ReScanCallback) {
 		/* Scanning has been finished, disable the Scanning state */
 		Instance().UpdateStateFlag(State::Scanning, false);
@@ -695,8 +869,6 @@ CHIP_ERROR BLEConnectivityManager::Reconnect(BLEBridgedDeviceProvider *provider)
 		return CHIP_ERROR_INVALID_ARGUMENT;
 	}
 
-	StopScan();
-
 	bt_conn *conn{};
 	bt_addr_le_t btAddress = provider->GetBtAddress();
 	bt_le_conn_param *connParams = GetScannedDeviceConnParams(btAddress);
@@ -706,6 +878,14 @@ CHIP_ERROR BLEConnectivityManager::Reconnect(BLEBridgedDeviceProvider *provider)
 		return CHIP_ERROR_INTERNAL;
 	}
 
+	/* The recovery scan is only paused, so that it can look for the remaining lost devices once the connection
+	 * is established. */
+	if (IsRecoveryScanActive()) {
+		PauseRecoveryScan();
+	} else {
+		StopScan();
+	}
+
 #ifdef CONFIG_BRIDGE_FORCE_BT_CONNECTION_PARAMS
 	if (!CheckParamChangeRequest(connParams)) {
 		UpdateBtParams(connParams);
@@ -722,6 +902,8 @@ CHIP_ERROR BLEConnectivityManager::Reconnect(BLEBridgedDeviceProvider *provider)
 		return System::MapErrorZephyr(err);
 	} else {
 		provider->SetConnectionObject(conn);
+		mRecovery.StartInProgress(provider);
+		mRecovery.mConnecting = provider;
 	}
 
 	return CHIP_NO_ERROR;
@@ -859,6 +1041,17 @@ BLEBridgedDeviceProvider *BLEConnectivityManager::FindBLEProvider(bt_addr_le_t a
 	return nullptr;
 }
 
+bool BLEConnectivityManager::IsBLEProviderAdded(BLEBridgedDeviceProvider *provider)
+{
+	for (int i = 0; i < kMaxConnectedDevices; i++) {
+		if (provider && mConnectedProviders[i] == provider) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 CHIP_ERROR BLEConnectivityManager::GetScannedDeviceAddress(bt_addr_le_t *address, uint8_t index)
 {
 	if (address == nullptr || index >= mScannedDevicesCounter) {
@@ -903,6 +1096,7 @@ BLEConnectivityManager::Recovery::Recovery()
 void BLEConnectivityManager::Recovery::NotifyProviderToRecover(BLEBridgedDeviceProvider *provider)
 {
 	if (provider) {
+		provider->NotifyConnectionLost();
 		PutProvider(provider, &mListToRecover);
 		StartTimer();
 	}
@@ -960,6 +1154,63 @@ bool BLEConnectivityManager::Recovery::EntryExists(BLEBridgedDeviceProvider *pro
 	return false;
 }
 
+BLEBridgedDeviceProvider *BLEConnectivityManager::Recovery::FindProvider(const bt_addr_le_t *address,
+									 sys_slist_t *list)
+{
+	sys_snode_t *node;
+	ListItem *item;
+
+	SYS_SLIST_FOR_EACH_NODE (list, node) {
+		item = reinterpret_cast<ListItem *>(node);
+		bt_addr_le_t storedAddr = item->mProvider->GetBtAddress();
+
+		if (bt_addr_le_cmp(address, &storedAddr) == 0) {
+			return item->mProvider;
+		}
+	}
+
+	return nullptr;
+}
+
+bool BLEConnectivityManager::Recovery::IsInProgress(BLEBridgedDeviceProvider *provider)
+{
+	for (auto i = 0; i < kMaxParallelConnections; i++) {
+		if (mInProgress[i] == provider) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool BLEConnectivityManager::Recovery::StartInProgress(BLEBridgedDeviceProvider *provider)
+{
+	for (auto i = 0; i < kMaxParallelConnections; i++) {
+		if (mInProgress[i] == nullptr) {
+			mInProgress[i] = provider;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool BLEConnectivityManager::Recovery::FinishInProgress(BLEBridgedDeviceProvider *provider)
+{
+	if (!provider) {
+		return false;
+	}
+
+	for (auto i = 0; i < kMaxParallelConnections; i++) {
+		if (mInProgress[i] == provider) {
+			mInProgress[i] = nullptr;
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool BLEConnectivityManager::Recovery::PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list)
 {
 	if (EntryExists(provider, list)) {
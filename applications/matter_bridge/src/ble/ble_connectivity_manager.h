@@ -75,6 +75,8 @@ private:
 		constexpr static auto kRecoveryMaxIntervalSec = CONFIG_BRIDGE_BT_RECOVERY_MAX_INTERVAL;
 
 		constexpr static auto kRecoveryScanTimeoutMs = CONFIG_BRIDGE_BT_RECOVERY_SCAN_TIMEOUT_MS;
+		constexpr static uint8_t kMaxParallelConnections =
+			MIN(CONFIG_BRIDGE_BT_RECOVERY_MAX_PARALLEL_CONNECTIONS, kMaxConnectedDevices);
 
 		struct ListItem : public sys_snode_t {
 			BLEBridgedDeviceProvider *mProvider = nullptr;
@@ -87,6 +89,7 @@ private:
 
 	private:
 		static bool EntryExists(BLEBridgedDeviceProvider *provider, sys_slist_t *list);
+		static BLEBridgedDeviceProvider *FindProvider(const bt_addr_le_t *address, sys_slist_t *list);
 		static BLEBridgedDeviceProvider *GetProvider(sys_slist_t *list);
 		static bool PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list);
 		bool IsNeeded() { return !sys_slist_is_empty(&mListToRecover); }
@@ -94,12 +97,21 @@ private:
 		void CancelTimer() { k_timer_stop(&mRecoveryTimer); }
 		void RemoveRecovered(BLEBridgedDeviceProvider *provider);
 		uint16_t GetFailedRecoveryAttempts();
+		bool IsInProgress(BLEBridgedDeviceProvider *provider);
+		/* Free slots are marked with nullptr. */
+		bool HasFreeSlot() { return IsInProgress(nullptr); }
+		bool StartInProgress(BLEBridgedDeviceProvider *provider);
+		bool FinishInProgress(BLEBridgedDeviceProvider *provider);
 
 		static void TimerTimeoutCallback(k_timer *timer);
 
 		sys_slist_t mListToRecover;
 		sys_slist_t mListToReconnect;
 		k_timer mRecoveryTimer;
+		/* Providers being re-connected or discovered in parallel. */
+		BLEBridgedDeviceProvider *mInProgress[kMaxParallelConnections] = {};
+		/* Provider with a pending connection request, only one can be created at a time. */
+		BLEBridgedDeviceProvider *mConnecting = nullptr;
 	};
 
 	struct DiscoveryHandlerCtx {
@@ -160,13 +172,25 @@ public:
 	CHIP_ERROR Connect(BLEBridgedDeviceProvider *provider, ConnectionSecurityRequest *request = nullptr);
 
 	/**
-	 * @brief Create connection to the first Bluetooth LE device on the mProvidersToRecover recovery list.
+	 * @brief Create connection to the Bluetooth LE device that was found during the recovery scan.
 	 *
 	 * @return CHIP_NO_ERROR on success
 	 * @return other error code on failure
 	 */
 	CHIP_ERROR Reconnect(BLEBridgedDeviceProvider *provider);
 
+	/**
+	 * @brief Get BLE provider stored at the given index of the manager's list.
+	 *
+	 * @param index index on the list, in range from 0 to kMaxConnectedDevices - 1
+	 * @return address of provider if the index is used
+	 * @return nullptr otherwise
+	 */
+	BLEBridgedDeviceProvider *GetBLEProvider(uint8_t index)
+	{
+		return index < kMaxConnectedDevices ? mConnectedProviders[index] : nullptr;
+	}
+
 	/**
 	 * @brief Get BLE provider that uses the specified connection object.
 	 *
@@ -244,7 +268,7 @@ public:
 	static void DiscoveryCompletedHandler(bt_gatt_dm *dm, void *context);
 	static void DiscoveryNotFound(bt_conn *conn, void *context);
 	static void DiscoveryError(bt_conn *conn, int err, void *context);
-	static int StartGattDiscovery(bt_conn *conn, BLEBridgedDeviceProvider *provider);
+	static void StartGattDiscovery(BLEBridgedDeviceProvider *provider);
 #ifdef CONFIG_BRIDGE_FORCE_BT_CONNECTION_PARAMS
 	static bool ParamChangeRequestHandler(struct bt_conn *conn, struct bt_le_conn_param *param);
 #endif
@@ -277,10 +301,21 @@ private:
 	State GetCurrentState();
 	void UpdateStateFlag(State state, bool enabled);
 	void UpdateRecovery();
+	void ReconnectNext();
+	void StartNextGattDiscovery();
+	void FinishGattDiscovery();
+	void DiscoveryStartFailed(BLEBridgedDeviceProvider *provider);
+	bool IsBLEProviderAdded(BLEBridgedDeviceProvider *provider);
+	void PauseRecoveryScan();
+	void ResumeRecoveryScan();
+	void FinishRecoveryScan();
+	bool IsRecoveryScanActive() { return mScanActive && mScanDoneCallback == ReScanCallback; }
+	static void RecoveryScanMatch(intptr_t context);
 
 	StateChangedCallback mStateChangedCb = nullptr;
 	uint8_t mStateBitmask = 0;
 	bool mScanActive;
+	bool mScanPaused;
 	k_timer mScanTimer;
 	uint8_t mScannedDevicesCounter;
 	uint8_t mConnectedProvidersCounter;
@@ -291,6 +326,9 @@ private:
 	uint8_t mServicesUuidCount;
 	ScanDoneCallback mScanDoneCallback;
 	void *mScanDoneCallbackContext;
+	/* Providers waiting for the GATT discovery, only one can be discovered at a time. */
+	sys_slist_t mListToDiscover;
+	BLEBridgedDeviceProvider *mDiscovering = nullptr;
 #ifdef CONFIG_BT_SMP
 	ConnectionSecurityRequest mConnectionSecurityRequest;
 #endif /* CONFIG_BT_SMP */
@@ -13,6 +13,7 @@
 #include <zephyr/bluetooth/addr.h>
 #include <zephyr/bluetooth/conn.h>
 #include <zephyr/bluetooth/gatt.h>
+#include <zephyr/kernel.h>
 
 namespace Nrf
 {
@@ -114,11 +115,56 @@ public:
 	 * This method resets the number of failed recovery attempts.
 	 *
 	 */
-	void NotifySuccessfulRecovery() { mFailedRecoveryAttempts = 0; }
+	void NotifySuccessfulRecovery()
+	{
+		mFailedRecoveryAttempts = 0;
+
+		if (mConnectionLost) {
+			mConnectionLost = false;
+			mLastRecoveryTimeMs = static_cast<uint32_t>(k_uptime_get() - mConnectionLostTimestamp);
+			if (mRecoveriesCount < UINT16_MAX) {
+				mRecoveriesCount++;
+			}
+		}
+	}
+
+	/**
+	 * @brief Inform provider that the connection to the device was lost.
+	 *
+	 * This method starts measuring the time it takes to make the device reachable again. The measurement is not
+	 * restarted until the device is successfully recovered.
+	 *
+	 */
+	void NotifyConnectionLost()
+	{
+		if (!mConnectionLost) {
+			mConnectionLost = true;
+			mConnectionLostTimestamp = k_uptime_get();
+		}
+	}
+
+	/**
+	 * @brief Check if the provider is waiting for the connection to be recovered.
+	 */
+	bool IsConnectionLost() { return mConnectionLost; }
+
+	/**
+	 * @brief Get the time in milliseconds it took to make the device reachable after the last connection loss.
+	 */
+	uint32_t GetLastRecoveryTime() { return mLastRecoveryTimeMs; }
+
+	/**
+	 * @brief Get a number of successful recoveries for this provider.
+	 */
+	uint16_t GetRecoveriesCount() { return mRecoveriesCount; }
 
 protected:
 	BLEBridgedDevice mDevice = { 0 };
 	uint16_t mFailedRecoveryAttempts = 0;
+	bool mConnectionLost = false;
+	int64_t mConnectionLostTimestamp = 0;
+	uint32_t mLastRecoveryTimeMs = 0;
+	uint16_t mRecoveriesCount = 0;
 };
 
 } /* namespace Nrf */
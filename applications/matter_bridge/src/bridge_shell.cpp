@@ -8,6 +8,7 @@
 #include "platform/ConfigurationManager.h"
 
 #ifdef CONFIG_BRIDGED_DEVICE_BT
+#include "ble_bridged_device.h"
 #include "ble_bridged_device_factory.h"
 #include "ble_connectivity_manager.h"
 #else
@@ -184,6 +185,64 @@ static int ListBridgedDevicesHandler(const struct shell *shell, size_t argc, cha
 	return 0;
 }
 
+static int UpdateStatsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	auto &bridgeManager = Nrf::BridgeManager::Instance();
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset") != 0) {
+			shell_fprintf(shell, SHELL_ERROR, "Invalid argument: %s\n", argv[1]);
+			return -EINVAL;
+		}
+
+		bridgeManager.ResetUpdateStats();
+		shell_fprintf(shell, SHELL_INFO, "Done\n");
+		return 0;
+	}
+
+	uint32_t period = bridgeManager.GetUpdateStatsPeriod();
+	uint32_t totalUpdates = 0;
+	uint32_t totalReports = 0;
+	uint8_t count = 0;
+	constexpr uint16_t kMaxEndpointId = CONFIG_BRIDGE_MAX_DYNAMIC_ENDPOINTS_NUMBER;
+
+	shell_fprintf(shell, SHELL_INFO, "Attribute updates in the last %u s:\n", period / MSEC_PER_SEC);
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+	shell_fprintf(shell, SHELL_INFO, "| Endpoint ID |  Updates   |  Reports   |  Updates/min\n");
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+
+	for (chip::EndpointId endpointId = 1; endpointId <= kMaxEndpointId; endpointId++) {
+		Nrf::BridgeManager::UpdateStats stats;
+
+		if (bridgeManager.GetUpdateStats(endpointId, stats) != CHIP_NO_ERROR) {
+			continue;
+		}
+
+		uint32_t rate =
+			period ? static_cast<uint32_t>(static_cast<uint64_t>(stats.mUpdates) * 60 * MSEC_PER_SEC / period) : 0;
+
+		shell_fprintf(shell, SHELL_INFO, "| %-11d | %-10u | %-10u | %u\n", endpointId, stats.mUpdates,
+			      stats.mReports, rate);
+		totalUpdates += stats.mUpdates;
+		totalReports += stats.mReports;
+		count++;
+	}
+
+	if (count == 0) {
+		shell_fprintf(shell, SHELL_INFO, "| No bridged devices found                                      |\n");
+	}
+
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+
+	/* Coalescing ratio is the number of updates per report, with two decimal places. */
+	uint32_t ratio = totalReports ? (static_cast<uint64_t>(totalUpdates) * 100 / totalReports) : 0;
+
+	shell_fprintf(shell, SHELL_INFO, "Total: %u update(s), %u report(s), coalescing ratio: %u.%02u\n",
+		      totalUpdates, totalReports, ratio / 100, ratio % 100);
+
+	return 0;
+}
+
 #ifdef CONFIG_BRIDGED_DEVICE_SIMULATED_ONOFF_SHELL
 static int SimulatedBridgedDeviceOnOffWriteHandler(const struct shell *shell, size_t argc, char **argv)
 {
@@ -290,6 +349,41 @@ static int InsertBridgedDevicePincodeHandler(const struct shell *shell, size_t a
 }
 #endif /* CONFIG_BT_SMP */
 
+static int RecoveryStatsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	uint8_t count = 0;
+
+	shell_fprintf(shell, SHELL_INFO, "Bluetooth LE devices recovery:\n");
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+	shell_fprintf(shell, SHELL_INFO, "|      Address      |   State    | Recoveries | Last time-to-reachable\n");
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+
+	for (uint8_t i = 0; i < Nrf::BLEConnectivityManager::kMaxConnectedDevices; i++) {
+		Nrf::BLEBridgedDeviceProvider *provider = Nrf::BLEConnectivityManager::Instance().GetBLEProvider(i);
+
+		if (!provider) {
+			continue;
+		}
+
+		bt_addr_le_t address = provider->GetBtAddress();
+
+		shell_fprintf(shell, SHELL_INFO, "| %02x:%02x:%02x:%02x:%02x:%02x | %-10s | %-10u | %u ms\n",
+			      address.a.val[5], address.a.val[4], address.a.val[3], address.a.val[2],
+			      address.a.val[1], address.a.val[0],
+			      provider->IsConnectionLost() ? "lost" : "reachable", provider->GetRecoveriesCount(),
+			      provider->GetLastRecoveryTime());
+		count++;
+	}
+
+	if (count == 0) {
+		shell_fprintf(shell, SHELL_INFO, "| No Bluetooth LE devices found                                 |\n");
+	}
+
+	shell_fprintf(shell, SHELL_INFO, "---------------------------------------------------------------------\n");
+
+	return 0;
+}
+
 static int ScanBridgedDeviceHandler(const struct shell *shell, size_t argc, char **argv)
 {
 	shell_fprintf(shell, SHELL_INFO, "Scanning for %d s ...\n", CONFIG_BRIDGE_BT_SCAN_TIMEOUT_MS / 1000);
@@ -329,6 +423,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      "Usage: list\n"
 		      "Displays endpoint ID, node label (name), and device type for all bridged devices.\n",
 		      ListBridgedDevicesHandler, 1, 0),
+	SHELL_CMD_ARG(stats, NULL,
+		      "Shows attribute update statistics of bridged devices. \n"
+		      "Usage: stats [reset]\n"
+		      "Displays the number of attribute updates received from each bridged device, the number of\n"
+		      "attribute reports sent to Matter, and the update rate. Use reset to clear the statistics.\n",
+		      UpdateStatsHandler, 1, 1),
 #ifdef CONFIG_BRIDGED_DEVICE_SIMULATED_ONOFF_SHELL
 	SHELL_CMD_ARG(
 		onoff, NULL,
@@ -352,6 +452,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      "Scan for Bluetooth LE devices to bridge. \n"
 		      "Usage: scan\n",
 		      ScanBridgedDeviceHandler, 1, 0),
+	SHELL_CMD_ARG(recovery, NULL,
+		      "Shows the connection recovery statistics of Bluetooth LE devices. \n"
+		      "Usage: recovery\n"
+		      "Displays the state of every bridged Bluetooth LE device, the number of its successful\n"
+		      "recoveries, and the time it took to make the device reachable after the last connection loss.\n",
+		      RecoveryStatsHandler, 1, 0),
 #ifdef CONFIG_BT_SMP
 	SHELL_CMD_ARG(pincode, NULL,
 		      "Insert pincode for Bluetooth LE device pairing. \n"
@@ -53,6 +53,9 @@ CHIP_ERROR BridgeManager::Init(LoadStoredBridgedDevicesCallback loadStoredBridge
 
 	Nrf::Matter::BindingHandler::Init();
 
+	k_timer_init(&mReportTimer, BridgeManager::ReportTimerTimeoutCallback, nullptr);
+	mUpdateStatsResetTime = k_uptime_get();
+
 	/* Invoke the callback to load stored devices in a proper moment. */
 	CHIP_ERROR err = loadStoredBridgedDevicesCb();
 
@@ -146,6 +149,8 @@ CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
 	bool removeProvider = true;
 	auto &devicePair = mDevicesMap[index];
 
+	RemoveProviderDevice(devicePair.mProvider, index);
+
 	uint8_t duplicatesNumber = mDevicesMap.GetDuplicatesCount(devicePair, duplicatedItemKeys);
 	/* There must be at least 2 duplicates in the map to determine the real duplicate,
        as the one under the current index is also contained in the map. */
@@ -210,6 +215,10 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 
 	/* Check if the current provider is already contained in the map - if so, there is at least one duplicate */
 	bool isNewProvider = (Instance().mDevicesMap.GetDuplicatesCount(pair, duplicatedItemKeys) == 0);
+	ProviderDevices *providerDevices = GetProviderDevices(isNewProvider ? nullptr : dataProvider);
+
+	VerifyOrReturnError(providerDevices && providerDevices->mDevicesCount < kMaxBridgedDevicesPerProvider,
+			    CHIP_ERROR_NO_MEMORY, LOG_ERR("Maximum number of devices per provider exceeded"));
 
 	if (isNewProvider) {
 		VerifyOrReturnError(mNumberOfProviders + 1 <= kMaxDataProviders, CHIP_ERROR_NO_MEMORY,
@@ -240,6 +249,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 			devicesPairIndex.SetValue(index);
 			mDevicesIndexes[mDevicesIndexesCounter] = index;
 			mDevicesIndexesCounter++;
+			AddProviderDevice(*providerDevices, dataProvider, device, index);
 
 			/* Make sure that the following endpoint id assignments will be monotonically continued from the
 			 * biggest assigned number. */
@@ -282,6 +292,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 						devicesPairIndex.SetValue(index);
 						mDevicesIndexes[mDevicesIndexesCounter] = index;
 						mDevicesIndexesCounter++;
+						AddProviderDevice(*providerDevices, dataProvider, device, index);
 					}
 
 					return err;
@@ -299,6 +310,131 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 	return CHIP_ERROR_NO_MEMORY;
 }
 
+BridgeManager::ProviderDevices *BridgeManager::GetProviderDevices(const BridgedDeviceDataProvider *dataProvider)
+{
+	/* Searching for nullptr returns the first free entry. */
+	for (auto &providerDevices : mProviderDevices) {
+		if (providerDevices.mProvider == dataProvider) {
+			return &providerDevices;
+		}
+	}
+	return nullptr;
+}
+
+void BridgeManager::AddProviderDevice(ProviderDevices &providerDevices, BridgedDeviceDataProvider *dataProvider,
+				      MatterBridgedDevice *device, uint8_t index)
+{
+	providerDevices.mProvider = dataProvider;
+	providerDevices.mDevices[providerDevices.mDevicesCount] = device;
+	providerDevices.mIndexes[providerDevices.mDevicesCount] = index;
+	providerDevices.mDevicesCount++;
+
+	mUpdateStats[index] = {};
+}
+
+void BridgeManager::RemoveProviderDevice(BridgedDeviceDataProvider *dataProvider, uint8_t index)
+{
+	ProviderDevices *providerDevices = dataProvider ? GetProviderDevices(dataProvider) : nullptr;
+
+	if (providerDevices) {
+		for (uint8_t i = 0; i < providerDevices->mDevicesCount; i++) {
+			if (providerDevices->mIndexes[i] == index) {
+				providerDevices->mDevicesCount--;
+				providerDevices->mDevices[i] = providerDevices->mDevices[providerDevices->mDevicesCount];
+				providerDevices->mIndexes[i] = providerDevices->mIndexes[providerDevices->mDevicesCount];
+				break;
+			}
+		}
+
+		if (providerDevices->mDevicesCount == 0) {
+			providerDevices->mProvider = nullptr;
+		}
+	}
+
+	/* Drop the pending reports of the removed device, as its endpoint is no longer valid. */
+	uint8_t count = 0;
+	for (uint8_t i = 0; i < mPendingReportsCount; i++) {
+		if (mPendingReports[i].mIndex != index) {
+			mPendingReports[count++] = mPendingReports[i];
+		}
+	}
+	mPendingReportsCount = count;
+}
+
+void BridgeManager::ReportAttributeChange(uint8_t index, EndpointId endpointId, ClusterId clusterId,
+					  AttributeId attributeId)
+{
+	if (kReportWindowMs == 0) {
+		MatterReportingAttributeChangeCallback(endpointId, clusterId, attributeId);
+		mUpdateStats[index].mReports++;
+		return;
+	}
+
+	for (uint8_t i = 0; i < mPendingReportsCount; i++) {
+		const PendingReport &report = mPendingReports[i];
+
+		if (report.mEndpointId == endpointId && report.mClusterId == clusterId &&
+		    report.mAttributeId == attributeId) {
+			/* The attribute is already going to be reported with its current value. */
+			return;
+		}
+	}
+
+	if (mPendingReportsCount == kMaxPendingReports) {
+		FlushPendingReports();
+	}
+
+	mPendingReports[mPendingReportsCount++] = { index, endpointId, clusterId, attributeId };
+
+	if (!mReportTimerActive) {
+		mReportTimerActive = true;
+		k_timer_start(&mReportTimer, K_MSEC(kReportWindowMs), K_NO_WAIT);
+	}
+}
+
+void BridgeManager::FlushPendingReports()
+{
+	for (uint8_t i = 0; i < mPendingReportsCount; i++) {
+		const PendingReport &report = mPendingReports[i];
+
+		MatterReportingAttributeChangeCallback(report.mEndpointId, report.mClusterId, report.mAttributeId);
+		mUpdateStats[report.mIndex].mReports++;
+	}
+
+	mPendingReportsCount = 0;
+}
+
+void BridgeManager::ReportTimerTimeoutCallback(k_timer *timer)
+{
+	DeviceLayer::PlatformMgr().ScheduleWork(
+		[](intptr_t) {
+			Instance().mReportTimerActive = false;
+			Instance().FlushPendingReports();
+		},
+		0);
+}
+
+CHIP_ERROR BridgeManager::GetUpdateStats(EndpointId endpoint, UpdateStats &stats)
+{
+	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
+
+	DeviceLayer::StackLock lock;
+
+	VerifyOrReturnError(endpointIndex < kMaxBridgedDevices && mDevicesMap.Contains(endpointIndex),
+			    CHIP_ERROR_NOT_FOUND);
+
+	stats = mUpdateStats[endpointIndex];
+	return CHIP_NO_ERROR;
+}
+
+void BridgeManager::ResetUpdateStats()
+{
+	DeviceLayer::StackLock lock;
+
+	memset(mUpdateStats, 0, sizeof(mUpdateStats));
+	mUpdateStatsResetTime = k_uptime_get();
+}
+
 CHIP_ERROR BridgeManager::CreateEndpoint(uint8_t index, uint16_t endpointId)
 {
 	if (!mDevicesMap.Contains(index)) {
@@ -464,14 +600,19 @@ void BridgeManager::HandleUpdate(BridgedDeviceDataProvider &dataProvider, Cluste
 
 	/* The state update was triggered by non-Matter device, find bridged Matter device to update it as well.
 	 */
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			/* If the Bridged Device state was updated successfully, schedule sending Matter data
-			 * report. */
-			auto *device = item.value.mDevice;
-			if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
-				MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
-			}
+	ProviderDevices *providerDevices = Instance().GetProviderDevices(&dataProvider);
+
+	VerifyOrReturn(providerDevices);
+
+	for (uint8_t i = 0; i < providerDevices->mDevicesCount; i++) {
+		auto *device = providerDevices->mDevices[i];
+		uint8_t index = providerDevices->mIndexes[i];
+
+		Instance().mUpdateStats[index].mUpdates++;
+
+		/* If the Bridged Device state was updated successfully, schedule sending Matter data report. */
+		if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
+			Instance().ReportAttributeChange(index, device->GetEndpointId(), clusterId, attributeId);
 		}
 	}
 }
@@ -490,13 +631,13 @@ void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, Clust
 	bindingData->ClusterId = clusterId;
 	bindingData->InvokeCommandFunc = invokeCommand;
 
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			auto *device = item.value.mDevice;
+	ProviderDevices *providerDevices = Instance().GetProviderDevices(&dataProvider);
 
-			if (emberAfContainsClient(device->GetEndpointId(), clusterId)) {
-				bindingData->EndpointId = device->GetEndpointId();
-			}
+	for (uint8_t i = 0; providerDevices && i < providerDevices->mDevicesCount; i++) {
+		auto *device = providerDevices->mDevices[i];
+
+		if (emberAfContainsClient(device->GetEndpointId(), clusterId)) {
+			bindingData->EndpointId = device->GetEndpointId();
 		}
 	}
 
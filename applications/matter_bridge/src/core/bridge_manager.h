@@ -12,6 +12,8 @@
 #include "bridged_device_data_provider.h"
 #include "matter_bridged_device.h"
 
+#include <zephyr/kernel.h>
+
 namespace Nrf
 {
 
@@ -117,6 +119,38 @@ public:
 	 */
 	const char *GetNodeLabel(chip::EndpointId endpoint);
 
+	/**
+	 * @brief Attribute update statistics of a bridged device.
+	 */
+	struct UpdateStats {
+		/* Number of attribute changes received from the data provider. */
+		uint32_t mUpdates;
+		/* Number of attribute changes reported to Matter. */
+		uint32_t mReports;
+	};
+
+	/**
+	 * @brief Get the attribute update statistics of the bridged device on the specified endpoint.
+	 *
+	 * @param endpoint endpoint on which the bridged device is stored
+	 * @param[out] stats statistics of the bridged device collected since the last reset
+	 * @return CHIP_NO_ERROR on success
+	 * @return CHIP_ERROR_NOT_FOUND if there is no bridged device on the specified endpoint
+	 */
+	CHIP_ERROR GetUpdateStats(chip::EndpointId endpoint, UpdateStats &stats);
+
+	/**
+	 * @brief Get the time elapsed since the attribute update statistics were reset.
+	 *
+	 * @return time in milliseconds
+	 */
+	uint32_t GetUpdateStatsPeriod() { return static_cast<uint32_t>(k_uptime_get() - mUpdateStatsResetTime); }
+
+	/**
+	 * @brief Reset the attribute update statistics of all bridged devices.
+	 */
+	void ResetUpdateStats();
+
 	static CHIP_ERROR HandleRead(uint16_t index, chip::ClusterId clusterId,
 				     const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer,
 				     uint16_t maxReadLength);
@@ -185,6 +219,25 @@ private:
 	};
 
 	static constexpr uint8_t kMaxDataProviders = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER;
+	static constexpr uint32_t kReportWindowMs = CONFIG_BRIDGE_REPORT_COALESCING_WINDOW_MS;
+	static constexpr uint8_t kMaxPendingReports = CONFIG_BRIDGE_REPORT_COALESCING_QUEUE_SIZE;
+
+	/* Bridged devices of a single data provider, used to find the devices to update without iterating over all
+	 * bridged devices. */
+	struct ProviderDevices {
+		BridgedDeviceDataProvider *mProvider{ nullptr };
+		MatterBridgedDevice *mDevices[kMaxBridgedDevicesPerProvider];
+		uint8_t mIndexes[kMaxBridgedDevicesPerProvider];
+		uint8_t mDevicesCount{ 0 };
+	};
+
+	/* Attribute change waiting to be reported to Matter at the end of the coalescing window. */
+	struct PendingReport {
+		uint8_t mIndex;
+		chip::EndpointId mEndpointId;
+		chip::ClusterId mClusterId;
+		chip::AttributeId mAttributeId;
+	};
 
 	using DeviceMap = FiniteMap<uint16_t, BridgedDevicePair, kMaxBridgedDevices>;
 
@@ -256,7 +309,39 @@ private:
 	 */
 	CHIP_ERROR CreateEndpoint(uint8_t index, uint16_t endpointId);
 
+	/**
+	 * @brief Get the bridged devices of the data provider.
+	 *
+	 * @param dataProvider data provider to find the bridged devices of
+	 * @return pointer to the bridged devices of the data provider, or nullptr if the data provider is not bridged
+	 */
+	ProviderDevices *GetProviderDevices(const BridgedDeviceDataProvider *dataProvider);
+	void AddProviderDevice(ProviderDevices &providerDevices, BridgedDeviceDataProvider *dataProvider,
+			       MatterBridgedDevice *device, uint8_t index);
+	void RemoveProviderDevice(BridgedDeviceDataProvider *dataProvider, uint8_t index);
+
+	/**
+	 * @brief Report the attribute change to Matter. If the coalescing window is enabled, the report is deferred
+	 * until the end of the window and merged with other changes of the same attribute.
+	 *
+	 * @param index index of the bridged device
+	 * @param endpointId endpoint id of the bridged device
+	 * @param clusterId cluster id of the changed attribute
+	 * @param attributeId attribute id of the changed attribute
+	 */
+	void ReportAttributeChange(uint8_t index, chip::EndpointId endpointId, chip::ClusterId clusterId,
+				   chip::AttributeId attributeId);
+	void FlushPendingReports();
+	static void ReportTimerTimeoutCallback(k_timer *timer);
+
 	DeviceMap mDevicesMap;
+	ProviderDevices mProviderDevices[kMaxDataProviders];
+	UpdateStats mUpdateStats[kMaxBridgedDevices] = {};
+	int64_t mUpdateStatsResetTime{ 0 };
+	PendingReport mPendingReports[kMaxPendingReports];
+	uint8_t mPendingReportsCount{ 0 };
+	k_timer mReportTimer;
+	bool mReportTimerActive{ false };
 	uint16_t mNumberOfProviders{ 0 };
 	uint8_t mDevicesIndexes[BridgeManager::kMaxBridgedDevices] = { 0 };
 	uint8_t mDevicesIndexesCounter;
@@ -24,6 +24,12 @@ LOG_MODULE_REGISTER(sw_codec_select, CONFIG_SW_CODEC_SELECT_LOG_LEVEL);
 /* Used for debugging, inserts 0 instead of packet loss concealment */
 #define SW_CODEC_OVERRIDE_PLC false
 
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+#define SRC_BITS_PER_SAMPLE 32
+#else
+#define SRC_BITS_PER_SAMPLE 16
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32 */
+
 static struct sw_codec_config m_config;
 
 static struct sample_rate_converter_ctx encoder_converters[CONFIG_AUDIO_ENCODE_CHANNELS_MAX];
@@ -265,6 +271,7 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 		uint32_t loc_in, loc_out;
 		uint32_t bad_data_mask;
 		size_t inter_in_size = 0;
+		bool src_interleaved;
 
 		if (meta_in->data_coding != LC3 || meta_out->data_coding != PCM) {
 			LOG_ERR("LC3 decoder module has incorrect input or output data type: in = "
@@ -318,6 +325,13 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 			}
 		}
 
+		/* Resample each channel straight into the interleaved output, skipping the
+		 * intermediate buffer and the separate interleaving pass over the output.
+		 */
+		src_interleaved = IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER) && meta_out->interleaved &&
+				  meta_in->sample_rate_hz != meta_out->sample_rate_hz &&
+				  meta_out->carried_bits_per_sample == SRC_BITS_PER_SAMPLE;
+
 		/* Clear all output channels to ensure any unused are zero */
 		memset(audio_frame_out->data, 0, audio_frame_out->size);
 
@@ -341,21 +355,31 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 							   (meta_in->bad_data & bad_data_mask));
 				ERR_CHK_MSG(ret, "Decode failed");
 
-				ret = sw_codec_sample_rate_convert(
-					&decoder_converters[chan_in], meta_in->sample_rate_hz,
-					meta_out->sample_rate_hz, dec_out, bytes_written, src_out,
-					(char **)&inter_in, &inter_in_size);
-				ERR_CHK_MSG(ret, "Decode: Sample rate converter failed");
-
-				if (meta_out->interleaved) {
-					ret = pscm_interleave(inter_in, inter_in_size, chan_out,
-							      meta_out->carried_bits_per_sample,
-							      audio_frame_out->data,
-							      audio_frame_out->size, chans_out_num);
-					ERR_CHK_MSG(ret, "Decode: Interleave failed");
+				if (src_interleaved) {
+					ret = sample_rate_converter_process_interleaved(
+						&decoder_converters[chan_in], SAMPLE_RATE_FILTER_SIMPLE,
+						dec_out, bytes_written, meta_in->sample_rate_hz,
+						audio_frame_out->data, audio_frame_out->size,
+						&inter_in_size, meta_out->sample_rate_hz, chan_out,
+						chans_out_num);
+					ERR_CHK_MSG(ret, "Decode: Sample rate converter failed");
 				} else {
-					if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER) &&
-					    meta_in->sample_rate_hz != meta_out->sample_rate_hz) {
+					ret = sw_codec_sample_rate_convert(
+						&decoder_converters[chan_in], meta_in->sample_rate_hz,
+						meta_out->sample_rate_hz, dec_out, bytes_written, src_out,
+						(char **)&inter_in, &inter_in_size);
+					ERR_CHK_MSG(ret, "Decode: Sample rate converter failed");
+
+					if (meta_out->interleaved) {
+						ret = pscm_interleave(inter_in, inter_in_size, chan_out,
+								      meta_out->carried_bits_per_sample,
+								      audio_frame_out->data,
+								      audio_frame_out->size,
+								      chans_out_num);
+						ERR_CHK_MSG(ret, "Decode: Interleave failed");
+					} else if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER) &&
+						   meta_in->sample_rate_hz !=
+							   meta_out->sample_rate_hz) {
 						src_out += inter_in_size;
 					} else {
 						dec_out += inter_in_size;
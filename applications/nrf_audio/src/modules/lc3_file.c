@@ -7,11 +7,274 @@
 #include "lc3_file.h"
 #include "sd_card.h"
 
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sd_card_lc3_file, CONFIG_MODULE_SD_CARD_LC3_FILE_LOG_LEVEL);
 
 #define LC3_FILE_ID 0xCC1C
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+#define LC3_FILE_CACHE_BLOCK_SIZE CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_BLOCK_SIZE
+#define LC3_FILE_CACHE_SIZE                                                                        \
+	(LC3_FILE_CACHE_BLOCK_SIZE * CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_NUM_BLOCKS)
+
+#if (LC3_FILE_CACHE_BLOCK_SIZE % 512) != 0
+#error "CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_BLOCK_SIZE must be a multiple of 512"
+#endif
+
+/* Ring buffer holding the next bytes of a file. The blocks are read from the start of the file,
+ * so each read from the SD card is sector-aligned and never wraps around the end of the buffer.
+ */
+struct lc3_file_cache {
+	/* The file being read through the cache */
+	struct lc3_file_ctx *file;
+
+	/* Work item filling the cache from the read-ahead work queue */
+	struct k_work work;
+
+	/* Serializes the reads from the SD card between the work item and the reader */
+	struct k_mutex fill_lock;
+
+	/* Protects the indexes below */
+	struct k_spinlock lock;
+
+	/* Offset of the next byte to be parsed */
+	size_t read_idx;
+
+	/* Offset of the next block to be read from the SD card */
+	size_t write_idx;
+
+	/* Number of bytes in the cache that are not yet parsed */
+	size_t filled;
+
+	/* The last block of the file has been read */
+	bool eof;
+
+	uint8_t buf[LC3_FILE_CACHE_SIZE] __aligned(4);
+};
+
+K_THREAD_STACK_DEFINE(lc3_file_work_q_stack_area,
+		      CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_STACK_SIZE);
+
+static struct k_work_q lc3_file_work_q;
+static bool lc3_file_work_q_started;
+
+static struct lc3_file_cache caches[CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_NUM_CACHES];
+static ATOMIC_DEFINE(caches_in_use, CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_NUM_CACHES);
+
+/**
+ * @brief Read the next block of the file into the cache, if there is room for it.
+ *
+ * @param[in]	cache	Pointer to the cache to fill.
+ *
+ * @retval	Number of bytes read from the SD card, or a negative error code.
+ */
+static int cache_fill(struct lc3_file_cache *cache)
+{
+	int ret;
+	k_spinlock_key_t key;
+	size_t write_idx;
+	size_t size = LC3_FILE_CACHE_BLOCK_SIZE;
+
+	(void)k_mutex_lock(&cache->fill_lock, K_FOREVER);
+
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->eof || ((LC3_FILE_CACHE_SIZE - cache->filled) < LC3_FILE_CACHE_BLOCK_SIZE)) {
+		k_spin_unlock(&cache->lock, key);
+		(void)k_mutex_unlock(&cache->fill_lock);
+		return 0;
+	}
+
+	write_idx = cache->write_idx;
+
+	k_spin_unlock(&cache->lock, key);
+
+	/* The reader only parses filled bytes, so the block can be read without holding the lock */
+	ret = sd_card_read((char *)&cache->buf[write_idx], &size, &cache->file->file_object);
+	if (ret) {
+		LOG_ERR("Failed to read block: %d", ret);
+		(void)k_mutex_unlock(&cache->fill_lock);
+		return ret;
+	}
+
+	key = k_spin_lock(&cache->lock);
+
+	cache->write_idx = (write_idx + LC3_FILE_CACHE_BLOCK_SIZE) % LC3_FILE_CACHE_SIZE;
+	cache->filled += size;
+
+	if (size < LC3_FILE_CACHE_BLOCK_SIZE) {
+		cache->eof = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	(void)k_mutex_unlock(&cache->fill_lock);
+
+	return (int)size;
+}
+
+static void cache_fill_work(struct k_work *work)
+{
+	int ret;
+	struct lc3_file_cache *cache = CONTAINER_OF(work, struct lc3_file_cache, work);
+
+	do {
+		ret = cache_fill(cache);
+	} while (ret > 0);
+
+	if (ret < 0) {
+		LOG_WRN("Read-ahead failed: %d", ret);
+	}
+}
+
+/**
+ * @brief Read from the cache, and schedule the next block to be read once there is room for it.
+ *
+ * @details Blocks until the bytes are read from the SD card if they are not in the cache.
+ *
+ * @param[in]		cache	Pointer to the cache to read from.
+ * @param[out]		buf	Pointer to the buffer to write the data into.
+ * @param[in, out]	size	Number of bytes to read, and the number of bytes read. Less than
+ *				requested at the end of the file.
+ *
+ * @retval	0	Success, negative value otherwise.
+ */
+static int cache_read(struct lc3_file_cache *cache, uint8_t *buf, size_t *size)
+{
+	int ret;
+	k_spinlock_key_t key;
+	size_t read_idx;
+	size_t available;
+	size_t chunk;
+	size_t read = 0;
+	bool eof;
+
+	while (read < *size) {
+		key = k_spin_lock(&cache->lock);
+		read_idx = cache->read_idx;
+		available = cache->filled;
+		eof = cache->eof;
+		k_spin_unlock(&cache->lock, key);
+
+		if (available == 0) {
+			if (eof) {
+				break;
+			}
+
+			ret = cache_fill(cache);
+			if (ret < 0) {
+				return ret;
+			}
+
+			continue;
+		}
+
+		chunk = MIN(MIN(*size - read, available), LC3_FILE_CACHE_SIZE - read_idx);
+
+		memcpy(&buf[read], &cache->buf[read_idx], chunk);
+		read += chunk;
+
+		key = k_spin_lock(&cache->lock);
+		cache->read_idx = (read_idx + chunk) % LC3_FILE_CACHE_SIZE;
+		cache->filled -= chunk;
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	*size = read;
+
+	key = k_spin_lock(&cache->lock);
+	eof = cache->eof;
+	available = cache->filled;
+	k_spin_unlock(&cache->lock, key);
+
+	if (!eof && ((LC3_FILE_CACHE_SIZE - available) >= LC3_FILE_CACHE_BLOCK_SIZE)) {
+		ret = k_work_submit_to_queue(&lc3_file_work_q, &cache->work);
+		if (ret < 0) {
+			LOG_WRN("Failed to submit read-ahead: %d", ret);
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Attach a free cache to the file, if any.
+ *
+ * @param[in]	file	Pointer to the file context.
+ */
+static void cache_attach(struct lc3_file_ctx *file)
+{
+	file->cache = NULL;
+
+	if (!lc3_file_work_q_started) {
+		return;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(caches); i++) {
+		if (!atomic_test_and_set_bit(caches_in_use, i)) {
+			struct lc3_file_cache *cache = &caches[i];
+
+			cache->file = file;
+			cache->read_idx = 0;
+			cache->write_idx = 0;
+			cache->filled = 0;
+			cache->eof = false;
+			k_work_init(&cache->work, cache_fill_work);
+			k_mutex_init(&cache->fill_lock);
+
+			file->cache = cache;
+			return;
+		}
+	}
+
+	LOG_WRN("No free read-ahead cache, reading directly from the SD card");
+}
+
+/**
+ * @brief Wait for any ongoing read-ahead of the file to finish, and free its cache.
+ *
+ * @param[in]	file	Pointer to the file context.
+ */
+static void cache_detach(struct lc3_file_ctx *file)
+{
+	struct k_work_sync sync;
+
+	if (file->cache == NULL) {
+		return;
+	}
+
+	(void)k_work_cancel_sync(&file->cache->work, &sync);
+
+	atomic_clear_bit(caches_in_use, ARRAY_INDEX(caches, file->cache));
+	file->cache = NULL;
+}
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
+
+/**
+ * @brief Read from the file, through the read-ahead cache if the file has one.
+ *
+ * @param[in]		file	Pointer to the file context.
+ * @param[out]		buf	Pointer to the buffer to write the data into.
+ * @param[in, out]	size	Number of bytes to read, and the number of bytes read.
+ *
+ * @retval	0	Success, negative value otherwise.
+ */
+static int file_read(struct lc3_file_ctx *file, char *buf, size_t *size)
+{
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	if (file->cache != NULL) {
+		return cache_read(file->cache, (uint8_t *)buf, size);
+	}
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
+
+	return sd_card_read(buf, size, &file->file_object);
+}
+
 static void lc3_header_print(struct lc3_file_header *header)
 {
 	if (header == NULL) {
@@ -53,7 +316,7 @@ int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer
 	uint16_t frame_header;
 	size_t frame_header_size = sizeof(frame_header);
 
-	ret = sd_card_read((char *)&frame_header, &frame_header_size, &file->file_object);
+	ret = file_read(file, (char *)&frame_header, &frame_header_size);
 	if (ret) {
 		LOG_ERR("Failed to read frame header: %d", ret);
 		return ret;
@@ -74,7 +337,7 @@ int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer
 	/* Read frame data */
 	size_t frame_size = frame_header;
 
-	ret = sd_card_read((char *)buffer, &frame_size, &file->file_object);
+	ret = file_read(file, (char *)buffer, &frame_size);
 	if (ret) {
 		LOG_ERR("Failed to read frame data: %d", ret);
 		return ret;
@@ -104,10 +367,17 @@ int lc3_file_open(struct lc3_file_ctx *file, const char *file_name)
 		return ret;
 	}
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	cache_attach(file);
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
+
 	/* Read LC3 header and store in struct */
-	ret = sd_card_read((char *)&file->lc3_header, &size, &file->file_object);
+	ret = file_read(file, (char *)&file->lc3_header, &size);
 	if (ret) {
 		LOG_ERR("Failed to read the LC3 header: %d", ret);
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+		cache_detach(file);
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
 		return ret;
 	}
 
@@ -116,6 +386,9 @@ int lc3_file_open(struct lc3_file_ctx *file, const char *file_name)
 
 	if (file->lc3_header.file_id != LC3_FILE_ID) {
 		LOG_ERR("Invalid file ID: 0x%04x", file->lc3_header.file_id);
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+		cache_detach(file);
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
 		return -EINVAL;
 	}
 
@@ -131,6 +404,10 @@ int lc3_file_close(struct lc3_file_ctx *file)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	cache_detach(file);
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
+
 	ret = sd_card_close(&file->file_object);
 	if (ret) {
 		LOG_ERR("Failed to close file: %d", ret);
@@ -150,5 +427,16 @@ int lc3_file_init(void)
 		return ret;
 	}
 
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	if (!lc3_file_work_q_started) {
+		k_work_queue_start(&lc3_file_work_q, lc3_file_work_q_stack_area,
+				   K_THREAD_STACK_SIZEOF(lc3_file_work_q_stack_area),
+				   CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_THREAD_PRIO, NULL);
+		k_thread_name_set(&lc3_file_work_q.thread, "lc3_file_work_q");
+
+		lc3_file_work_q_started = true;
+	}
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
+
 	return 0;
 }
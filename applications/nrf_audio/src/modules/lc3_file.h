@@ -41,6 +41,8 @@ struct lc3_file_header {
 	uint16_t signal_len_msb; /**< Number of samples in signal, 16 MSB (>> 16) */
 } __packed;
 
+struct lc3_file_cache;
+
 /**
  * @brief LC3 file context structure.
  *
@@ -52,6 +54,10 @@ struct lc3_file_ctx {
 	struct fs_file_t file_object;
 	struct lc3_file_header lc3_header;
 	uint32_t number_of_samples;
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	/* Read-ahead cache of the file, NULL if the file is read directly from the SD card */
+	struct lc3_file_cache *cache;
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
 };
 
 /**
@@ -103,7 +109,8 @@ int lc3_file_close(struct lc3_file_ctx *file);
 /**
  * @brief Initialize the LC3 file module.
  *
- * Initializes the SD card and mounts the file system.
+ * Initializes the SD card and mounts the file system. If the read-ahead cache is enabled,
+ * this also starts the work queue that fills the caches.
  *
  * @retval -ENODEV	SD card init failed. SD card likely not inserted.
  * @retval 0		Success.
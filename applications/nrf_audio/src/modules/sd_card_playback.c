@@ -8,11 +8,12 @@
 
 #include <stdint.h>
 #include <math.h>
-#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/shell/shell.h>
 #include <pcm_mix.h>
 
 #include "sd_card.h"
+#include "spsc_ring.h"
 #include "sw_codec_lc3.h"
 #include "sw_codec_select.h"
 #include "audio_system.h"
@@ -72,9 +73,12 @@ enum audio_formats {
 	SD_CARD_PLAYBACK_LC3,
 };
 
-RING_BUF_DECLARE(m_ringbuf_audio_data_lc3, CONFIG_SD_CARD_PLAYBACK_RING_BUF_SIZE);
+/* The ring buffer is written by the playback thread and read by the audio datapath only, so it
+ * is accessed without locking.
+ */
+static uint8_t m_ringbuf_audio_data_buf[CONFIG_SD_CARD_PLAYBACK_RING_BUF_SIZE];
+static struct spsc_ring m_ringbuf_audio_data;
 K_SEM_DEFINE(m_sem_ringbuf_space_available, 0, 1);
-K_MUTEX_DEFINE(mtx_ringbuf);
 K_SEM_DEFINE(m_sem_playback, 0, 1);
 K_THREAD_STACK_DEFINE(sd_card_playback_thread_stack, CONFIG_SD_CARD_PLAYBACK_STACK_SIZE);
 
@@ -94,29 +98,22 @@ static struct lc3_playback_config lc3_playback_cfg;
 
 static struct fs_file_t f_seg_read_entry;
 
+/* Ring buffer statistics */
+static atomic_t stats_underruns;
+static atomic_t stats_producer_waits;
+static atomic_t stats_producer_timeouts;
+
 static int sd_card_playback_ringbuf_read(uint8_t *buf, size_t *size)
 {
-	int ret;
-	uint16_t read_size;
+	size_t read_size;
 
-	ret = k_mutex_lock(&mtx_ringbuf, K_NO_WAIT);
-	if (ret) {
-		LOG_ERR("Unable to take mutex. Ret: %d", ret);
-		return ret;
-	}
-
-	read_size = ring_buf_get(&m_ringbuf_audio_data_lc3, buf, *size);
+	read_size = spsc_ring_get(&m_ringbuf_audio_data, buf, *size);
 	if (read_size != *size) {
+		atomic_inc(&stats_underruns);
 		LOG_WRN("Read size (%d) not equal requested size (%d)", read_size, *size);
 	}
 
-	ret = k_mutex_unlock(&mtx_ringbuf);
-	if (ret) {
-		LOG_ERR("Mutex unlock err: %d", ret);
-		return ret;
-	}
-
-	if (ring_buf_space_get(&m_ringbuf_audio_data_lc3) >= pcm_frame_size) {
+	if (spsc_ring_space_get(&m_ringbuf_audio_data) >= pcm_frame_size) {
 		k_sem_give(&m_sem_ringbuf_space_available);
 	}
 
@@ -125,41 +122,64 @@ static int sd_card_playback_ringbuf_read(uint8_t *buf, size_t *size)
 	return 0;
 }
 
-static int sd_card_playback_ringbuf_write(uint8_t *buffer, size_t numbytes)
+static int sd_card_playback_ringbuf_space_wait(size_t numbytes)
 {
 	int ret;
-	uint8_t *buf_ptr;
 
-	/* The ringbuffer is read every 10 ms by audio datapath when SD card playback is enabled.
-	 * Timeout value should therefore not be less than 10 ms
-	 */
-	ret = k_sem_take(&m_sem_ringbuf_space_available, K_MSEC(20));
-	if (ret) {
-		LOG_ERR("Sem take err: %d. Skipping frame", ret);
-		return ret;
-	}
+	while (spsc_ring_space_get(&m_ringbuf_audio_data) < numbytes) {
+		atomic_inc(&stats_producer_waits);
 
-	ret = k_mutex_lock(&mtx_ringbuf, K_NO_WAIT);
-	if (ret) {
-		LOG_ERR("Unable to take mutex. Ret: %d", ret);
-		return ret;
+		/* The ringbuffer is read every 10 ms by audio datapath when SD card playback is
+		 * enabled. Timeout value should therefore not be less than 10 ms
+		 */
+		ret = k_sem_take(&m_sem_ringbuf_space_available, K_MSEC(20));
+		if (ret) {
+			atomic_inc(&stats_producer_timeouts);
+			LOG_ERR("Sem take err: %d. Skipping frame", ret);
+			return ret;
+		}
 	}
 
-	numbytes = ring_buf_put_claim(&m_ringbuf_audio_data_lc3, &buf_ptr, numbytes);
-	memcpy(buf_ptr, buffer, numbytes);
-	ret = ring_buf_put_finish(&m_ringbuf_audio_data_lc3, numbytes);
+	return 0;
+}
+
+/* Read from the file straight into the ring buffer, without an intermediate buffer */
+static int sd_card_playback_ringbuf_load_from_file(size_t *numbytes)
+{
+	int ret;
+	uint8_t *buf_ptr;
+	size_t claimed;
+	size_t read_size;
+	size_t loaded = 0;
+
+	ret = sd_card_playback_ringbuf_space_wait(*numbytes);
 	if (ret) {
-		LOG_ERR("Ring buf put finish err: %d", ret);
 		return ret;
 	}
 
-	ret = k_mutex_unlock(&mtx_ringbuf);
-	if (ret) {
-		LOG_ERR("Mutex unlock err: %d", ret);
-		return ret;
+	/* The free space can wrap around the end of the ring buffer once */
+	while (loaded < *numbytes) {
+		claimed = spsc_ring_put_claim(&m_ringbuf_audio_data, &buf_ptr, *numbytes - loaded);
+		read_size = claimed;
+
+		ret = sd_card_read((char *)buf_ptr, &read_size, &f_seg_read_entry);
+		if (ret < 0) {
+			LOG_ERR("SD card read err: %d", ret);
+			return ret;
+		}
+
+		spsc_ring_put_finish(&m_ringbuf_audio_data, read_size);
+		loaded += read_size;
+
+		if (read_size < claimed) {
+			/* End of file */
+			break;
+		}
 	}
 
-	return numbytes;
+	*numbytes = loaded;
+
+	return 0;
 }
 
 static int sd_card_playback_check_wav_header(struct wav_header wav_file_header)
@@ -227,22 +247,15 @@ static int sd_card_playback_play_wav(void)
 
 	/* Size corresponding to frame size of audio BT stream */
 	pcm_frame_size = wav_file_header.byte_rate * FRAME_DURATION_MS / 1000;
-	wav_read_size = pcm_frame_size;
-	uint8_t pcm_mono_frame[wav_read_size];
 
 	audio_length_bytes = wav_file_header.wav_size + 8 - sizeof(wav_file_header);
-	n_iter = ceil((float)audio_length_bytes / (float)wav_read_size);
+	n_iter = ceil((float)audio_length_bytes / (float)pcm_frame_size);
 
 	for (int i = 0; i < n_iter; i++) {
-		/* Read a chunk of audio data from file */
-		ret = sd_card_read(pcm_mono_frame, &wav_read_size, &f_seg_read_entry);
-		if (ret < 0) {
-			LOG_ERR("SD card read err: %d", ret);
-			break;
-		}
+		/* Read a chunk of audio data from file into the ringbuffer */
+		wav_read_size = pcm_frame_size;
 
-		/* Write audio data to the ringbuffer */
-		ret = sd_card_playback_ringbuf_write(pcm_mono_frame, wav_read_size);
+		ret = sd_card_playback_ringbuf_load_from_file(&wav_read_size);
 		if (ret < 0) {
 			LOG_ERR("Load ringbuf err: %d", ret);
 			break;
@@ -276,6 +289,8 @@ static int sd_card_playback_play_lc3(void)
 	int ret;
 	int ret_sd_card_close;
 	uint16_t pcm_mono_write_size;
+	uint8_t *pcm_out;
+	size_t claimed;
 	uint8_t decoder_num_ch = audio_system_decoder_num_ch_get();
 	size_t lc3_file_header_size = sizeof(lc3_file_header);
 	size_t lc3_frame_header_size = sizeof(uint16_t);
@@ -333,19 +348,31 @@ static int sd_card_playback_play_lc3(void)
 			break;
 		}
 
+		ret = sd_card_playback_ringbuf_space_wait(pcm_frame_size);
+		if (ret < 0) {
+			LOG_ERR("Load ringbuf err: %d", ret);
+			break;
+		}
+
+		/* Decode straight into the ringbuffer, unless the frame wraps around its end */
+		claimed = spsc_ring_put_claim(&m_ringbuf_audio_data, &pcm_out, pcm_frame_size);
+		if (claimed < pcm_frame_size) {
+			pcm_out = pcm_mono_frame;
+		}
+
 		/* Decode audio data frame */
 		ret = sw_codec_lc3_dec_run(lc3_frame, lc3_playback_cfg.lc3_frame_length_bytes,
-					   pcm_frame_size, decoder_num_ch - 1, pcm_mono_frame,
+					   pcm_frame_size, decoder_num_ch - 1, pcm_out,
 					   &pcm_mono_write_size, false);
 		if (ret) {
 			LOG_ERR("Decoding err: %d", ret);
 			break;
 		}
 
-		ret = sd_card_playback_ringbuf_write((char *)pcm_mono_frame, pcm_mono_write_size);
-		if (ret < 0) {
-			LOG_ERR("Load ringbuf err: %d", ret);
-			break;
+		if (pcm_out == pcm_mono_frame) {
+			spsc_ring_put(&m_ringbuf_audio_data, pcm_mono_frame, pcm_mono_write_size);
+		} else {
+			spsc_ring_put_finish(&m_ringbuf_audio_data, pcm_mono_write_size);
 		}
 
 		if (i == 0) {
@@ -378,7 +405,7 @@ static void sd_card_playback_thread(void *arg1, void *arg2, void *arg3)
 		k_sem_take(&m_sem_playback, K_FOREVER);
 		switch (playback_file_format) {
 		case SD_CARD_PLAYBACK_WAV:
-			ring_buf_reset(&m_ringbuf_audio_data_lc3);
+			spsc_ring_reset(&m_ringbuf_audio_data);
 			k_sem_reset(&m_sem_ringbuf_space_available);
 			k_sem_give(&m_sem_ringbuf_space_available);
 			ret = sd_card_playback_play_wav();
@@ -389,7 +416,7 @@ static void sd_card_playback_thread(void *arg1, void *arg2, void *arg3)
 			break;
 
 		case SD_CARD_PLAYBACK_LC3:
-			ring_buf_reset(&m_ringbuf_audio_data_lc3);
+			spsc_ring_reset(&m_ringbuf_audio_data);
 			k_sem_reset(&m_sem_ringbuf_space_available);
 			k_sem_give(&m_sem_ringbuf_space_available);
 			ret = sd_card_playback_play_lc3();
@@ -465,10 +492,20 @@ int sd_card_playback_mix_with_stream(void *const pcm_a, size_t pcm_a_size)
 	return 0;
 }
 
+void sd_card_playback_stats_get(struct sd_card_playback_stats *stats)
+{
+	stats->underruns = atomic_get(&stats_underruns);
+	stats->producer_waits = atomic_get(&stats_producer_waits);
+	stats->producer_timeouts = atomic_get(&stats_producer_timeouts);
+}
+
 int sd_card_playback_init(void)
 {
 	int ret;
 
+	spsc_ring_init(&m_ringbuf_audio_data, m_ringbuf_audio_data_buf,
+		       sizeof(m_ringbuf_audio_data_buf));
+
 	sd_card_playback_thread_id = k_thread_create(
 		&sd_card_playback_thread_data, sd_card_playback_thread_stack,
 		CONFIG_SD_CARD_PLAYBACK_STACK_SIZE, (k_thread_entry_t)sd_card_playback_thread, NULL,
@@ -575,12 +612,26 @@ static int cmd_list_files(const struct shell *shell, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	struct sd_card_playback_stats stats;
+
+	sd_card_playback_stats_get(&stats);
+
+	shell_print(shell, "Underruns: %u", stats.underruns);
+	shell_print(shell, "Producer waits: %u", stats.producer_waits);
+	shell_print(shell, "Producer timeouts: %u", stats.producer_timeouts);
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(
 	sd_card_playback_cmd,
 	SHELL_COND_CMD(CONFIG_SHELL, play_lc3, NULL, "Play LC3 file", cmd_play_lc3_file),
 	SHELL_COND_CMD(CONFIG_SHELL, play_wav, NULL, "Play WAV file", cmd_play_wav_file),
 	SHELL_COND_CMD(CONFIG_SHELL, cd, NULL, "Change directory", cmd_change_dir),
 	SHELL_COND_CMD(CONFIG_SHELL, list_files, NULL, "List files", cmd_list_files),
+	SHELL_COND_CMD(CONFIG_SHELL, stats, NULL, "Show ring buffer statistics", cmd_stats),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(sd_card_playback, &sd_card_playback_cmd, "Play audio files from SD card", NULL);
@@ -19,6 +19,20 @@
 
 #include <zephyr/kernel.h>
 
+/**
+ * @brief Ring buffer statistics of the SD card playback module.
+ */
+struct sd_card_playback_stats {
+	/* Number of reads by the audio datapath that got less than a full frame */
+	uint32_t underruns;
+
+	/* Number of times the playback thread had to wait for space in the ring buffer */
+	uint32_t producer_waits;
+
+	/* Number of frames skipped because no space was freed in the ring buffer in time */
+	uint32_t producer_timeouts;
+};
+
 /**
  * @brief	Check whether or not the SD card playback module is active.
  *
@@ -65,6 +79,13 @@ int sd_card_playback_lc3(char *filename);
  */
 int sd_card_playback_mix_with_stream(void *const pcm_a, size_t pcm_a_size);
 
+/**
+ * @brief	Get the ring buffer statistics since the module was initialized.
+ *
+ * @param[out]	stats	Pointer to the structure to store the statistics.
+ */
+void sd_card_playback_stats_get(struct sd_card_playback_stats *stats);
+
 /**
  * @brief	Initialize the SD card playback module. Create the SD card playback thread.
  *
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "spsc_ring.h"
+
+#include <string.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+static size_t index_advance(struct spsc_ring const *const ring, size_t index, size_t size)
+{
+	index += size;
+
+	if (index >= (2 * ring->size)) {
+		index -= 2 * ring->size;
+	}
+
+	return index;
+}
+
+static size_t index_to_offset(struct spsc_ring const *const ring, size_t index)
+{
+	return (index < ring->size) ? index : (index - ring->size);
+}
+
+static size_t used_get(struct spsc_ring const *const ring, size_t head, size_t tail)
+{
+	return (head >= tail) ? (head - tail) : ((2 * ring->size) - tail + head);
+}
+
+void spsc_ring_init(struct spsc_ring *ring, uint8_t *buf, size_t size)
+{
+	__ASSERT_NO_MSG(ring != NULL);
+	__ASSERT_NO_MSG(buf != NULL);
+	__ASSERT_NO_MSG(size > 0);
+
+	ring->buf = buf;
+	ring->size = size;
+
+	spsc_ring_reset(ring);
+}
+
+void spsc_ring_reset(struct spsc_ring *ring)
+{
+	atomic_set(&ring->head, 0);
+	atomic_set(&ring->tail, 0);
+}
+
+size_t spsc_ring_used_get(struct spsc_ring *ring)
+{
+	return used_get(ring, atomic_get(&ring->head), atomic_get(&ring->tail));
+}
+
+size_t spsc_ring_space_get(struct spsc_ring *ring)
+{
+	return ring->size - spsc_ring_used_get(ring);
+}
+
+size_t spsc_ring_put_claim(struct spsc_ring *ring, uint8_t **data, size_t size)
+{
+	size_t head = atomic_get(&ring->head);
+	size_t tail = atomic_get(&ring->tail);
+	size_t offset = index_to_offset(ring, head);
+
+	size = MIN(size, ring->size - used_get(ring, head, tail));
+	size = MIN(size, ring->size - offset);
+
+	*data = &ring->buf[offset];
+
+	return size;
+}
+
+void spsc_ring_put_finish(struct spsc_ring *ring, size_t size)
+{
+	size_t head = atomic_get(&ring->head);
+
+	__ASSERT_NO_MSG(size <= spsc_ring_space_get(ring));
+
+	/* Publish the index after the data is written, atomic_set() is a full barrier */
+	atomic_set(&ring->head, index_advance(ring, head, size));
+}
+
+size_t spsc_ring_put(struct spsc_ring *ring, uint8_t const *data, size_t size)
+{
+	size_t written = 0;
+	size_t claimed;
+	uint8_t *claim_ptr;
+
+	/* At most two claims, as the free space can wrap around the end of the buffer once */
+	for (int i = 0; (i < 2) && (written < size); i++) {
+		claimed = spsc_ring_put_claim(ring, &claim_ptr, size - written);
+		if (claimed == 0) {
+			break;
+		}
+
+		memcpy(claim_ptr, &data[written], claimed);
+		spsc_ring_put_finish(ring, claimed);
+		written += claimed;
+	}
+
+	return written;
+}
+
+size_t spsc_ring_get(struct spsc_ring *ring, uint8_t *data, size_t size)
+{
+	size_t head = atomic_get(&ring->head);
+	size_t tail = atomic_get(&ring->tail);
+	size_t offset = index_to_offset(ring, tail);
+	size_t first;
+
+	size = MIN(size, used_get(ring, head, tail));
+	first = MIN(size, ring->size - offset);
+
+	memcpy(data, &ring->buf[offset], first);
+	memcpy(&data[first], ring->buf, size - first);
+
+	/* Release the space after the data is read, atomic_set() is a full barrier */
+	atomic_set(&ring->tail, index_advance(ring, tail, size));
+
+	return size;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file
+ *  @brief Lock-free single-producer, single-consumer byte ring buffer
+ *
+ * One thread may write to the ring while another thread or an ISR reads from it, without any
+ * lock. Each side only updates its own index, and publishes it atomically once the data has
+ * been written or read. Any other concurrent use must be serialized by the caller.
+ */
+
+#ifndef _SPSC_RING_H_
+#define _SPSC_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/atomic.h>
+
+/**
+ * @brief Ring buffer context.
+ *
+ * The indexes run from 0 to twice the size of the ring, so that a full ring can be told apart
+ * from an empty one without wasting a byte of the buffer.
+ */
+struct spsc_ring {
+	/* Buffer holding the data */
+	uint8_t *buf;
+
+	/* Size of the buffer in bytes */
+	size_t size;
+
+	/* Write index, only updated by the producer */
+	atomic_t head;
+
+	/* Read index, only updated by the consumer */
+	atomic_t tail;
+};
+
+/**
+ * @brief	Initialize the ring buffer.
+ *
+ * @param[out]	ring	Pointer to the ring buffer.
+ * @param[in]	buf	Buffer to hold the data.
+ * @param[in]	size	Size of the buffer in bytes.
+ */
+void spsc_ring_init(struct spsc_ring *ring, uint8_t *buf, size_t size);
+
+/**
+ * @brief	Empty the ring buffer.
+ *
+ * @note	Neither the producer nor the consumer can access the ring while it is reset.
+ *
+ * @param[in]	ring	Pointer to the ring buffer.
+ */
+void spsc_ring_reset(struct spsc_ring *ring);
+
+/**
+ * @brief	Get the number of bytes that can be read from the ring buffer.
+ *
+ * @param[in]	ring	Pointer to the ring buffer.
+ *
+ * @return	Number of bytes in the ring buffer.
+ */
+size_t spsc_ring_used_get(struct spsc_ring *ring);
+
+/**
+ * @brief	Get the number of bytes that can be written to the ring buffer.
+ *
+ * @param[in]	ring	Pointer to the ring buffer.
+ *
+ * @return	Number of free bytes in the ring buffer.
+ */
+size_t spsc_ring_space_get(struct spsc_ring *ring);
+
+/**
+ * @brief	Claim contiguous space in the ring buffer for the producer to write into.
+ *
+ * @details	The claimed space can be shorter than requested when the free space is less than
+ *		requested, or wraps around the end of the buffer. The data is not readable by the
+ *		consumer until spsc_ring_put_finish() is called.
+ *
+ * @param[in]	ring	Pointer to the ring buffer.
+ * @param[out]	data	Pointer to the claimed space.
+ * @param[in]	size	Requested number of bytes.
+ *
+ * @return	Number of bytes claimed.
+ */
+size_t spsc_ring_put_claim(struct spsc_ring *ring, uint8_t **data, size_t size);
+
+/**
+ * @brief	Make claimed and written bytes readable by the consumer.
+ *
+ * @param[in]	ring	Pointer to the ring buffer.
+ * @param[in]	size	Number of bytes written, at most the size claimed.
+ */
+void spsc_ring_put_finish(struct spsc_ring *ring, size_t size);
+
+/**
+ * @brief	Copy data into the ring buffer.
+ *
+ * @param[in]	ring	Pointer to the ring buffer.
+ * @param[in]	data	Data to copy.
+ * @param[in]	size	Number of bytes to copy.
+ *
+ * @return	Number of bytes copied, less than size if the ring is full.
+ */
+size_t spsc_ring_put(struct spsc_ring *ring, uint8_t const *data, size_t size);
+
+/**
+ * @brief	Copy data out of the ring buffer.
+ *
+ * @param[in]	ring	Pointer to the ring buffer.
+ * @param[out]	data	Buffer to copy the data into.
+ * @param[in]	size	Number of bytes to copy.
+ *
+ * @return	Number of bytes copied, less than size if the ring holds less data.
+ */
+size_t spsc_ring_get(struct spsc_ring *ring, uint8_t *data, size_t size);
+
+#endif /* _SPSC_RING_H_ */
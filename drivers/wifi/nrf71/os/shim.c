@@ -250,6 +250,142 @@ struct nwb {
 #endif
 };
 
+#ifdef CONFIG_NRF_WIFI_DATA_POOLS
+#ifdef CONFIG_NRF_WIFI_ZERO_COPY_TX
+/* Zero-copy TX only needs a buffer for the headers, keep it with the nwb. */
+#define NWB_INLINE_DATA_SIZE ROUND_UP(NRF_WIFI_EXTRA_TX_HEADROOM, WORD_SIZE)
+#else
+#define NWB_INLINE_DATA_SIZE 0
+#endif /* CONFIG_NRF_WIFI_ZERO_COPY_TX */
+
+struct nwb_block {
+	struct nwb nwb;
+	unsigned char data[NWB_INLINE_DATA_SIZE] __aligned(WORD_SIZE);
+};
+
+#define FRAME_BUF_SIZE ROUND_UP(CONFIG_NRF_WIFI_FRAME_POOL_BUF_SIZE, WORD_SIZE)
+
+#if defined(CONFIG_NOCACHE_MEMORY)
+K_MEM_SLAB_DEFINE_IN_SECT_STATIC(nwb_slab, __nocache, sizeof(struct nwb_block),
+				 CONFIG_NRF_WIFI_NWB_POOL_COUNT, WORD_SIZE);
+K_MEM_SLAB_DEFINE_IN_SECT_STATIC(frame_slab, __nocache, FRAME_BUF_SIZE,
+				 CONFIG_NRF_WIFI_FRAME_POOL_COUNT, WORD_SIZE);
+#else
+K_MEM_SLAB_DEFINE_STATIC(nwb_slab, sizeof(struct nwb_block),
+			 CONFIG_NRF_WIFI_NWB_POOL_COUNT, WORD_SIZE);
+K_MEM_SLAB_DEFINE_STATIC(frame_slab, FRAME_BUF_SIZE,
+			 CONFIG_NRF_WIFI_FRAME_POOL_COUNT, WORD_SIZE);
+#endif /* CONFIG_NOCACHE_MEMORY */
+K_MEM_SLAB_DEFINE_STATIC(llist_node_slab, ROUND_UP(sizeof(struct zep_shim_llist_node), WORD_SIZE),
+			 CONFIG_NRF_WIFI_LLIST_NODE_POOL_COUNT, WORD_SIZE);
+
+struct data_pool {
+	struct k_mem_slab *slab;
+	atomic_t max_used;
+	atomic_t heap_fallbacks;
+};
+
+static struct data_pool data_pools[NRF_WIFI_SHIM_POOL_COUNT] = {
+	[NRF_WIFI_SHIM_POOL_NWB] = { .slab = &nwb_slab },
+	[NRF_WIFI_SHIM_POOL_LLIST_NODE] = { .slab = &llist_node_slab },
+	[NRF_WIFI_SHIM_POOL_FRAME] = { .slab = &frame_slab },
+};
+
+static bool data_pool_owns(struct data_pool *pool, const void *ptr)
+{
+	const char *start = pool->slab->buffer;
+	const char *end = start + (pool->slab->info.num_blocks * pool->slab->info.block_size);
+
+	return ((const char *)ptr >= start) && ((const char *)ptr < end);
+}
+
+/* Blocks are zeroed, like the data heap allocations they replace. */
+static void *data_pool_alloc(enum nrf_wifi_shim_pool id, size_t size)
+{
+	struct data_pool *pool = &data_pools[id];
+	void *block;
+	atomic_val_t used;
+	atomic_val_t max_used;
+
+	if (size <= pool->slab->info.block_size &&
+	    k_mem_slab_alloc(pool->slab, &block, K_NO_WAIT) == 0) {
+		used = k_mem_slab_num_used_get(pool->slab);
+		max_used = atomic_get(&pool->max_used);
+
+		while (used > max_used && !atomic_cas(&pool->max_used, max_used, used)) {
+			max_used = atomic_get(&pool->max_used);
+		}
+
+		memset(block, 0, size);
+
+		return block;
+	}
+
+	atomic_inc(&pool->heap_fallbacks);
+
+	return zep_shim_data_mem_zalloc(size);
+}
+
+static void data_pool_free(enum nrf_wifi_shim_pool id, void *ptr)
+{
+	struct data_pool *pool = &data_pools[id];
+
+	if (data_pool_owns(pool, ptr)) {
+		k_mem_slab_free(pool->slab, ptr);
+	} else {
+		zep_shim_data_mem_free(ptr);
+	}
+}
+
+void nrf_wifi_shim_get_pool_stats(enum nrf_wifi_shim_pool id,
+				  struct nrf_wifi_shim_pool_stats *stats)
+{
+	struct data_pool *pool = &data_pools[id];
+
+	stats->block_size = pool->slab->info.block_size;
+	stats->num_blocks = pool->slab->info.num_blocks;
+	stats->num_used = k_mem_slab_num_used_get(pool->slab);
+	stats->max_used = atomic_get(&pool->max_used);
+	stats->heap_fallbacks = atomic_get(&pool->heap_fallbacks);
+}
+
+static void *zep_shim_nbuf_alloc(unsigned int size)
+{
+	struct nwb *nbuff;
+
+	nbuff = data_pool_alloc(NRF_WIFI_SHIM_POOL_NWB, sizeof(struct nwb_block));
+
+	if (!nbuff) {
+		return NULL;
+	}
+
+	if (size <= NWB_INLINE_DATA_SIZE &&
+	    data_pool_owns(&data_pools[NRF_WIFI_SHIM_POOL_NWB], nbuff)) {
+		nbuff->priv = ((struct nwb_block *)nbuff)->data;
+	} else {
+		nbuff->priv = data_pool_alloc(NRF_WIFI_SHIM_POOL_FRAME, ROUND_UP(size, WORD_SIZE));
+	}
+
+	if (!nbuff->priv) {
+		data_pool_free(NRF_WIFI_SHIM_POOL_NWB, nbuff);
+		return NULL;
+	}
+
+	nbuff->data = (unsigned char *)nbuff->priv;
+	nbuff->tail = nbuff->data;
+
+	return nbuff;
+}
+
+static void nbuf_mem_free(struct nwb *nwb)
+{
+	if (nwb->priv != ((struct nwb_block *)nwb)->data) {
+		data_pool_free(NRF_WIFI_SHIM_POOL_FRAME, nwb->priv);
+	}
+
+	data_pool_free(NRF_WIFI_SHIM_POOL_NWB, nwb);
+}
+#else
 static void *zep_shim_nbuf_alloc(unsigned int size)
 {
 	struct nwb *nbuff;
@@ -276,6 +412,13 @@ static void *zep_shim_nbuf_alloc(unsigned int size)
 	return nbuff;
 }
 
+static void nbuf_mem_free(struct nwb *nwb)
+{
+	zep_shim_data_mem_free(nwb->priv);
+	zep_shim_data_mem_free(nwb);
+}
+#endif /* CONFIG_NRF_WIFI_DATA_POOLS */
+
 static void zep_shim_nbuf_free(void *nbuf)
 {
 	if (!nbuf) {
@@ -288,8 +431,7 @@ static void zep_shim_nbuf_free(void *nbuf)
 	}
 #endif /* CONFIG_NRF_WIFI_ZERO_COPY_TX */
 
-	zep_shim_data_mem_free(((struct nwb *)nbuf)->priv);
-	zep_shim_data_mem_free(nbuf);
+	nbuf_mem_free(nbuf);
 }
 
 static void zep_shim_nbuf_headroom_res(void *nbuf, unsigned int size)
@@ -459,6 +601,31 @@ void *net_pkt_to_nbuf_zc(struct net_pkt *pkt)
 
 	return nbuff;
 }
+
+/* The firmware takes one contiguous buffer per frame. Gather a fragmented
+ * packet into its first buffer, so that it can still be sent without copying
+ * it to a driver buffer. Buffers shared with other packets are left untouched.
+ */
+static bool net_pkt_gather(struct net_pkt *pkt)
+{
+	struct net_buf *buf = pkt->buffer;
+
+	if ((buf->flags & NET_BUF_EXTERNAL_DATA) ||
+	    (net_pkt_get_len(pkt) > net_buf_max_len(buf))) {
+		return false;
+	}
+
+	for (; buf; buf = buf->frags) {
+		if (buf->ref > 1) {
+			return false;
+		}
+	}
+
+	net_pkt_compact(pkt);
+	net_pkt_cursor_init(pkt);
+
+	return !pkt->buffer->frags;
+}
 #endif /* CONFIG_NRF_WIFI_ZERO_COPY_TX */
 
 void *net_pkt_to_nbuf(struct net_pkt *pkt)
@@ -473,7 +640,7 @@ void *net_pkt_to_nbuf(struct net_pkt *pkt)
 
 #ifdef CONFIG_NRF_WIFI_ZERO_COPY_TX
 	/* For zero-copy, check if packet has single buffer */
-	if (pkt->buffer && !pkt->buffer->frags) {
+	if (pkt->buffer && (!pkt->buffer->frags || net_pkt_gather(pkt))) {
 		return net_pkt_to_nbuf_zc(pkt);
 	}
 #endif /* CONFIG_NRF_WIFI_ZERO_COPY_TX */
@@ -498,6 +665,47 @@ void *net_pkt_to_nbuf(struct net_pkt *pkt)
 	return nbuff;
 }
 
+#ifdef CONFIG_NRF_WIFI_ZERO_COPY_RX
+static void rx_zc_buf_destroy(struct net_buf *buf)
+{
+	struct nwb *nwb = *(struct nwb **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+	zep_shim_nbuf_free(nwb);
+}
+
+NET_BUF_POOL_DEFINE(rx_zc_pool, CONFIG_NRF_WIFI_ZERO_COPY_RX_BUF_COUNT, 0,
+		    sizeof(struct nwb *), rx_zc_buf_destroy);
+
+/* Hand the received frame over to the networking stack without copying it.
+ * The nwb is freed once the stack releases the network buffer.
+ */
+static struct net_pkt *net_pkt_from_nbuf_zc(struct net_if *iface, struct nwb *nwb)
+{
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+
+	buf = net_buf_alloc_with_data(&rx_zc_pool, nwb->data, nwb->len, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	pkt = net_pkt_rx_alloc_on_iface(iface, K_NO_WAIT);
+	if (!pkt) {
+		/* Keep the nwb for the copy path. */
+		*(struct nwb **)net_buf_user_data(buf) = NULL;
+		net_buf_unref(buf);
+		return NULL;
+	}
+
+	*(struct nwb **)net_buf_user_data(buf) = nwb;
+	net_pkt_append_buffer(pkt, buf);
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+#endif /* CONFIG_NRF_WIFI_ZERO_COPY_RX */
+
 void *net_pkt_from_nbuf(void *iface, void *frm)
 {
 	struct net_pkt *pkt = NULL;
@@ -509,6 +717,13 @@ void *net_pkt_from_nbuf(void *iface, void *frm)
 		return NULL;
 	}
 
+#ifdef CONFIG_NRF_WIFI_ZERO_COPY_RX
+	pkt = net_pkt_from_nbuf_zc(iface, nwb);
+	if (pkt) {
+		return pkt;
+	}
+#endif /* CONFIG_NRF_WIFI_ZERO_COPY_RX */
+
 	len = zep_shim_nbuf_data_size(nwb);
 
 	data = zep_shim_nbuf_data_get(nwb);
@@ -589,7 +804,11 @@ static void *zep_shim_llist_node_alloc(void)
 {
 	struct zep_shim_llist_node *llist_node = NULL;
 
+#ifdef CONFIG_NRF_WIFI_DATA_POOLS
+	llist_node = data_pool_alloc(NRF_WIFI_SHIM_POOL_LLIST_NODE, sizeof(*llist_node));
+#else
 	llist_node = zep_shim_data_mem_zalloc(sizeof(*llist_node));
+#endif /* CONFIG_NRF_WIFI_DATA_POOLS */
 
 	if (!llist_node) {
 		LOG_ERR("%s: Unable to allocate memory for linked list node", __func__);
@@ -619,7 +838,13 @@ static void *zep_shim_ctrl_llist_node_alloc(void)
 
 static void zep_shim_llist_node_free(void *llist_node)
 {
+#ifdef CONFIG_NRF_WIFI_DATA_POOLS
+	if (llist_node) {
+		data_pool_free(NRF_WIFI_SHIM_POOL_LLIST_NODE, llist_node);
+	}
+#else
 	zep_shim_data_mem_free(llist_node);
+#endif /* CONFIG_NRF_WIFI_DATA_POOLS */
 }
 
 static void zep_shim_ctrl_llist_node_free(void *llist_node)
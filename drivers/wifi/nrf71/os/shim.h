@@ -64,6 +64,33 @@ struct zep_shim_llist {
  */
 void nrf_wifi_shim_get_heaps(struct k_heap **ctrl, struct k_heap **data);
 
+#ifdef CONFIG_NRF_WIFI_DATA_POOLS
+enum nrf_wifi_shim_pool {
+	NRF_WIFI_SHIM_POOL_NWB,
+	NRF_WIFI_SHIM_POOL_LLIST_NODE,
+	NRF_WIFI_SHIM_POOL_FRAME,
+	NRF_WIFI_SHIM_POOL_COUNT,
+};
+
+struct nrf_wifi_shim_pool_stats {
+	size_t block_size;
+	uint32_t num_blocks;
+	uint32_t num_used;
+	uint32_t max_used;
+	/* Allocations served by the data heap because the pool was exhausted or too small. */
+	uint32_t heap_fallbacks;
+};
+
+/**
+ * @brief Get the occupancy statistics of a data path pool.
+ *
+ * @param id Pool to get the statistics of.
+ * @param stats Set to the statistics of the pool.
+ */
+void nrf_wifi_shim_get_pool_stats(enum nrf_wifi_shim_pool id,
+				  struct nrf_wifi_shim_pool_stats *stats);
+#endif /* CONFIG_NRF_WIFI_DATA_POOLS */
+
 void *net_pkt_to_nbuf(struct net_pkt *pkt);
 void *net_pkt_from_nbuf(void *iface, void *frm);
 #if defined(CONFIG_NRF71_RAW_DATA_RX) || defined(CONFIG_NRF71_PROMISC_DATA_RX)
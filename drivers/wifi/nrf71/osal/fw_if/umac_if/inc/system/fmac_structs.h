@@ -303,6 +303,28 @@ enum nrf_wifi_fmac_twt_state {
 #endif /* NRF71_STA_MODE */
 
 #if defined(NRF71_STA_MODE) || defined(NRF71_RAW_DATA_RX) || defined(__DOXYGEN__)
+#if defined(NRF71_TX_FAIR_SCHED) || defined(__DOXYGEN__)
+/**
+ * @brief Structure to hold TX scheduling statistics of a peer for an access category.
+ */
+struct peer_tx_stats {
+	/** Frames added to the pending queue. */
+	unsigned int enqueued;
+	/** Frames dropped because the pending queue was full. */
+	unsigned int dropped;
+	/** Frames passed to the RPU firmware. */
+	unsigned int sent;
+	/** Maximum length of the pending queue. */
+	unsigned int max_qlen;
+	/** TX opportunities given to the peer. */
+	unsigned int opps;
+	/** Sum of the times waited for the TX opportunities, in microseconds. */
+	unsigned long long wait_us_total;
+	/** Maximum time waited for a TX opportunity, in microseconds. */
+	unsigned int wait_us_max;
+};
+#endif /* NRF71_TX_FAIR_SCHED */
+
 /**
  * @brief Structure to hold peer context information.
  *
@@ -330,6 +352,14 @@ struct peers_info {
 	int ps_token_count;
 	/** Port authorized */
 	bool authorized;
+#if defined(NRF71_TX_FAIR_SCHED) || defined(__DOXYGEN__)
+	/** Deficit round robin counters in bytes, per access category. */
+	int deficit[NRF_WIFI_FMAC_AC_MAX];
+	/** Start of the wait for the next TX opportunity, per access category. */
+	unsigned long wait_start_us[NRF_WIFI_FMAC_AC_MAX];
+	/** TX scheduling statistics, per access category. */
+	struct peer_tx_stats tx_stats[NRF_WIFI_FMAC_AC_MAX];
+#endif /* NRF71_TX_FAIR_SCHED */
 };
 
 /**
@@ -196,49 +196,6 @@ static int nrf_wifi_get_tid(void *nwb)
 	return priority;
 }
 
-#ifdef NRF_WIFI_QOS_NOACK_POLICY
-struct check_tid_info {
-	int target_tid;
-	bool tid_match_found;
-};
-
-static enum nrf_wifi_status check_tid_callbk_fn(void *callbk_data,
-						void *nbuf)
-{
-	struct check_tid_info *info = NULL;
-	int tid = 0;
-
-	info = (struct check_tid_info *)callbk_data;
-
-	tid = nrf_wifi_get_tid(nbuf);
-
-	if (tid == info->target_tid) {
-		info->tid_match_found = true;
-	}
-
-	return NRF_WIFI_STATUS_SUCCESS;
-}
-
-static bool has_matching_tid(void *txq, int target_tid)
-{
-	struct check_tid_info info;
-	enum nrf_wifi_status status;
-
-	info.target_tid = target_tid;
-	info.tid_match_found = false;
-
-	status = nrf_wifi_utils_list_traverse(txq,
-					      &info,
-					      check_tid_callbk_fn);
-
-	if (status == NRF_WIFI_STATUS_SUCCESS && info.tid_match_found) {
-		return true;
-	}
-
-	return false;
-}
-#endif /* NRF_WIFI_QOS_NOACK_POLICY */
-
 
 int pending_frames_count(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			 int peer_id)
@@ -462,6 +419,95 @@ static int get_peer_from_wakeup_q(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+#ifdef NRF71_TX_FAIR_SCHED
+/* Peers which are scheduled by deficit round robin, as opposed to the
+ * multicast and raw TX queues.
+ */
+static bool tx_sched_is_drr_peer(int peer_id)
+{
+	return (peer_id >= 0) && (peer_id < MAX_PEERS);
+}
+
+
+static void tx_sched_enqueued(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			      unsigned int ac,
+			      int peer_id,
+			      unsigned int qlen)
+{
+	struct peers_info *peer = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	peer = &sys_dev_ctx->tx_config.peers[peer_id];
+
+	/* The queue starts waiting for a TX opportunity */
+	if (qlen == 1) {
+		peer->wait_start_us[ac] = nrf_wifi_osal_time_get_curr_us();
+	}
+
+	peer->tx_stats[ac].enqueued++;
+
+	if (qlen > peer->tx_stats[ac].max_qlen) {
+		peer->tx_stats[ac].max_qlen = qlen;
+	}
+}
+
+
+/* Charge a TX opportunity to the peer. The peer keeps getting the
+ * opportunities of the access category until its deficit is spent or its
+ * queue is empty, after which the next peer is visited.
+ */
+static void tx_sched_served(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			    unsigned int ac,
+			    int peer_id,
+			    unsigned int num_frames,
+			    unsigned int num_bytes)
+{
+	struct peers_info *peer = NULL;
+	struct peer_tx_stats *stats = NULL;
+	unsigned int wait_us = 0;
+	void *pend_q = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	peer = &sys_dev_ctx->tx_config.peers[peer_id];
+	stats = &peer->tx_stats[ac];
+
+	wait_us = nrf_wifi_osal_time_elapsed_us(peer->wait_start_us[ac]);
+
+	stats->opps++;
+	stats->sent += num_frames;
+	stats->wait_us_total += wait_us;
+
+	if (wait_us > stats->wait_us_max) {
+		stats->wait_us_max = wait_us;
+	}
+
+	peer->wait_start_us[ac] = nrf_wifi_osal_time_get_curr_us();
+
+	if (!tx_sched_is_drr_peer(peer_id)) {
+		return;
+	}
+
+	pend_q = sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
+
+	peer->deficit[ac] -= num_bytes;
+
+	if (nrf_wifi_utils_q_len(pend_q) == 0) {
+		/* An idle peer does not accumulate credit */
+		peer->deficit[ac] = 0;
+	} else if (peer->deficit[ac] > 0) {
+		return;
+	}
+
+	/* Peers served from the wakeup queue do not hold the round robin position */
+	if (sys_dev_ctx->tx_config.curr_peer_opp[ac] == peer_id) {
+		sys_dev_ctx->tx_config.curr_peer_opp[ac] = (peer_id + 1) % MAX_PEERS;
+	}
+}
+#endif /* NRF71_TX_FAIR_SCHED */
+
+
 static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			 unsigned int ac)
 {
@@ -473,6 +519,9 @@ static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	int peer_id = -1;
 	unsigned char ps_state = 0;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+#ifdef NRF71_TX_FAIR_SCHED
+	struct peers_info *peer = NULL;
+#endif /* NRF71_TX_FAIR_SCHED */
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
@@ -501,8 +550,21 @@ static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		pend_q_len = nrf_wifi_utils_q_len(pend_q);
 
 		if (pend_q_len) {
+#ifdef NRF71_TX_FAIR_SCHED
+			peer = &sys_dev_ctx->tx_config.peers[curr_peer_opp];
+
+			/* A new visit of the peer adds a quantum to its deficit,
+			 * the position moves on in tx_sched_served().
+			 */
+			if ((curr_peer_opp != init_peer_opp) || (peer->deficit[ac] <= 0)) {
+				peer->deficit[ac] += NRF71_TX_FAIR_SCHED_QUANTUM;
+			}
+
+			sys_dev_ctx->tx_config.curr_peer_opp[ac] = curr_peer_opp;
+#else
 			sys_dev_ctx->tx_config.curr_peer_opp[ac] =
 				(curr_peer_opp + 1) % MAX_PEERS;
+#endif /* NRF71_TX_FAIR_SCHED */
 			break;
 		}
 	}
@@ -530,6 +592,9 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	int ampdu_len = 0;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+#ifdef NRF71_TX_FAIR_SCHED
+	int txq_bytes = 0;
+#endif /* NRF71_TX_FAIR_SCHED */
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
@@ -581,6 +646,17 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			break;
 		}
 
+#ifdef NRF71_TX_FAIR_SCHED
+		/* Do not aggregate beyond the credit of the peer, peers in
+		 * power save are served by their tokens instead.
+		 */
+		if (tx_sched_is_drr_peer(peer_id) &&
+		    (sys_dev_ctx->tx_config.peers[peer_id].ps_state != NRF_WIFI_CLIENT_PS_MODE) &&
+		    (ampdu_len > sys_dev_ctx->tx_config.peers[peer_id].deficit[ac])) {
+			break;
+		}
+#endif /* NRF71_TX_FAIR_SCHED */
+
 		if (!can_xmit(fmac_dev_ctx, nwb) ||
 			(!tx_aggr_check(fmac_dev_ctx, first_nwb, ac, peer_id)) ||
 			(nrf_wifi_utils_q_len(txq) >= max_txq_len)) {
@@ -588,6 +664,9 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		}
 
 		nwb = nrf_wifi_utils_q_dequeue(pend_pkt_q);
+#ifdef NRF71_TX_FAIR_SCHED
+		txq_bytes = ampdu_len;
+#endif /* NRF71_TX_FAIR_SCHED */
 
 		nrf_wifi_utils_list_add_tail(txq,
 					     nwb);
@@ -604,6 +683,9 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		}
 
 		nwb = nrf_wifi_utils_q_dequeue(pend_pkt_q);
+#ifdef NRF71_TX_FAIR_SCHED
+		txq_bytes = TX_BUF_HEADROOM + nrf_wifi_osal_nbuf_data_size(nwb);
+#endif /* NRF71_TX_FAIR_SCHED */
 
 		nrf_wifi_utils_list_add_tail(txq,
 					     nwb);
@@ -613,6 +695,11 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 	if (len > 0) {
 		sys_dev_ctx->tx_config.pkt_info_p[desc].peer_id = peer_id;
+#ifdef NRF71_TX_FAIR_SCHED
+		if (peer_id >= 0) {
+			tx_sched_served(fmac_dev_ctx, ac, peer_id, len, txq_bytes);
+		}
+#endif /* NRF71_TX_FAIR_SCHED */
 	}
 
 	update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
@@ -683,6 +770,9 @@ static enum nrf_wifi_status tx_cmd_prep_callbk_fn(void *callbk_data,
 	if (!nrf_wifi_osal_nbuf_get_chksum_done(nbuf)) {
 		config->csum_bitmap |= (1u << frame_indx);
 	}
+#ifdef NRF_WIFI_QOS_NOACK_POLICY
+	info->tid_map |= (1 << nrf_wifi_get_tid(nbuf));
+#endif /* NRF_WIFI_QOS_NOACK_POLICY */
 	config->num_tx_pkts++;
 
 	status = NRF_WIFI_STATUS_SUCCESS;
@@ -840,16 +930,13 @@ static enum nrf_wifi_status tx_cmd_prepare(struct nrf_wifi_fmac_dev_ctx *fmac_de
 
 	config->csum_bitmap = 0;
 
-#ifdef NRF_WIFI_QOS_NOACK_POLICY
-	if (has_matching_tid(txq, NRF_WIFI_QOS_NOACK_POLICY_TID)) {
-		config->mac_hdr_info.tx_flags |= NRF_WIFI_TX_FLAG_QOS_CTL_ACK_POLICY_NOACK;
-	}
-#endif /* NRF_WIFI_QOS_NOACK_POLICY */
-
 	config->num_tx_pkts = 0;
 
 	info.fmac_dev_ctx = fmac_dev_ctx;
 	info.config = config;
+#ifdef NRF_WIFI_QOS_NOACK_POLICY
+	info.tid_map = 0;
+#endif /* NRF_WIFI_QOS_NOACK_POLICY */
 
 	status = nrf_wifi_utils_list_traverse(txq,
 					      &info,
@@ -861,6 +948,13 @@ static enum nrf_wifi_status tx_cmd_prepare(struct nrf_wifi_fmac_dev_ctx *fmac_de
 		goto err;
 	}
 
+#ifdef NRF_WIFI_QOS_NOACK_POLICY
+	/* The TIDs are collected while filling in the frames above */
+	if (info.tid_map & (1 << NRF_WIFI_QOS_NOACK_POLICY_TID)) {
+		config->mac_hdr_info.tx_flags |= NRF_WIFI_TX_FLAG_QOS_CTL_ACK_POLICY_NOACK;
+	}
+#endif /* NRF_WIFI_QOS_NOACK_POLICY */
+
 	sys_dev_ctx->host_stats.total_tx_pkts += config->num_tx_pkts;
 	config->wdev_id = sys_dev_ctx->tx_config.peers[peer_id].if_idx;
 
@@ -1051,6 +1145,9 @@ static enum nrf_wifi_status tx_enqueue(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ct
 	qlen = nrf_wifi_utils_q_len(queue);
 
 	if (qlen >= NRF71_MAX_TX_PENDING_QLEN) {
+#ifdef NRF71_TX_FAIR_SCHED
+		sys_dev_ctx->tx_config.peers[peer_id].tx_stats[ac].dropped++;
+#endif /* NRF71_TX_FAIR_SCHED */
 		goto out;
 	}
 
@@ -1062,6 +1159,10 @@ static enum nrf_wifi_status tx_enqueue(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ct
 					 nwb);
 	}
 
+#ifdef NRF71_TX_FAIR_SCHED
+	tx_sched_enqueued(fmac_dev_ctx, ac, peer_id, qlen + 1);
+#endif /* NRF71_TX_FAIR_SCHED */
+
 	status = update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
 
 out:
@@ -11,6 +11,7 @@
 #include <zephyr/shell/shell.h>
 #include <nrf71_wifi_ctrl.h>
 #include "fmac_main.h"
+#include "shim.h"
 
 extern struct nrf_wifi_drv_priv_zep rpu_drv_priv_zep;
 struct nrf_wifi_ctx_zep *dbg_ctx = &rpu_drv_priv_zep.rpu_ctx_zep;
@@ -302,6 +303,35 @@ static int nrf_wifi_dbg_write_reg(const struct shell *sh,
 	return 0;
 }
 
+#ifdef CONFIG_NRF_WIFI_DATA_POOLS
+static int nrf_wifi_dbg_pools(const struct shell *sh,
+			      size_t argc,
+			      const char *argv[])
+{
+	static const char * const pool_names[] = {
+		[NRF_WIFI_SHIM_POOL_NWB] = "Network buffer headers",
+		[NRF_WIFI_SHIM_POOL_LLIST_NODE] = "Queue nodes",
+		[NRF_WIFI_SHIM_POOL_FRAME] = "Frame buffers",
+	};
+	struct nrf_wifi_shim_pool_stats stats;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	for (int i = 0; i < NRF_WIFI_SHIM_POOL_COUNT; i++) {
+		nrf_wifi_shim_get_pool_stats(i, &stats);
+
+		shell_fprintf(sh, SHELL_INFO, "%s (%zu bytes each):\n", pool_names[i],
+			      stats.block_size);
+		shell_fprintf(sh, SHELL_INFO, "  used:           %u/%u\n", stats.num_used,
+			      stats.num_blocks);
+		shell_fprintf(sh, SHELL_INFO, "  max. used:      %u\n", stats.max_used);
+		shell_fprintf(sh, SHELL_INFO, "  heap fallbacks: %u\n", stats.heap_fallbacks);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NRF_WIFI_DATA_POOLS */
 
 
 SHELL_STATIC_SUBCMD_SET_CREATE(
@@ -354,6 +384,13 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      nrf_wifi_dbg_write_reg,
 		      4,
 		      0),
+	SHELL_COND_CMD_ARG(CONFIG_NRF_WIFI_DATA_POOLS,
+			   pools,
+			   NULL,
+			   "Show occupancy of the data path pools and heap fallbacks\n",
+			   nrf_wifi_dbg_pools,
+			   1,
+			   0),
 	SHELL_SUBCMD_SET_END
 );
 
@@ -328,6 +328,73 @@ unlock:
 }
 #endif /* CONFIG_NRF71_STA_MODE */
 
+#ifdef CONFIG_NRF71_TX_FAIR_SCHED
+static int nrf_wifi_util_peer_tx_stats(const struct shell *sh,
+				       size_t argc,
+				       const char *argv[])
+{
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct peers_info *peer = NULL;
+	struct peer_tx_stats *stats = NULL;
+	void *queue = NULL;
+	int ret;
+
+	k_mutex_lock(&ctx->rpu_lock, K_FOREVER);
+	if (!ctx->rpu_ctx) {
+		shell_fprintf(sh,
+			      SHELL_ERROR,
+			      "RPU context not initialized\n");
+		ret = -ENOEXEC;
+		goto unlock;
+	}
+
+	fmac_dev_ctx = ctx->rpu_ctx;
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	for (int peer_index = 0; peer_index < MAX_PEERS; peer_index++) {
+		peer = &sys_dev_ctx->tx_config.peers[peer_index];
+
+		if (peer->peer_id == -1) {
+			continue;
+		}
+
+		shell_fprintf(sh,
+			      SHELL_INFO,
+			      "************* Peer(%d) %02x:%02x:%02x:%02x:%02x:%02x *************\n",
+			      peer_index,
+			      peer->ra_addr[0], peer->ra_addr[1], peer->ra_addr[2],
+			      peer->ra_addr[3], peer->ra_addr[4], peer->ra_addr[5]);
+
+		for (int i = 0; i < NRF_WIFI_FMAC_AC_MC; i++) {
+			stats = &peer->tx_stats[i];
+			queue = sys_dev_ctx->tx_config.data_pending_txq[peer_index][i];
+
+			shell_fprintf(sh,
+				      SHELL_INFO,
+				      "ac: %d qlen: %u max_qlen: %u enqueued: %u dropped: %u sent: %u\n"
+				      "       opps: %u avg_wait_us: %llu max_wait_us: %u deficit: %d\n",
+				      i,
+				      nrf_wifi_utils_q_len(queue),
+				      stats->max_qlen,
+				      stats->enqueued,
+				      stats->dropped,
+				      stats->sent,
+				      stats->opps,
+				      stats->opps ? (stats->wait_us_total / stats->opps) : 0,
+				      stats->wait_us_max,
+				      peer->deficit[i]);
+		}
+	}
+
+	ret = 0;
+
+unlock:
+	k_mutex_unlock(&ctx->rpu_lock);
+	return ret;
+}
+#endif /* CONFIG_NRF71_TX_FAIR_SCHED */
+
 
 static int nrf_wifi_util_tx_rate(const struct shell *sh,
 				 size_t argc,
@@ -1345,6 +1412,14 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      2,
 		      0),
 #endif /* CONFIG_NRF71_STA_MODE */
+#ifdef CONFIG_NRF71_TX_FAIR_SCHED
+	SHELL_CMD_ARG(peer_tx_stats,
+		      NULL,
+		      "Displays per peer TX queue and scheduling latency statistics\n",
+		      nrf_wifi_util_peer_tx_stats,
+		      1,
+		      0),
+#endif /* CONFIG_NRF71_TX_FAIR_SCHED */
 	SHELL_CMD_ARG(tx_rate,
 		      NULL,
 		      "Sets TX data rate to either a fixed value or AUTO\n"
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#ifndef _AUDIO_MODULE_FILE_H_
+#define _AUDIO_MODULE_FILE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include "audio_defines.h"
+#include "audio_module.h"
+
+/**
+ * @brief Private pointer to the file source module's parameters.
+ *
+ * @note The file source is an input module. It reads one frame of PCM data from a raw PCM or
+ *       WAV file each time its thread runs the data process function.
+ */
+extern struct audio_module_description *audio_module_file_source_description;
+
+/**
+ * @brief Private pointer to the file sink module's parameters.
+ *
+ * @note The file sink is an output module. It writes each audio data item it receives to a
+ *       raw PCM or WAV file.
+ */
+extern struct audio_module_description *audio_module_file_sink_description;
+
+/**
+ * @brief The module configuration structure.
+ *
+ */
+struct audio_module_file_configuration {
+	/* Path of the file to read from or write to. */
+	const char *path;
+
+	/* The sample rate of the PCM data. For a WAV source, it is taken from the file header. */
+	uint32_t sample_rate_hz;
+
+	/* The bit depth of the PCM data. For a WAV source, it is taken from the file header. */
+	uint8_t bits_per_sample;
+
+	/* Number of interleaved channels. For a WAV source, it is taken from the file header. */
+	uint8_t channels;
+
+	/* Duration of one frame of audio data. */
+	uint32_t frame_duration_us;
+
+	/* True if the file has a WAV header, false if it is raw PCM. */
+	bool wav;
+
+	/* Optional semaphore to pace the modules, can be NULL.
+	 * The source takes the semaphore before it reads each frame, and the sink gives the
+	 * semaphore after it has written each frame.
+	 */
+	struct k_sem *frame_sem;
+};
+
+/**
+ * @brief  Private module context.
+ *
+ */
+struct audio_module_file_context {
+	/* The open file. */
+	struct fs_file_t file;
+
+	/* The file configuration. */
+	struct audio_module_file_configuration config;
+
+	/* Metadata of the audio data read from the file. */
+	struct audio_metadata meta;
+
+	/* Size of one frame of audio data in bytes. */
+	size_t frame_bytes;
+
+	/* Number of PCM bytes left to read from the file. */
+	uint32_t data_left;
+
+	/* Number of frames read or written. */
+	uint32_t frames;
+
+	/* Number of PCM bytes read or written, excluding the WAV header. */
+	uint32_t bytes;
+
+	/* CRC-32 (IEEE) of the PCM bytes read or written, to check the data bit exactly. */
+	uint32_t crc;
+
+	/* True once the source has read the whole file. */
+	bool eof;
+};
+
+#endif /* _AUDIO_MODULE_FILE_H_ */
@@ -248,7 +248,9 @@ struct audio_module_description {
  * @brief Module's thread configuration structure.
  */
 struct audio_module_thread_configuration {
-	/* Thread stack. */
+	/* Thread stack. With CONFIG_AUDIO_MODULE_GRAPH, the stack can be NULL and its size 0,
+	 * then the module has no thread and it is run by a graph executor.
+	 */
 	k_thread_stack_t *stack;
 
 	/* Thread stack size. */
@@ -283,6 +285,11 @@ struct audio_module_parameters {
 	struct audio_module_thread_configuration thread;
 };
 
+/**
+ * @brief Graph of modules run by a single executor thread.
+ */
+struct audio_module_graph;
+
 /**
  * @brief Private module handle.
  */
@@ -325,7 +332,40 @@ struct audio_module_handle {
 
 	/* Private context for the module. */
 	struct audio_module_context *context;
+
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+	/* The graph that runs the module, NULL if the module is not part of a graph. */
+	struct audio_module_graph *graph;
+#endif /* defined(CONFIG_AUDIO_MODULE_GRAPH) */
+};
+
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+/**
+ * @brief Graph of modules run by a single executor thread.
+ */
+struct audio_module_graph {
+	/* The modules in topological order, the first module is the head of the graph. */
+	struct audio_module_handle *modules[CONFIG_AUDIO_MODULE_GRAPH_MODULES_NUM];
+
+	/* Index of the module that feeds each module, unused for the head. */
+	uint8_t upstream[CONFIG_AUDIO_MODULE_GRAPH_MODULES_NUM];
+
+	/* Output audio data of each module for the frame being run. */
+	struct audio_data outputs[CONFIG_AUDIO_MODULE_GRAPH_MODULES_NUM];
+
+	/* Flags to indicate which modules have output audio data for the frame being run. */
+	bool output_valid[CONFIG_AUDIO_MODULE_GRAPH_MODULES_NUM];
+
+	/* Number of modules in the graph. */
+	uint8_t modules_num;
+
+	/* Executor thread ID. */
+	k_tid_t thread_id;
+
+	/* Executor thread data. */
+	struct k_thread thread_data;
 };
+#endif /* defined(CONFIG_AUDIO_MODULE_GRAPH) */
 
 /**
  * @brief Private structure describing a data_in message into the module thread.
@@ -537,6 +577,43 @@ int audio_module_state_get(struct audio_module_handle const *const handle,
  */
 int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_channels);
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+/**
+ * @brief Create a graph from the modules connected to the head module and start its executor.
+ *
+ * @note The executor thread runs the modules in topological order, calling the data_process
+ *       function of each module directly, with no FIFO between the modules. An input head
+ *       module is run in a loop, as in its own thread. Otherwise the executor waits for audio
+ *       data on the RX FIFO of the head module. Output audio data of modules connected with
+ *       the connect_external flag is put on their TX FIFO.
+ *
+ * @note All modules in the graph must be opened without a thread, and each module except the
+ *       head must be fed by exactly one module. The connections between the modules cannot be
+ *       changed while the graph exists.
+ *
+ * @param graph       [out]  Pointer to the graph.
+ * @param head        [in]   The handle of the first module in the graph.
+ * @param stack       [in]   Executor thread stack.
+ * @param stack_size  [in]   Executor thread stack size.
+ * @param priority    [in]   Executor thread priority.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_create(struct audio_module_graph *graph, struct audio_module_handle *head,
+			      k_thread_stack_t *stack, size_t stack_size, int priority);
+
+/**
+ * @brief Stop the executor of a graph and release its modules.
+ *
+ * @note The modules in the graph should be stopped before the graph is destroyed.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_destroy(struct audio_module_graph *graph);
+#endif /* defined(CONFIG_AUDIO_MODULE_GRAPH) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -107,6 +107,26 @@ int get_monotonic_slot(counter_t *slot_out);
  */
 void bl_validate_housekeeping(void);
 
+#ifdef CONFIG_SB_VALIDATION_CACHE
+/** Size of the validated image cache at the end of the bootloader partition. */
+#define BL_VALIDATION_CACHE_SIZE CONFIG_SB_VALIDATION_CACHE_SIZE
+
+/** Check for an indication that the booted image may have been tampered with.
+ *
+ * @details Called by the bootloader before an image is booted using the
+ *          validated image cache. If it returns true, the image is fully
+ *          validated instead. The default implementation always returns false
+ *          and can be overridden, for example to use a tamper detection
+ *          peripheral.
+ *
+ * @retval true   Tampering was detected.
+ * @retval false  No tampering was detected.
+ */
+bool bl_validation_cache_tamper_detected(void);
+#else
+#define BL_VALIDATION_CACHE_SIZE 0
+#endif
+
   /** @} */
 
 #ifdef __cplusplus
@@ -58,6 +58,33 @@ int bt_rpc_gatt_subscribe_flag_clear(struct bt_gatt_subscribe_params *params, ui
  */
 int bt_rpc_gatt_subscribe_flag_get(struct bt_gatt_subscribe_params *params, uint32_t flags_bit);
 
+/** @brief Send the queued notifications to the host.
+ *
+ * Available with @kconfig{CONFIG_BT_RPC_GATT_NOTIFY_BATCH}.
+ *
+ * @return 0 in case of success or the first error reported by the host for the queued
+ * notifications.
+ */
+int bt_rpc_gatt_notify_flush(void);
+
+/** @brief Get the notification batching statistics.
+ *
+ * Available with @kconfig{CONFIG_BT_RPC_GATT_NOTIFY_BATCH}.
+ *
+ * @param[out] notifications Number of notifications queued since boot.
+ * @param[out] batches       Number of RPC commands used to send them.
+ */
+void bt_rpc_gatt_notify_batch_stats(uint32_t *notifications, uint32_t *batches);
+
+/** @brief Get the number of connection information requests served by the client cache.
+ *
+ * Each hit is an RPC command that was not sent to the host.
+ * Available with @kconfig{CONFIG_BT_RPC_CONN_INFO_CACHE}.
+ *
+ * @return Number of cache hits since boot.
+ */
+uint32_t bt_rpc_conn_info_cache_hits(void);
+
 #ifdef __cplusplus
 }
 #endif
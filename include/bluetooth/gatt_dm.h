@@ -332,6 +332,30 @@ static inline void bt_gatt_dm_data_print(const struct bt_gatt_dm *dm)
 }
 #endif
 
+/** @brief Discovery cache statistics. */
+struct bt_gatt_dm_cache_stats {
+	/** Number of discoveries served from the cache. */
+	uint32_t hits;
+	/** Number of discoveries of bonded peers that were done with the peer. */
+	uint32_t misses;
+};
+
+/** @brief Get discovery cache statistics.
+ *
+ * The discovery of a bonded peer is served from the cache if the Database
+ * Hash of the peer matches the one read when the results were cached.
+ *
+ * @param[out] stats Discovery cache statistics.
+ */
+#ifdef CONFIG_BT_GATT_DM_CACHE
+void bt_gatt_dm_cache_stats_get(struct bt_gatt_dm_cache_stats *stats);
+#else
+static inline void bt_gatt_dm_cache_stats_get(struct bt_gatt_dm_cache_stats *stats)
+{
+	*stats = (struct bt_gatt_dm_cache_stats){0};
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
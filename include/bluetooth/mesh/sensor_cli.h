@@ -678,6 +678,34 @@ int bt_mesh_sensor_cli_all_get(struct bt_mesh_sensor_cli *cli,
 			       struct bt_mesh_sensor_data *sensors,
 			       uint32_t *count);
 
+/** @brief Decode all sensor values in a Sensor Status message.
+ *
+ *  Decodes every Marshalled Sensor Data field in the payload of a Sensor
+ *  Status message in a single pass, writing the values straight into the
+ *  @c sensors array. Sensors that report no data and sensors of unknown types
+ *  are skipped.
+ *
+ *  This is useful for gateways that receive Sensor Status messages from many
+ *  nodes, for instance by subscribing to the messages directly, and need the
+ *  decoded values as an array.
+ *
+ *  @param[in,out] buf    Sensor Status message payload, without the opcode.
+ *                        The payload is consumed by the call.
+ *  @param[out] sensors   Array of sensor data to fill.
+ *  @param[in,out] count  The number of elements in the @c sensors array.
+ *                        Will be changed to reflect the number of decoded
+ *                        sensors.
+ *
+ *  @retval 0         Successfully decoded all sensor values.
+ *  @retval -EMSGSIZE The message contains an invalid length field, or ended
+ *                    in the middle of a sensor value.
+ *  @retval -ENOBUFS  The message contained more sensor values than would fit
+ *                    in the @c sensors array. The array has been filled.
+ */
+int bt_mesh_sensor_status_decode(struct net_buf_simple *buf,
+				 struct bt_mesh_sensor_data *sensors,
+				 uint32_t *count);
+
 /** @cond INTERNAL_HIDDEN */
 extern const struct bt_mesh_model_op _bt_mesh_sensor_cli_op[];
 extern const struct bt_mesh_model_cb _bt_mesh_sensor_cli_cb;
@@ -33,7 +33,10 @@
  *    writers have been registered will be ignored.
  * 3. Pass subsequent downloaded chunks of the package to @c dfu_multi_image_write
  *    function. The chunks must be provided in order. Note that if the function returns
- *    an error, no more chunks shall be provided.
+ *    an error, no more chunks shall be provided. If @c CONFIG_DFU_MULTI_IMAGE_PIPELINE
+ *    is enabled, the image writers are called from a dedicated work queue and their
+ *    errors are returned by the subsequent @c dfu_multi_image_write or
+ *    @c dfu_multi_image_done call.
  * 4. Call @c dfu_multi_image_done function to release open resources and verify that all
  *    data declared in the header have been written properly.
  *
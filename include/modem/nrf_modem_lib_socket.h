@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_MODEM_LIB_SOCKET_H__
+#define NRF_MODEM_LIB_SOCKET_H__
+
+#include <zephyr/net/net_ip.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file nrf_modem_lib_socket.h
+ *
+ * @defgroup nrf_modem_lib_socket nRF91 socket offloading extensions
+ * @{
+ */
+
+/** @brief Message header for the batch send and receive functions. */
+struct nrf_modem_lib_mmsghdr {
+	/** Message to send, or buffers to receive the message into. */
+	struct net_msghdr msg_hdr;
+	/** Number of bytes sent or received for the message. */
+	unsigned int msg_len;
+};
+
+/**
+ * @brief Send multiple messages on a socket.
+ *
+ * Each message is sent as with @c zsock_sendmsg(), and @c msg_len of the message is set to
+ * the number of bytes sent. The socket is looked up and locked once for the whole batch.
+ *
+ * @param fd Socket descriptor.
+ * @param msgvec Messages to send.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Send flags, applied to all messages.
+ *
+ * @return Number of messages sent. If a message fails after at least one message is sent,
+ *	   the number of messages sent so far is returned and @c errno is set.
+ *	   On failure of the first message, -1 is returned and @c errno is set.
+ */
+int nrf_modem_lib_sendmmsg(int fd, struct nrf_modem_lib_mmsghdr *msgvec, unsigned int vlen,
+			   int flags);
+
+/**
+ * @brief Receive multiple messages from a socket.
+ *
+ * The function waits for the first message according to @p flags. The following messages
+ * are only received if they are already available, so the function returns as soon as
+ * there are no more messages to receive. @c msg_len of each message is set to the number of
+ * bytes received.
+ *
+ * @param fd Socket descriptor.
+ * @param msgvec Buffers to receive the messages into.
+ * @param vlen Number of messages in @p msgvec.
+ * @param flags Receive flags, applied to all messages.
+ *
+ * @return Number of messages received. On failure of the first message, -1 is returned
+ *	   and @c errno is set.
+ */
+int nrf_modem_lib_recvmmsg(int fd, struct nrf_modem_lib_mmsghdr *msgvec, unsigned int vlen,
+			   int flags);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_MODEM_LIB_SOCKET_H__ */
@@ -64,6 +64,20 @@ typedef void (*mqtt_helper_on_connack_t)(enum mqtt_conn_return_code return_code,
 typedef void (*mqtt_helper_on_disconnect_t)(int result);
 typedef void (*mqtt_helper_on_publish_t)(struct mqtt_helper_buf topic_buf,
 					 struct mqtt_helper_buf payload_buf);
+
+/** @brief Handler invoked for each chunk of an incoming MQTT PUBLISH payload.
+ *	   The chunks are delivered in order, and each chunk is at most
+ *	   CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN bytes long. A message with an empty payload is
+ *	   delivered as a single chunk of size 0.
+ *
+ *  @param topic_buf Topic of the message.
+ *  @param chunk_buf Payload data of the chunk. The buffer is reused for the next chunk.
+ *  @param offset Offset of the chunk within the payload.
+ *  @param total_len Total length of the payload.
+ */
+typedef void (*mqtt_helper_on_publish_chunk_t)(struct mqtt_helper_buf topic_buf,
+					       struct mqtt_helper_buf chunk_buf,
+					       size_t offset, size_t total_len);
 typedef void (*mqtt_helper_on_puback_t)(uint16_t message_id, int result);
 typedef void (*mqtt_helper_on_suback_t)(uint16_t message_id, int result);
 typedef void (*mqtt_helper_on_pingresp_t)(void);
@@ -75,6 +89,11 @@ struct mqtt_helper_cfg {
 		mqtt_helper_on_connack_t on_connack;
 		mqtt_helper_on_disconnect_t on_disconnect;
 		mqtt_helper_on_publish_t on_publish;
+		/** If set, incoming payloads are delivered in chunks through this handler
+		 *  instead of @c on_publish, so payloads larger than the payload buffer
+		 *  can be received.
+		 */
+		mqtt_helper_on_publish_chunk_t on_publish_chunk;
 		mqtt_helper_on_puback_t on_puback;
 		mqtt_helper_on_suback_t on_suback;
 		mqtt_helper_on_pingresp_t on_pingresp;
@@ -87,6 +106,32 @@ struct mqtt_helper_cfg {
 #endif
 };
 
+/** @brief Statistics of the store-and-forward publish queue. */
+struct mqtt_helper_queue_stats {
+	/** Number of messages in the queue, including messages waiting for PUBACK. */
+	size_t depth;
+
+	/** Age of the oldest message in the queue in milliseconds, 0 if the queue is empty.
+	 *  For messages restored after a reboot, the age is counted from the restoration.
+	 */
+	int64_t oldest_age_ms;
+
+	/** Number of messages added to the queue. */
+	uint32_t queued;
+
+	/** Number of queued messages replaced by a newer message on the same topic. */
+	uint32_t coalesced;
+
+	/** Number of messages dropped because the queue was full or the message was corrupted. */
+	uint32_t dropped;
+
+	/** Number of queued messages acknowledged by the broker. */
+	uint32_t drained;
+
+	/** Drain rate of the last completed burst, in messages per second. */
+	uint32_t drain_rate;
+};
+
 struct mqtt_helper_conn_params {
 	/* The hostname must be null-terminated. */
 	struct mqtt_helper_buf hostname;
@@ -136,13 +181,30 @@ int mqtt_helper_disconnect(void);
 int mqtt_helper_subscribe(struct mqtt_subscription_list *sub_list);
 
 /** @brief Publish an MQTT message.
+ *
+ *  If CONFIG_MQTT_HELPER_QUEUE is enabled, QoS 1 messages that are published while the client
+ *  is not connected, or while older messages are queued, are added to the store-and-forward
+ *  queue. Queued messages are published in bursts after the connection is established and
+ *  are removed from the queue when acknowledged by the broker. A queued message is published
+ *  with the message ID given in @p param, also when it is published again after reconnecting,
+ *  and its PUBACK is passed to the @c on_puback handler.
  *
  *  @retval 0 if successful.
  *  @retval -EOPNOTSUPP if operation is not supported in the current state.
+ *  @retval -ENOMEM if the message could not be queued because the queue is full.
+ *  @retval -EMSGSIZE if the message is too large to be queued.
  *  @return Otherwise a negative error code.
  */
 int mqtt_helper_publish(const struct mqtt_publish_param *param);
 
+#if defined(CONFIG_MQTT_HELPER_QUEUE)
+/** @brief Get the statistics of the store-and-forward publish queue.
+ *
+ *  @param[out] stats Pointer to the structure to be filled with the statistics.
+ */
+void mqtt_helper_queue_stats_get(struct mqtt_helper_queue_stats *stats);
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE) */
+
 /** @brief Get a message ID.
  *
  *  @note Will not return 0 as it is reserved for invalid message IDs, see MQTT specification.
@@ -33,6 +33,18 @@ extern "C" {
  */
 otError ot_rpc_set_factory_assigned_ieee_eui64(const otExtAddress * eui64);
 
+/** @brief Get the number of message API commands issued to the remote device.
+ *
+ * The function returns the number of nRF RPC commands, each being a blocking round trip
+ * to the remote device, that have been issued by the message and UDP send API functions,
+ * such as @c otMessageAppend and @c otUdpSend, since the system start.
+ * The count does not include the operations served locally from the message staging
+ * buffer, see @kconfig{CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING}.
+ *
+ * @return Number of issued commands.
+ */
+uint32_t ot_rpc_get_message_round_trips(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NFC_NDEF_MSG_VIEW_H_
+#define NFC_NDEF_MSG_VIEW_H_
+
+/**
+ * @file
+ * @defgroup nfc_ndef_msg_view NDEF message view
+ * @{
+ *
+ * @brief Read-only, in-place access to the records of a raw NDEF message.
+ *
+ * Unlike @ref nfc_ndef_msg_parse, the view does not require a result buffer
+ * for the record descriptors. The records are iterated one by one directly
+ * over the raw message and the returned record views point to the raw
+ * message data, so the data must remain valid while the views are used.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/types.h>
+#include <nfc/ndef/record.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief View of a single NDEF record. */
+struct nfc_ndef_rec_view {
+	/** Value of the Type Name Format (TNF) field. */
+	enum nfc_ndef_record_tnf tnf;
+	/** Location of the record within the NDEF message. */
+	enum nfc_ndef_record_location location;
+	/** Length of the type field. */
+	uint8_t type_length;
+	/** Length of the ID field. */
+	uint8_t id_length;
+	/** Pointer to the type field data. NULL if type_length is 0. */
+	const uint8_t *type;
+	/** Pointer to the ID field data. NULL if id_length is 0. */
+	const uint8_t *id;
+	/** Pointer to the payload data. NULL if payload_length is 0. */
+	const uint8_t *payload;
+	/** Length of the payload. */
+	uint32_t payload_length;
+};
+
+/** @brief View of an NDEF message.
+ *
+ *  The members are internal, use the API functions to access the message.
+ */
+struct nfc_ndef_msg_view {
+	/** Pointer to the raw message data. */
+	const uint8_t *data;
+	/** Size of the raw message data. */
+	uint32_t len;
+	/** Offset of the next record. */
+	uint32_t offset;
+	/** Number of records iterated so far. */
+	uint32_t record_count;
+	/** The last record of the message has been reached. */
+	bool end;
+};
+
+/** @brief Parse a single NDEF record in place.
+ *
+ *  @param[out] rec Pointer to the record view to be filled.
+ *  @param[in] data Pointer to the raw record data.
+ *  @param[in,out] len As input: size of the data in the @p data buffer.
+ *                     As output: size of the parsed record.
+ *
+ *  @retval 0 If the operation was successful.
+ *  @retval -EINVAL If the record does not fit in the data buffer.
+ */
+int nfc_ndef_rec_view_parse(struct nfc_ndef_rec_view *rec, const uint8_t *data, uint32_t *len);
+
+/** @brief Check the type of an NDEF record.
+ *
+ *  @param[in] rec Pointer to the record view.
+ *  @param[in] tnf Expected Type Name Format of the record.
+ *  @param[in] type Pointer to the expected type.
+ *  @param[in] type_length Length of the expected type.
+ *
+ *  @retval true If the record is of the given type.
+ *  @retval false Otherwise.
+ */
+bool nfc_ndef_rec_view_type_check(const struct nfc_ndef_rec_view *rec,
+				  enum nfc_ndef_record_tnf tnf, const uint8_t *type,
+				  uint8_t type_length);
+
+/** @brief Initialize a view of an NDEF message.
+ *
+ *  @param[out] msg Pointer to the message view.
+ *  @param[in] data Pointer to the raw message data.
+ *  @param[in] len Size of the raw message data.
+ */
+void nfc_ndef_msg_view_init(struct nfc_ndef_msg_view *msg, const uint8_t *data, uint32_t len);
+
+/** @brief Initialize a view of an NDEF message nested in the payload of a record.
+ *
+ *  For example, the local records of a Connection Handover record are
+ *  encoded as an NDEF message following the one-byte version field of its
+ *  payload.
+ *
+ *  @param[out] msg Pointer to the message view.
+ *  @param[in] rec Pointer to the view of the record with the nested message.
+ *  @param[in] offset Offset of the nested message within the record payload.
+ *
+ *  @retval 0 If the operation was successful.
+ *  @retval -EINVAL If the offset is outside of the record payload.
+ */
+int nfc_ndef_msg_view_nested_init(struct nfc_ndef_msg_view *msg,
+				  const struct nfc_ndef_rec_view *rec, uint32_t offset);
+
+/** @brief Get the next record of an NDEF message.
+ *
+ *  The record location flags are verified, so that the first record begins
+ *  the message and the iteration stops at the record that ends the message.
+ *
+ *  @param[in,out] msg Pointer to the message view.
+ *  @param[out] rec Pointer to the record view to be filled.
+ *
+ *  @retval 0 If the next record was found.
+ *  @retval -ENOENT If all records of the message have been iterated.
+ *  @retval -EINVAL If the record does not fit in the message data.
+ *  @retval -EFAULT If the record location flags are invalid.
+ */
+int nfc_ndef_msg_view_next(struct nfc_ndef_msg_view *msg, struct nfc_ndef_rec_view *rec);
+
+/** @brief Get the number of records iterated so far.
+ *
+ *  @param[in] msg Pointer to the message view.
+ *
+ *  @return Number of records.
+ */
+static inline uint32_t nfc_ndef_msg_view_record_count(const struct nfc_ndef_msg_view *msg)
+{
+	return msg->record_count;
+}
+
+/** @brief Get the size of the message data iterated so far.
+ *
+ *  Once all records have been iterated, this is the size of the whole message.
+ *
+ *  @param[in] msg Pointer to the message view.
+ *
+ *  @return Size of the iterated data.
+ */
+static inline uint32_t nfc_ndef_msg_view_len(const struct nfc_ndef_msg_view *msg)
+{
+	return msg->offset;
+}
+
+/** @brief Iterate over all records of an NDEF message.
+ *
+ *  The loop stops at the end of the message or at the first malformed
+ *  record. Use @ref nfc_ndef_msg_view_next directly to distinguish these
+ *  cases.
+ *
+ *  @param msg Pointer to the initialized message view.
+ *  @param rec Pointer to the record view filled in each iteration.
+ */
+#define NFC_NDEF_MSG_VIEW_FOR_EACH(msg, rec) while (nfc_ndef_msg_view_next((msg), (rec)) == 0)
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NFC_NDEF_MSG_VIEW_H_ */
@@ -123,6 +123,10 @@ static inline void nfc_t4t_apdu_resp_clear(struct nfc_t4t_apdu_resp *resp_apdu);
 /** @brief Encode C-APDU.
  *
  *  This function encodes C-APDU according to the provided descriptor.
+ *  The extended length format is used for both the Lc and Le fields
+ *  if the data field is longer than 255 bytes or the expected response
+ *  is longer than 256 bytes. The data field is not copied if it is
+ *  already placed at its position in the @p raw_data buffer.
  *
  *  @param[in] cmd_apdu  Pointer to the C-APDU descriptor.
  *  @param[out] raw_data Pointer to the buffer with encoded C-APDU.
@@ -18,6 +18,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <zephyr/types.h>
 #include <nfc/t4t/cc_file.h>
 
@@ -77,8 +78,50 @@ struct nfc_t4t_hl_procedure_cb {
 	 * @param[in] file id File Identifier.
 	 */
 	void (*ndef_updated)(uint16_t file_id);
+
+	/**@brief HL Procedure NDEF file streamed callback.
+	 *
+	 * The streaming NDEF file read operation of Type 4 Tag
+	 * is completed successfully.
+	 *
+	 * @param[in] file_id File Identifier.
+	 * @param[in] len Length of the NDEF message passed to the sink.
+	 */
+	void (*ndef_streamed)(uint16_t file_id, size_t len);
 };
 
+/**@brief NDEF stream sink.
+ *
+ * Called with consecutive chunks of the NDEF message read from the tag.
+ * The chunks are passed before the status of the R-APDU which contains
+ * them is verified.
+ *
+ * @param[in] offset Offset of the chunk within the NDEF message.
+ * @param[in] data Pointer to the chunk data.
+ * @param[in] len Length of the chunk.
+ * @param[in] user_data Pointer to the user data.
+ *
+ * @retval 0 To continue the procedure.
+ *           Otherwise, a (negative) error code which aborts the procedure.
+ */
+typedef int (*nfc_t4t_hl_procedure_ndef_sink_t)(uint32_t offset, const uint8_t *data,
+						size_t len, void *user_data);
+
+/**@brief NDEF stream source.
+ *
+ * Called to fill consecutive chunks of the NDEF message written to the tag.
+ *
+ * @param[in] offset Offset of the chunk within the NDEF message.
+ * @param[out] data Pointer to the buffer to be filled with @p len bytes.
+ * @param[in] len Length of the chunk.
+ * @param[in] user_data Pointer to the user data.
+ *
+ * @retval 0 To continue the procedure.
+ *           Otherwise, a (negative) error code which aborts the procedure.
+ */
+typedef int (*nfc_t4t_hl_procedure_ndef_source_t)(uint32_t offset, uint8_t *data,
+						  size_t len, void *user_data);
+
 /**@brief Handle High Level Procedure received data.
  *
  * Function for handling the received data. It should be called
@@ -92,6 +135,21 @@ struct nfc_t4t_hl_procedure_cb {
  */
 int nfc_t4t_hl_procedure_on_data_received(const uint8_t *data, size_t len);
 
+/**@brief Handle High Level Procedure received chained data.
+ *
+ * Function for handling the data of a chained ISO-DEP block. It can be
+ * used as the @ref nfc_t4t_isodep_cb.chained_data_received callback, so
+ * that the streaming NDEF Read Procedure passes the response data directly
+ * to the sink, without storing it in the ISO-DEP Rx buffer.
+ *
+ * @param[in] data Pointer to received data.
+ * @param[in] len Received data length.
+ *
+ * @retval true If the data was consumed.
+ * @retval false If the data should be stored in the ISO-DEP Rx buffer.
+ */
+bool nfc_t4t_hl_procedure_on_chained_data_received(const uint8_t *data, size_t len);
+
 /**@brief Register High Level Procedure callback.
  *
  * Function for register callback. It should be used
@@ -166,6 +224,45 @@ int nfc_t4t_hl_procedure_ndef_read(struct nfc_t4t_cc_file *cc,
 int nfc_t4t_hl_procedure_ndef_update(struct nfc_t4t_cc_file *cc,
 				     uint8_t *ndef_data, uint16_t ndef_len);
 
+/**@brief Perform streaming NDEF Read Procedure.
+ *
+ * The NDEF message is read in the largest chunks allowed by the tag
+ * and passed to the sink, so no buffer for the whole NDEF file is needed.
+ * Extended length R-APDUs are used if the tag MLe is higher than 256 bytes.
+ * The @ref nfc_t4t_hl_procedure_cb.ndef_streamed callback is called when
+ * the procedure has completed.
+ *
+ * @param[in] cc Pointer to Capability Containers descriptor.
+ * @param[in] sink NDEF stream sink.
+ * @param[in] user_data Pointer to the user data passed to the sink.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_t4t_hl_procedure_ndef_read_stream(struct nfc_t4t_cc_file *cc,
+					  nfc_t4t_hl_procedure_ndef_sink_t sink,
+					  void *user_data);
+
+/**@brief Perform streaming NDEF Update Procedure.
+ *
+ * The NDEF message is taken from the source in the largest chunks allowed
+ * by the tag and the APDU buffer. Extended length C-APDUs are used if the
+ * tag MLc is higher than 255 bytes. The
+ * @ref nfc_t4t_hl_procedure_cb.ndef_updated callback is called when the
+ * procedure has completed.
+ *
+ * @param[in] cc Pointer to Capability Containers descriptor.
+ * @param[in] nlen Length of the NDEF message.
+ * @param[in] source NDEF stream source.
+ * @param[in] user_data Pointer to the user data passed to the source.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_t4t_hl_procedure_ndef_update_stream(struct nfc_t4t_cc_file *cc, uint16_t nlen,
+					    nfc_t4t_hl_procedure_ndef_source_t source,
+					    void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
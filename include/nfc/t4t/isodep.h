@@ -123,6 +123,23 @@ struct nfc_t4t_isodep_cb {
 	 */
 	void (*data_received)(const uint8_t *data, size_t data_len);
 
+	/**@brief ISO-DEP chained data received callback.
+	 *
+	 * Optional callback called for each received I-block with
+	 * the chaining bit set. If the data is consumed by the callback,
+	 * it is not stored in the Rx buffer, so the
+	 * @ref nfc_t4t_isodep_cb.data_received callback receives only the
+	 * data that follows. This allows receiving responses longer than
+	 * the Rx buffer.
+	 *
+	 * @param[in] data     Pointer to the received data.
+	 * @param[in] data_len Received data length.
+	 *
+	 * @retval true If the data was consumed.
+	 * @retval false If the data should be stored in the Rx buffer.
+	 */
+	bool (*chained_data_received)(const uint8_t *data, size_t data_len);
+
 	/**@brief Type 4 Tag ISO-DEP selected callback.
 	 *
 	 * A valid ATS frame from the tag was received.
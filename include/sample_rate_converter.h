@@ -172,6 +172,40 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+/**
+ * @brief	Process input samples of one channel and write the output samples interleaved
+ *		into a multi-channel buffer.
+ *
+ * @details	Works as @ref sample_rate_converter_process, but the output samples are written
+ *		directly to @p channel of an output buffer holding @p output_channels
+ *		interleaved channels. This avoids a separate interleaving pass over the output
+ *		buffer. Use one context for each channel.
+ *
+ * @param[in,out]	ctx			Pointer to the sample rate conversion context.
+ * @param[in]		filter			Filter type to be used for the conversion.
+ * @param[in]		input			Pointer to samples to process.
+ * @param[in]		input_size		Size of the input in bytes.
+ * @param[in]		input_sample_rate	Sample rate of the input bytes.
+ * @param[out]		output			Multi-channel array that output will be written.
+ * @param[in]		output_size		Size of the output array in bytes, for all channels.
+ * @param[out]		output_written		Number of bytes written to the output channel.
+ * @param[in]		output_sample_rate	Sample rate of output.
+ * @param[in]		channel			Channel of the output to write to.
+ * @param[in]		output_channels		Number of interleaved channels in the output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters for sample rate conversion.
+ * @retval	-EFAULT	Output ring buffer has either not enough bytes to output, or not enough
+ *			space to store bytes.
+ */
+int sample_rate_converter_process_interleaved(struct sample_rate_converter_ctx *ctx,
+					      enum sample_rate_converter_filter filter,
+					      void const *const input, size_t input_size,
+					      uint32_t input_sample_rate, void *const output,
+					      size_t output_size, size_t *output_written,
+					      uint32_t output_sample_rate, uint8_t channel,
+					      uint8_t output_channels);
+
 /**
  * @}
  */
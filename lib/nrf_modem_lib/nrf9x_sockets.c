@@ -29,6 +29,7 @@
 #include <zephyr/net/conn_mgr_connectivity_impl.h>
 #include <zephyr/net/net_if.h>
 #include <zephyr/sys/util_macro.h>
+#include <modem/nrf_modem_lib_socket.h>
 
 #if defined(CONFIG_POSIX_API)
 #include <zephyr/posix/poll.h>
@@ -50,6 +51,7 @@
 static struct nrf_sock_ctx {
 	int nrf_fd; /* nRF socket descriptor. */
 	int zvfs_fd; /* ZVFS socket descriptor. */
+	bool stream; /* Stream socket, data may be sent in several parts. */
 	struct k_mutex *lock; /* Mutex associated with the socket. */
 	struct k_poll_signal poll; /* poll() signal. */
 	struct socket_ncs_pollcb pollcb; /* Poll callback (owned by the app). */
@@ -58,6 +60,10 @@ static struct nrf_sock_ctx {
 
 static K_MUTEX_DEFINE(ctx_lock);
 
+/* Intermediate buffers used by `sendmsg` and `recvmmsg` to gather and scatter data. */
+K_MEM_SLAB_DEFINE_STATIC(gather_slab, CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE,
+			 CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_COUNT, sizeof(void *));
+
 static const struct socket_op_vtable nrf9x_socket_fd_op_vtable;
 
 /* Offloading disabled in general. */
@@ -65,21 +71,33 @@ static bool offload_disabled;
 /* TLS offloading disabled only. */
 static bool tls_offload_disabled;
 
-static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int zvfs_fd)
+static struct nrf_sock_ctx *allocate_ctx(int nrf_fd, int zvfs_fd, bool stream)
 {
 	struct nrf_sock_ctx *ctx = NULL;
 
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	for (int i = 0; i < ARRAY_SIZE(offload_ctx); i++) {
-		if (offload_ctx[i].nrf_fd == -1) {
-			ctx = &offload_ctx[i];
-			ctx->nrf_fd = nrf_fd;
-			ctx->zvfs_fd = zvfs_fd;
-			break;
+	/* Prefer the context indexed by the nRF socket descriptor, so that it is found
+	 * without a search.
+	 */
+	if ((nrf_fd >= 0) && (nrf_fd < ARRAY_SIZE(offload_ctx)) &&
+	    (offload_ctx[nrf_fd].nrf_fd == -1)) {
+		ctx = &offload_ctx[nrf_fd];
+	} else {
+		for (int i = 0; i < ARRAY_SIZE(offload_ctx); i++) {
+			if (offload_ctx[i].nrf_fd == -1) {
+				ctx = &offload_ctx[i];
+				break;
+			}
 		}
 	}
 
+	if (ctx != NULL) {
+		ctx->nrf_fd = nrf_fd;
+		ctx->zvfs_fd = zvfs_fd;
+		ctx->stream = stream;
+	}
+
 	k_mutex_unlock(&ctx_lock);
 
 	return ctx;
@@ -92,6 +110,7 @@ static void release_ctx(struct nrf_sock_ctx *ctx)
 	ctx->nrf_fd = -1;
 	ctx->lock = NULL;
 	ctx->zvfs_fd = -1;
+	ctx->stream = false;
 	memset(&ctx->pollcb, 0, sizeof(ctx->pollcb));
 	memset(&ctx->sendcb, 0, sizeof(ctx->sendcb));
 
@@ -100,6 +119,10 @@ static void release_ctx(struct nrf_sock_ctx *ctx)
 
 static struct nrf_sock_ctx *find_ctx(int fd)
 {
+	if ((fd >= 0) && (fd < ARRAY_SIZE(offload_ctx)) && (offload_ctx[fd].nrf_fd == fd)) {
+		return &offload_ctx[fd];
+	}
+
 	for (size_t i = 0; i < ARRAY_SIZE(offload_ctx); i++) {
 		if (offload_ctx[i].nrf_fd == fd) {
 			return &offload_ctx[i];
@@ -408,7 +431,7 @@ static int nrf9x_socket_offload_accept(void *obj, struct net_sockaddr *addr,
 		goto error;
 	}
 
-	ctx = allocate_ctx(new_sd, fd);
+	ctx = allocate_ctx(new_sd, fd, true);
 	if (ctx == NULL) {
 		errno = ENOMEM;
 		goto error;
@@ -772,81 +795,257 @@ static ssize_t nrf9x_socket_offload_sendto(void *obj, const void *buf,
 	return retval;
 }
 
+static void *gather_buf_alloc(size_t len)
+{
+	void *buf;
+
+	if (len > CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE) {
+		return k_malloc(len);
+	}
+
+	if (k_mem_slab_alloc(&gather_slab, &buf, K_FOREVER)) {
+		return NULL;
+	}
+
+	return buf;
+}
+
+static void gather_buf_free(void *buf, size_t len)
+{
+	if (len > CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE) {
+		k_free(buf);
+	} else {
+		k_mem_slab_free(&gather_slab, buf);
+	}
+}
+
+/* Send a buffer. On stream sockets, the send is repeated until all data is sent. */
+static ssize_t send_all(void *obj, const uint8_t *buf, size_t len, int flags,
+			const struct net_msghdr *msg)
+{
+	struct nrf_sock_ctx *ctx = OBJ_TO_CTX(obj);
+	size_t offset = 0;
+	ssize_t ret;
+
+	do {
+		ret = nrf9x_socket_offload_sendto(obj, buf + offset, len - offset, flags,
+						  msg->msg_name, msg->msg_namelen);
+		if (ret < 0) {
+			return ret;
+		}
+
+		offset += ret;
+	} while (ctx->stream && (offset < len));
+
+	return offset;
+}
+
 static ssize_t nrf9x_socket_offload_sendmsg(void *obj, const struct net_msghdr *msg,
 					    int flags)
 {
-	ssize_t len = 0;
+	struct nrf_sock_ctx *ctx = OBJ_TO_CTX(obj);
+	const struct net_iovec *iov = NULL;
+	size_t len = 0;
+	size_t iov_count = 0;
 	ssize_t ret;
-	ssize_t offset;
+	uint8_t *buf;
 	int i;
-	static K_MUTEX_DEFINE(sendmsg_lock);
-	static uint8_t buf[CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE];
 
 	if (msg == NULL) {
 		errno = EINVAL;
 		return -1;
 	}
 
-	/* Try to reduce number of `sendto` calls - copy data if they fit into
-	 * a single buffer
-	 */
-
 	for (i = 0; i < msg->msg_iovlen; i++) {
+		if (msg->msg_iov[i].iov_len > 0) {
+			iov = &msg->msg_iov[i];
+			iov_count++;
+		}
+
 		len += msg->msg_iov[i].iov_len;
 	}
 
-	if (len <= sizeof(buf)) {
-		/* Protect `buf` access with a mutex. */
-		k_mutex_lock(&sendmsg_lock, K_FOREVER);
+	if (len == 0) {
+		return 0;
+	}
+
+	/* A single buffer is sent as is, without copying. */
+	if (iov_count == 1) {
+		return send_all(obj, iov->iov_base, iov->iov_len, flags, msg);
+	}
+
+	/* If the data of a stream socket won't fit into an intermediate buffer,
+	 * send the buffers separately. A datagram must be sent in one piece,
+	 * so it is always gathered.
+	 */
+	if (ctx->stream && (len > CONFIG_NRF_MODEM_LIB_SENDMSG_BUF_SIZE)) {
 		len = 0;
 
 		for (i = 0; i < msg->msg_iovlen; i++) {
-			memcpy(buf + len, msg->msg_iov[i].iov_base,
-			       msg->msg_iov[i].iov_len);
-			len += msg->msg_iov[i].iov_len;
-		}
+			if (msg->msg_iov[i].iov_len == 0) {
+				continue;
+			}
 
-		offset = 0;
-		ret = 0;
-		while ((offset < len) && (ret >= 0)) {
-			ret = nrf9x_socket_offload_sendto(obj,
-				(buf + offset), (len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret > 0) {
-				offset += ret;
+			ret = send_all(obj, msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len,
+				       flags, msg);
+			if (ret < 0) {
+				return ret;
 			}
+
+			len += ret;
 		}
 
-		k_mutex_unlock(&sendmsg_lock);
-		return ret;
+		return len;
 	}
 
-	/* If the data won't fit into intermediate buffer, send the buffers
-	 * separately
-	 */
+	/* Reduce the number of `sendto` calls by copying data into a single buffer. */
+	buf = gather_buf_alloc(len);
+	if (buf == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
 
 	len = 0;
 
 	for (i = 0; i < msg->msg_iovlen; i++) {
-		if (msg->msg_iov[i].iov_len == 0) {
-			continue;
+		memcpy(buf + len, msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	ret = send_all(obj, buf, len, flags, msg);
+
+	gather_buf_free(buf, len);
+
+	return ret;
+}
+
+static ssize_t recvmsg_one(void *obj, struct net_msghdr *msg, int flags)
+{
+	size_t len = 0;
+	size_t offset = 0;
+	ssize_t ret;
+	uint8_t *buf;
+	net_socklen_t *namelen = (msg->msg_name != NULL) ? &msg->msg_namelen : NULL;
+
+	msg->msg_flags = 0;
+
+	/* A single buffer is received into directly, without copying. */
+	if (msg->msg_iovlen == 1) {
+		return nrf9x_socket_offload_recvfrom(obj, msg->msg_iov[0].iov_base,
+						     msg->msg_iov[0].iov_len, flags,
+						     msg->msg_name, namelen);
+	}
+
+	for (int i = 0; i < msg->msg_iovlen; i++) {
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	buf = gather_buf_alloc(len);
+	if (buf == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ret = nrf9x_socket_offload_recvfrom(obj, buf, len, flags, msg->msg_name, namelen);
+
+	for (int i = 0; (i < msg->msg_iovlen) && (ret > 0) && (offset < ret); i++) {
+		size_t part = MIN(msg->msg_iov[i].iov_len, ret - offset);
+
+		memcpy(msg->msg_iov[i].iov_base, buf + offset, part);
+		offset += part;
+	}
+
+	gather_buf_free(buf, len);
+
+	return ret;
+}
+
+/* Get the offloading context of a socket, and lock the socket like the socket API does. */
+static void *batch_obj_get(int fd, struct k_mutex **lock)
+{
+	const struct fd_op_vtable *vtable;
+	void *obj;
+
+	obj = zvfs_get_fd_obj_and_vtable(fd, &vtable, lock);
+	if (obj == NULL) {
+		return NULL;
+	}
+
+	if (vtable != (const struct fd_op_vtable *)&nrf9x_socket_fd_op_vtable) {
+		errno = ENOTSUP;
+		return NULL;
+	}
+
+	(void)k_mutex_lock(*lock, K_FOREVER);
+
+	return obj;
+}
+
+int nrf_modem_lib_sendmmsg(int fd, struct nrf_modem_lib_mmsghdr *msgvec, unsigned int vlen,
+			   int flags)
+{
+	struct k_mutex *lock;
+	unsigned int i;
+	ssize_t ret;
+	void *obj;
+
+	if ((msgvec == NULL) && (vlen > 0)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	obj = batch_obj_get(fd, &lock);
+	if (obj == NULL) {
+		return -1;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		ret = nrf9x_socket_offload_sendmsg(obj, &msgvec[i].msg_hdr, flags);
+		if (ret < 0) {
+			break;
 		}
 
-		offset = 0;
-		while (offset < msg->msg_iov[i].iov_len) {
-			ret = nrf9x_socket_offload_sendto(obj,
-				(((uint8_t *) msg->msg_iov[i].iov_base) + offset),
-				(msg->msg_iov[i].iov_len - offset), flags,
-				msg->msg_name, msg->msg_namelen);
-			if (ret < 0) {
-				return ret;
-			}
-			offset += ret;
-			len += ret;
+		msgvec[i].msg_len = ret;
+	}
+
+	k_mutex_unlock(lock);
+
+	/* Report an error only if no message was sent, the errno of a later failure is kept. */
+	return (i > 0) ? i : ((vlen > 0) ? -1 : 0);
+}
+
+int nrf_modem_lib_recvmmsg(int fd, struct nrf_modem_lib_mmsghdr *msgvec, unsigned int vlen,
+			   int flags)
+{
+	struct k_mutex *lock;
+	unsigned int i;
+	ssize_t ret;
+	void *obj;
+
+	if ((msgvec == NULL) && (vlen > 0)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	obj = batch_obj_get(fd, &lock);
+	if (obj == NULL) {
+		return -1;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		/* Only wait for the first message, the rest must be already available. */
+		ret = recvmsg_one(obj, &msgvec[i].msg_hdr,
+				  (i == 0) ? flags : (flags | ZSOCK_MSG_DONTWAIT));
+		if (ret < 0) {
+			break;
 		}
+
+		msgvec[i].msg_len = ret;
 	}
 
-	return len;
+	k_mutex_unlock(lock);
+
+	return (i > 0) ? i : ((vlen > 0) ? -1 : 0);
 }
 
 static void nrf9x_socket_offload_freeaddrinfo(struct zsock_addrinfo *root)
@@ -1193,7 +1392,7 @@ static int nrf9x_socket_create(int family, int type, int proto)
 		return -1;
 	}
 
-	ctx = allocate_ctx(sd, fd);
+	ctx = allocate_ctx(sd, fd, type == NET_SOCK_STREAM);
 	if (ctx == NULL) {
 		errno = ENOMEM;
 		nrf_close(sd);
@@ -23,11 +23,13 @@ LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVE
 	 SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES)
 
 #ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+#define SAMPLE_RATE_CONVERTER_BYTES_PER_SAMPLE sizeof(uint16_t)
 #define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
 	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint16_t))
 #define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
 	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint16_t))
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+#define SAMPLE_RATE_CONVERTER_BYTES_PER_SAMPLE sizeof(uint32_t)
 #define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
 	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint32_t))
 #define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
@@ -199,11 +201,42 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx)
 	return 0;
 }
 
-int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
-				  enum sample_rate_converter_filter filter, void const *const input,
-				  size_t input_size, uint32_t sample_rate_input, void *const output,
-				  size_t output_size, size_t *output_written,
-				  uint32_t sample_rate_output)
+/**
+ * @brief Copy output samples of a channel to the output buffer.
+ *
+ * @details When the output has more than one channel, the samples are written interleaved with
+ *	    the other channels, so that no separate interleaving pass is needed.
+ *
+ * @param[out]	output		Pointer to the output buffer.
+ * @param[in]	offset		Offset of the samples within the channel, in bytes.
+ * @param[in]	data		Samples to copy.
+ * @param[in]	size		Size of the samples to copy in bytes.
+ * @param[in]	channel		Channel of the output to write the samples to.
+ * @param[in]	output_channels	Number of interleaved channels in the output.
+ */
+static void output_write(uint8_t *output, size_t offset, uint8_t const *data, size_t size,
+			 uint8_t channel, uint8_t output_channels)
+{
+	uint8_t *write_ptr;
+
+	if (output_channels == 1) {
+		memcpy(output + offset, data, size);
+		return;
+	}
+
+	write_ptr = output + (offset * output_channels) +
+		    (channel * SAMPLE_RATE_CONVERTER_BYTES_PER_SAMPLE);
+
+	for (size_t i = 0; i < size; i += SAMPLE_RATE_CONVERTER_BYTES_PER_SAMPLE) {
+		memcpy(write_ptr, &data[i], SAMPLE_RATE_CONVERTER_BYTES_PER_SAMPLE);
+		write_ptr += SAMPLE_RATE_CONVERTER_BYTES_PER_SAMPLE * output_channels;
+	}
+}
+
+static int process(struct sample_rate_converter_ctx *ctx, enum sample_rate_converter_filter filter,
+		   void const *const input, size_t input_size, uint32_t sample_rate_input,
+		   void *const output, size_t output_size, size_t *output_written,
+		   uint32_t sample_rate_output, uint8_t channel, uint8_t output_channels)
 {
 	int ret;
 	const uint8_t *read_ptr;
@@ -260,7 +293,7 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		*output_written = input_size / abs(ctx->conversion_ratio);
 	}
 
-	if (*output_written > output_size) {
+	if ((*output_written * output_channels) > output_size) {
 		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
 			"hold");
 		return -EINVAL;
@@ -297,7 +330,8 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		memcpy(internal_input_buf, ctx->input_buf.buf, ctx->input_buf.bytes_in_buf);
 		memcpy(internal_input_buf + ctx->input_buf.bytes_in_buf, input, input_size);
 	} else {
-		write_ptr = output;
+		/* Interleaved output is written from the internal buffer after filtering. */
+		write_ptr = (output_channels == 1) ? output : internal_output_buf;
 		read_ptr = input;
 		samples_to_process = samples_in;
 	}
@@ -321,7 +355,11 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 #endif
 
 	if (ctx->conversion_ratio != 3) {
-		/* Nothing needs to be done in output buffer */
+		if (output_channels > 1) {
+			output_write(output, 0, internal_output_buf, *output_written, channel,
+				     output_channels);
+		}
+
 		return 0;
 	}
 
@@ -367,7 +405,7 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		bytes_to_write -= ringbuf_write_size;
 	}
 	int bytes_to_read = input_size * ctx->conversion_ratio;
-	uint8_t *ringbuf_output_ptr = (uint8_t *)output;
+	size_t output_offset = 0;
 
 	LOG_DBG("Reading %d bytes from output_buffer", bytes_to_read);
 	while (bytes_to_read) {
@@ -380,8 +418,9 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 			return -EFAULT;
 		}
 
-		memcpy(ringbuf_output_ptr, data, ringbuf_read_size);
-		ringbuf_output_ptr += ringbuf_read_size;
+		output_write(output, output_offset, data, ringbuf_read_size, channel,
+			     output_channels);
+		output_offset += ringbuf_read_size;
 		bytes_to_read -= ringbuf_read_size;
 
 		ret = ring_buf_get_finish(&ctx->output_ringbuf, ringbuf_read_size);
@@ -393,3 +432,30 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 
 	return 0;
 }
+
+int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
+				  enum sample_rate_converter_filter filter, void const *const input,
+				  size_t input_size, uint32_t sample_rate_input, void *const output,
+				  size_t output_size, size_t *output_written,
+				  uint32_t sample_rate_output)
+{
+	return process(ctx, filter, input, input_size, sample_rate_input, output, output_size,
+		       output_written, sample_rate_output, 0, 1);
+}
+
+int sample_rate_converter_process_interleaved(struct sample_rate_converter_ctx *ctx,
+					      enum sample_rate_converter_filter filter,
+					      void const *const input, size_t input_size,
+					      uint32_t sample_rate_input, void *const output,
+					      size_t output_size, size_t *output_written,
+					      uint32_t sample_rate_output, uint8_t channel,
+					      uint8_t output_channels)
+{
+	if ((output_channels == 0) || (channel >= output_channels)) {
+		LOG_ERR("Invalid output channel %d of %d", channel, output_channels);
+		return -EINVAL;
+	}
+
+	return process(ctx, filter, input, input_size, sample_rate_input, output, output_size,
+		       output_written, sample_rate_output, channel, output_channels);
+}
@@ -181,7 +181,8 @@ int main(void)
 {
 
 #if defined(CONFIG_FPROTECT)
-	int err = fprotect_area(b0_offset, b0_size);
+	/* The validated image cache is protected once the boot decision is made. */
+	int err = fprotect_area(b0_offset, b0_size - BL_VALIDATION_CACHE_SIZE);
 
 	if (err) {
 		printk("Failed to protect B0 flash, cancel startup.\r\n");
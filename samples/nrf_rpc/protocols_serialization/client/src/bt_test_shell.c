@@ -19,6 +19,8 @@
 #include <zephyr/types.h>
 #include <zephyr/logging/log.h>
 
+#include <bluetooth/bt_rpc.h>
+
 LOG_MODULE_REGISTER(bt_test, CONFIG_NRF_PS_CLIENT_LOG_LEVEL);
 
 /* UUID: 12345678-1234-5678-1234-56789abcdef0 */
@@ -274,10 +276,98 @@ static int cmd_write(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+/*
+ * Measures the rate of connection information requests and notifications, and reports the number
+ * of RPC commands avoided by the connection information cache and the notification batching.
+ */
+static int cmd_bench(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct bt_conn_info info;
+	uint32_t count;
+	uint32_t start;
+	uint32_t elapsed_ms;
+	int err = 0;
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	uint32_t cache_hits = bt_rpc_conn_info_cache_hits();
+#endif
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH)
+	uint32_t notifications;
+	uint32_t batches;
+	uint32_t notifications_end;
+	uint32_t batches_end;
+#endif
+
+	count = shell_strtoul(argv[1], 0, &err);
+	if (err || count == 0) {
+		shell_error(sh, "BT Test Invalid count: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	if (!test_ctx.conn) {
+		shell_error(sh, "BT Test Not connected");
+		return -ENOEXEC;
+	}
+
+	start = k_uptime_get_32();
+
+	for (uint32_t i = 0; i < count; i++) {
+		err = bt_conn_get_info(test_ctx.conn, &info);
+		if (err) {
+			shell_error(sh, "BT Test Failed to get connection info: %d", err);
+			return -ENOEXEC;
+		}
+	}
+
+	elapsed_ms = MAX(k_uptime_get_32() - start, 1);
+	shell_print(sh, "BT Test %u connection info requests in %u ms: %u requests/s", count,
+		    elapsed_ms, count * MSEC_PER_SEC / elapsed_ms);
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	shell_print(sh, "BT Test RPC calls avoided: %u", bt_rpc_conn_info_cache_hits() - cache_hits);
+#endif
+
+	if (!test_ctx.notify_enabled) {
+		shell_print(sh, "BT Test Notifications not enabled by the peer, skipping");
+		return 0;
+	}
+
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH)
+	bt_rpc_gatt_notify_batch_stats(&notifications, &batches);
+#endif
+
+	start = k_uptime_get_32();
+
+	for (uint32_t i = 0; i < count; i++) {
+		err = bt_gatt_notify(test_ctx.conn, &custom_svc.attrs[1], test_ctx.data,
+				     TEST_DATA_SIZE);
+		if (err) {
+			shell_error(sh, "BT Test Notify error: %d", err);
+			return -ENOEXEC;
+		}
+	}
+
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH)
+	(void)bt_rpc_gatt_notify_flush();
+#endif
+
+	elapsed_ms = MAX(k_uptime_get_32() - start, 1);
+	shell_print(sh, "BT Test %u notifications in %u ms: %u notifications/s, %u B/s", count,
+		    elapsed_ms, count * MSEC_PER_SEC / elapsed_ms,
+		    count * TEST_DATA_SIZE * MSEC_PER_SEC / elapsed_ms);
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH)
+	bt_rpc_gatt_notify_batch_stats(&notifications_end, &batches_end);
+	shell_print(sh, "BT Test RPC calls avoided: %u",
+		    (notifications_end - notifications) - (batches_end - batches));
+#endif
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(
 	bt_test_cmds, SHELL_CMD_ARG(advertise, NULL, "on|off", cmd_advertise, 2, 0),
 	SHELL_CMD_ARG(read, NULL, "Read characteristic value", cmd_read, 1, 0),
 	SHELL_CMD_ARG(write, NULL, "Write characteristic value <hex>", cmd_write, 2, 0),
+	SHELL_CMD_ARG(bench, NULL, "Measure connection info and notification rate <count>",
+		      cmd_bench, 2, 0),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_ARG_REGISTER(bt_test, &bt_test_cmds, "BLE test service commands", NULL, 2, 0);
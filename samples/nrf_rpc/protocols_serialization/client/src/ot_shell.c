@@ -7,6 +7,7 @@
 #include "ot_shell.h"
 #include <net/ot_rpc.h>
 
+#include <zephyr/kernel.h>
 #include <zephyr/net/net_ip.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/sys/util.h>
@@ -2198,6 +2199,89 @@ static int cmd_udp_send(const struct shell *sh, size_t argc, char *argv[])
 	return ot_cli_command_exec(cmd_udp_send_impl, sh, argc, argv);
 }
 
+/*
+ * Sends a number of UDP messages with generated payload, each built from several appends,
+ * and reports the message rate and the number of nRF RPC round trips per message.
+ */
+static otError cmd_udp_bench_impl(const struct shell *sh, size_t argc, char *argv[])
+{
+	otError error = OT_ERROR_NONE;
+	otMessageInfo msg_info;
+	otMessageSettings msg_settings = {
+		.mLinkSecurityEnabled = true,
+		.mPriority = OT_MESSAGE_PRIORITY_NORMAL,
+	};
+	otMessage *msg;
+	unsigned long count;
+	unsigned long length;
+	uint32_t round_trips;
+	int64_t start;
+	int64_t elapsed_ms;
+	int rc = 0;
+
+	count = shell_strtoul(argv[1], 0, &rc);
+	if (rc || count == 0) {
+		return OT_ERROR_INVALID_ARGS;
+	}
+
+	length = shell_strtoul(argv[2], 0, &rc);
+	if (rc || length > MAX_UDP_GENERATED_PAYLOAD_LEN) {
+		return OT_ERROR_INVALID_ARGS;
+	}
+
+	memset(&msg_info, 0, sizeof(msg_info));
+
+	if (argc == 5) {
+		if (net_addr_pton(AF_INET6, argv[3], (struct in6_addr *)&msg_info.mPeerAddr)) {
+			return OT_ERROR_INVALID_ARGS;
+		}
+
+		msg_info.mPeerPort = shell_strtoul(argv[4], 0, &rc);
+		if (rc) {
+			return OT_ERROR_INVALID_ARGS;
+		}
+	}
+
+	if (!otUdpIsOpen(NULL, &udp_socket)) {
+		return OT_ERROR_INVALID_STATE;
+	}
+
+	round_trips = ot_rpc_get_message_round_trips();
+	start = k_uptime_get();
+
+	for (unsigned long i = 0; i < count; i++) {
+		msg = otUdpNewMessage(NULL, &msg_settings);
+		if (msg == NULL) {
+			error = OT_ERROR_NO_BUFS;
+			break;
+		}
+
+		error = udp_append_generated_payload(msg, (uint16_t)length);
+		if (error == OT_ERROR_NONE) {
+			error = otUdpSend(NULL, &udp_socket, msg, &msg_info);
+		}
+
+		if (error != OT_ERROR_NONE) {
+			otMessageFree(msg);
+			break;
+		}
+	}
+
+	elapsed_ms = MAX(k_uptime_get() - start, 1);
+	round_trips = ot_rpc_get_message_round_trips() - round_trips;
+
+	shell_print(sh, "Sent %lu messages of %lu bytes in %lld ms: %lld messages/s",
+		    count, length, elapsed_ms, (int64_t)count * MSEC_PER_SEC / elapsed_ms);
+	shell_print(sh, "Round trips: %u (%lu per message)", round_trips, round_trips / count);
+
+	return error;
+}
+
+static int cmd_udp_bench(const struct shell *sh, size_t argc, char *argv[])
+{
+	return ot_cli_command_exec(cmd_udp_bench_impl, sh, argc, argv);
+}
+
 static otError cmd_udp_close_impl(const struct shell *sh, size_t argc, char *argv[])
 {
 	return otUdpClose(NULL, &udp_socket);
@@ -2214,6 +2298,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	SHELL_CMD_ARG(connect, NULL, "Connect socket <addr> <port>", cmd_udp_connect, 3, 0),
 	SHELL_CMD_ARG(send, NULL, "Send message [addr port] [-t|-x|-s] <message|hex|length>",
 		      cmd_udp_send, 2, 3),
+	SHELL_CMD_ARG(bench, NULL, "Send messages and measure the rate <count> <length> [addr port]",
+		      cmd_udp_bench, 3, 2),
 	SHELL_CMD_ARG(close, NULL, "Close socket", cmd_udp_close, 1, 0), SHELL_SUBCMD_SET_END);
 
 static otError cmd_channel_impl(const struct shell *sh, size_t argc, char *argv[])
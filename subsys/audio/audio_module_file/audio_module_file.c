@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include "audio_module_file.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include "audio_defines.h"
+#include "audio_module.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(audio_module_file, CONFIG_AUDIO_MODULE_FILE_LOG_LEVEL);
+
+/* Size of the canonical WAV header written by the sink. */
+#define WAV_HEADER_SIZE	   (44)
+#define WAV_CHUNK_HDR_SIZE (8)
+#define WAV_FMT_SIZE	   (16)
+#define WAV_FORMAT_PCM	   (1)
+
+static int frame_bytes_calculate(struct audio_module_file_context *ctx)
+{
+	struct audio_module_file_configuration *config = &ctx->config;
+
+	if (config->sample_rate_hz == 0 || config->channels == 0 ||
+	    config->frame_duration_us == 0 || config->bits_per_sample == 0 ||
+	    (config->bits_per_sample % 8) != 0) {
+		LOG_ERR("Invalid PCM format: %d Hz, %d bits, %d channel(s), %d us frames",
+			config->sample_rate_hz, config->bits_per_sample, config->channels,
+			config->frame_duration_us);
+		return -EINVAL;
+	}
+
+	ctx->frame_bytes = (size_t)config->sample_rate_hz * config->frame_duration_us /
+			   USEC_PER_SEC * (config->bits_per_sample / 8) * config->channels;
+
+	ctx->meta.data_coding = PCM;
+	ctx->meta.data_len_us = config->frame_duration_us;
+	ctx->meta.sample_rate_hz = config->sample_rate_hz;
+	ctx->meta.bits_per_sample = config->bits_per_sample;
+	ctx->meta.carried_bits_per_sample = config->bits_per_sample;
+	ctx->meta.bytes_per_location = ctx->frame_bytes / config->channels;
+	ctx->meta.interleaved = true;
+	ctx->meta.locations = BIT_MASK(config->channels);
+
+	return 0;
+}
+
+/**
+ * @brief Parse the RIFF/WAVE header and leave the file positioned at the PCM data.
+ */
+static int wav_header_parse(struct audio_module_file_context *ctx)
+{
+	ssize_t ret;
+	uint8_t hdr[WAV_FMT_SIZE];
+	uint32_t chunk_size;
+	bool fmt_found = false;
+
+	ret = fs_read(&ctx->file, hdr, 12);
+	if (ret != 12 || memcmp(&hdr[0], "RIFF", 4) != 0 || memcmp(&hdr[8], "WAVE", 4) != 0) {
+		LOG_ERR("%s is not a WAV file", ctx->config.path);
+		return -EINVAL;
+	}
+
+	while (1) {
+		ret = fs_read(&ctx->file, hdr, WAV_CHUNK_HDR_SIZE);
+		if (ret != WAV_CHUNK_HDR_SIZE) {
+			LOG_ERR("No data chunk in %s", ctx->config.path);
+			return -EINVAL;
+		}
+
+		chunk_size = sys_get_le32(&hdr[4]);
+
+		if (memcmp(&hdr[0], "data", 4) == 0) {
+			break;
+		}
+
+		if (memcmp(&hdr[0], "fmt ", 4) == 0 && chunk_size >= WAV_FMT_SIZE) {
+			ret = fs_read(&ctx->file, hdr, WAV_FMT_SIZE);
+			if (ret != WAV_FMT_SIZE) {
+				return -EIO;
+			}
+
+			if (sys_get_le16(&hdr[0]) != WAV_FORMAT_PCM) {
+				LOG_ERR("Only PCM WAV files are supported");
+				return -ENOTSUP;
+			}
+
+			ctx->config.channels = sys_get_le16(&hdr[2]);
+			ctx->config.sample_rate_hz = sys_get_le32(&hdr[4]);
+			ctx->config.bits_per_sample = sys_get_le16(&hdr[14]);
+			fmt_found = true;
+
+			chunk_size -= WAV_FMT_SIZE;
+		}
+
+		/* Skip the rest of the chunk, chunks are padded to an even size. */
+		ret = fs_seek(&ctx->file, chunk_size + (chunk_size & 1), FS_SEEK_CUR);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	if (!fmt_found) {
+		LOG_ERR("No fmt chunk before the data chunk in %s", ctx->config.path);
+		return -EINVAL;
+	}
+
+	ctx->data_left = chunk_size;
+
+	return 0;
+}
+
+static int wav_header_write(struct audio_module_file_context *ctx)
+{
+	int ret;
+	uint8_t hdr[WAV_HEADER_SIZE];
+	uint16_t block_align = ctx->config.channels * (ctx->config.bits_per_sample / 8);
+
+	memcpy(&hdr[0], "RIFF", 4);
+	sys_put_le32(WAV_HEADER_SIZE - 8 + ctx->bytes, &hdr[4]);
+	memcpy(&hdr[8], "WAVE", 4);
+	memcpy(&hdr[12], "fmt ", 4);
+	sys_put_le32(WAV_FMT_SIZE, &hdr[16]);
+	sys_put_le16(WAV_FORMAT_PCM, &hdr[20]);
+	sys_put_le16(ctx->config.channels, &hdr[22]);
+	sys_put_le32(ctx->config.sample_rate_hz, &hdr[24]);
+	sys_put_le32(ctx->config.sample_rate_hz * block_align, &hdr[28]);
+	sys_put_le16(block_align, &hdr[32]);
+	sys_put_le16(ctx->config.bits_per_sample, &hdr[34]);
+	memcpy(&hdr[36], "data", 4);
+	sys_put_le32(ctx->bytes, &hdr[40]);
+
+	ret = fs_seek(&ctx->file, 0, FS_SEEK_SET);
+	if (ret) {
+		return ret;
+	}
+
+	ret = fs_write(&ctx->file, hdr, sizeof(hdr));
+	if (ret != (int)sizeof(hdr)) {
+		return ret < 0 ? ret : -EIO;
+	}
+
+	return 0;
+}
+
+static int audio_module_file_source_open(struct audio_module_handle_private *handle,
+					 struct audio_module_configuration const *const configuration)
+{
+	int ret;
+	struct fs_dirent entry;
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_file_context *ctx = (struct audio_module_file_context *)hdl->context;
+	struct audio_module_file_configuration *config =
+		(struct audio_module_file_configuration *)configuration;
+
+	memset(ctx, 0, sizeof(struct audio_module_file_context));
+	memcpy(&ctx->config, config, sizeof(struct audio_module_file_configuration));
+
+	ret = fs_stat(config->path, &entry);
+	if (ret) {
+		LOG_ERR("Failed to find %s, ret %d", config->path, ret);
+		return ret;
+	}
+
+	fs_file_t_init(&ctx->file);
+
+	ret = fs_open(&ctx->file, config->path, FS_O_READ);
+	if (ret) {
+		LOG_ERR("Failed to open %s, ret %d", config->path, ret);
+		return ret;
+	}
+
+	if (config->wav) {
+		ret = wav_header_parse(ctx);
+	} else {
+		ctx->data_left = entry.size;
+	}
+
+	if (ret == 0) {
+		ret = frame_bytes_calculate(ctx);
+	}
+
+	if (ret) {
+		fs_close(&ctx->file);
+		return ret;
+	}
+
+	LOG_DBG("Open %s module, %d PCM bytes in %s", hdl->name, ctx->data_left, config->path);
+
+	return 0;
+}
+
+static int audio_module_file_sink_open(struct audio_module_handle_private *handle,
+				       struct audio_module_configuration const *const configuration)
+{
+	int ret;
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_file_context *ctx = (struct audio_module_file_context *)hdl->context;
+	struct audio_module_file_configuration *config =
+		(struct audio_module_file_configuration *)configuration;
+
+	memset(ctx, 0, sizeof(struct audio_module_file_context));
+	memcpy(&ctx->config, config, sizeof(struct audio_module_file_configuration));
+
+	fs_file_t_init(&ctx->file);
+
+	ret = fs_open(&ctx->file, config->path, FS_O_CREATE | FS_O_WRITE);
+	if (ret) {
+		LOG_ERR("Failed to open %s, ret %d", config->path, ret);
+		return ret;
+	}
+
+	ret = fs_truncate(&ctx->file, 0);
+	if (ret == 0 && config->wav) {
+		/* Reserve space for the header, it is written with the final sizes on close. */
+		ret = wav_header_write(ctx);
+	}
+
+	if (ret) {
+		LOG_ERR("Failed to prepare %s, ret %d", config->path, ret);
+		fs_close(&ctx->file);
+		return ret;
+	}
+
+	LOG_DBG("Open %s module, writing to %s", hdl->name, config->path);
+
+	return 0;
+}
+
+static int audio_module_file_close(struct audio_module_handle_private *handle)
+{
+	int ret = 0;
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_file_context *ctx = (struct audio_module_file_context *)hdl->context;
+
+	if (hdl->description->type == AUDIO_MODULE_TYPE_OUTPUT && ctx->config.wav) {
+		ret = wav_header_write(ctx);
+		if (ret) {
+			LOG_ERR("Failed to write the WAV header to %s, ret %d", ctx->config.path,
+				ret);
+		}
+	}
+
+	fs_close(&ctx->file);
+
+	LOG_DBG("Close %s module, %d frames, %d bytes, CRC 0x%08x", hdl->name, ctx->frames,
+		ctx->bytes, ctx->crc);
+
+	return ret;
+}
+
+static int audio_module_file_configuration_set(
+	struct audio_module_handle_private *handle,
+	struct audio_module_configuration const *const configuration)
+{
+	struct audio_module_file_configuration *config =
+		(struct audio_module_file_configuration *)configuration;
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_file_context *ctx = (struct audio_module_file_context *)hdl->context;
+
+	/* The file and its format are fixed when the module is opened, only the pacing can
+	 * change.
+	 */
+	ctx->config.frame_duration_us = config->frame_duration_us;
+	ctx->config.frame_sem = config->frame_sem;
+
+	LOG_DBG("Set the configuration for %s module: frame duration = %d us", hdl->name,
+		ctx->config.frame_duration_us);
+
+	if (hdl->description->type == AUDIO_MODULE_TYPE_INPUT) {
+		return frame_bytes_calculate(ctx);
+	}
+
+	return 0;
+}
+
+static int
+audio_module_file_configuration_get(struct audio_module_handle_private const *const handle,
+				    struct audio_module_configuration *configuration)
+{
+	struct audio_module_file_configuration *config =
+		(struct audio_module_file_configuration *)configuration;
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_file_context *ctx = (struct audio_module_file_context *)hdl->context;
+
+	memcpy(config, &ctx->config, sizeof(struct audio_module_file_configuration));
+
+	return 0;
+}
+
+static int audio_module_file_source_data_process(struct audio_module_handle_private *handle,
+						 struct audio_data const *const audio_data_in,
+						 struct audio_data *audio_data_out)
+{
+	ssize_t ret;
+	size_t size;
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_file_context *ctx = (struct audio_module_file_context *)hdl->context;
+
+	ARG_UNUSED(audio_data_in);
+
+	if (ctx->config.frame_sem != NULL) {
+		k_sem_take(ctx->config.frame_sem, K_FOREVER);
+	} else if (ctx->eof) {
+		/* Nothing is left to read and nothing paces the thread, so do not spin. */
+		k_sleep(K_FOREVER);
+	}
+
+	if (ctx->eof) {
+		return -ENODATA;
+	}
+
+	if (audio_data_out->data_size < ctx->frame_bytes) {
+		LOG_ERR("Buffer of %zu bytes is too small for a frame of %zu bytes",
+			audio_data_out->data_size, ctx->frame_bytes);
+		return -EINVAL;
+	}
+
+	size = MIN(ctx->frame_bytes, ctx->data_left);
+
+	ret = fs_read(&ctx->file, audio_data_out->data, size);
+	if (ret < 0) {
+		LOG_ERR("Failed to read %s, ret %d", ctx->config.path, (int)ret);
+		return ret;
+	}
+
+	ctx->data_left -= ret;
+
+	if ((size_t)ret < ctx->frame_bytes) {
+		/* Zero pad the last frame so that all frames have the same length. */
+		memset((uint8_t *)audio_data_out->data + ret, 0, ctx->frame_bytes - ret);
+		ctx->eof = true;
+	} else if (ctx->data_left == 0) {
+		ctx->eof = true;
+	}
+
+	memcpy(&audio_data_out->meta, &ctx->meta, sizeof(struct audio_metadata));
+	audio_data_out->meta.ref_ts_us = ctx->frames * ctx->config.frame_duration_us;
+	audio_data_out->data_size = ctx->frame_bytes;
+
+	ctx->crc = crc32_ieee_update(ctx->crc, audio_data_out->data, ctx->frame_bytes);
+	ctx->bytes += ctx->frame_bytes;
+	ctx->frames++;
+
+	return 0;
+}
+
+static int audio_module_file_sink_data_process(struct audio_module_handle_private *handle,
+					       struct audio_data const *const audio_data_in,
+					       struct audio_data *audio_data_out)
+{
+	ssize_t ret;
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_file_context *ctx = (struct audio_module_file_context *)hdl->context;
+
+	ARG_UNUSED(audio_data_out);
+
+	if (audio_data_in->meta.data_coding != PCM) {
+		LOG_ERR("Only PCM data can be written to %s", ctx->config.path);
+		ret = -EINVAL;
+		goto out;
+	}
+
+	/* The WAV header describes the format of the data actually received. */
+	ctx->config.sample_rate_hz = audio_data_in->meta.sample_rate_hz;
+	ctx->config.bits_per_sample = audio_data_in->meta.bits_per_sample;
+	ctx->config.channels = audio_data_in->meta.bytes_per_location
+				       ? audio_data_in->data_size /
+						 audio_data_in->meta.bytes_per_location
+				       : 1;
+
+	ret = fs_write(&ctx->file, audio_data_in->data, audio_data_in->data_size);
+	if (ret != (ssize_t)audio_data_in->data_size) {
+		LOG_ERR("Failed to write %s, ret %d", ctx->config.path, (int)ret);
+		ret = ret < 0 ? ret : -ENOSPC;
+		goto out;
+	}
+
+	ctx->crc = crc32_ieee_update(ctx->crc, audio_data_in->data, audio_data_in->data_size);
+	ctx->bytes += audio_data_in->data_size;
+	ctx->frames++;
+	ret = 0;
+
+out:
+	if (ctx->config.frame_sem != NULL) {
+		k_sem_give(ctx->config.frame_sem);
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Table of the file source module functions.
+ */
+const struct audio_module_functions audio_module_file_source_functions = {
+	/**
+	 * @brief  Function to open the file source module.
+	 */
+	.open = audio_module_file_source_open,
+
+	/**
+	 * @brief  Function to close the file source module.
+	 */
+	.close = audio_module_file_close,
+
+	/**
+	 * @brief  Function to set the configuration of the file source module.
+	 */
+	.configuration_set = audio_module_file_configuration_set,
+
+	/**
+	 * @brief  Function to get the configuration of the file source module.
+	 */
+	.configuration_get = audio_module_file_configuration_get,
+
+	.start = NULL,
+	.stop = NULL,
+
+	/**
+	 * @brief Read a frame from the file.
+	 */
+	.data_process = audio_module_file_source_data_process,
+};
+
+/**
+ * @brief Table of the file sink module functions.
+ */
+const struct audio_module_functions audio_module_file_sink_functions = {
+	/**
+	 * @brief  Function to open the file sink module.
+	 */
+	.open = audio_module_file_sink_open,
+
+	/**
+	 * @brief  Function to close the file sink module.
+	 */
+	.close = audio_module_file_close,
+
+	/**
+	 * @brief  Function to set the configuration of the file sink module.
+	 */
+	.configuration_set = audio_module_file_configuration_set,
+
+	/**
+	 * @brief  Function to get the configuration of the file sink module.
+	 */
+	.configuration_get = audio_module_file_configuration_get,
+
+	.start = NULL,
+	.stop = NULL,
+
+	/**
+	 * @brief Write a frame to the file.
+	 */
+	.data_process = audio_module_file_sink_data_process,
+};
+
+/**
+ * @brief The set-up description for the file source.
+ */
+struct audio_module_description audio_module_file_source_dept = {
+	.name = "File Source",
+	.type = AUDIO_MODULE_TYPE_INPUT,
+	.functions = &audio_module_file_source_functions};
+
+/**
+ * @brief The set-up description for the file sink.
+ */
+struct audio_module_description audio_module_file_sink_dept = {
+	.name = "File Sink",
+	.type = AUDIO_MODULE_TYPE_OUTPUT,
+	.functions = &audio_module_file_sink_functions};
+
+/**
+ * @brief A private pointer to the file source set-up parameters.
+ */
+struct audio_module_description *audio_module_file_source_description =
+	&audio_module_file_source_dept;
+
+/**
+ * @brief A private pointer to the file sink set-up parameters.
+ */
+struct audio_module_description *audio_module_file_sink_description =
+	&audio_module_file_sink_dept;
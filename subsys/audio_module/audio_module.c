@@ -126,6 +126,12 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 		return false;
 	}
 
+	/* A module without a thread can only be run by a graph executor. */
+	if (IS_ENABLED(CONFIG_AUDIO_MODULE_GRAPH) && parameters->thread.stack == NULL &&
+	    parameters->thread.stack_size == 0) {
+		return true;
+	}
+
 	if (parameters->thread.stack == NULL || parameters->thread.stack_size == 0) {
 		return false;
 	}
@@ -133,6 +139,27 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 	return true;
 }
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+/**
+ * @brief Helper function to check if a module is part of a graph.
+ *
+ * @param handle  [in]  The handle to the module instance.
+ *
+ * @return true if the module is part of a graph, false otherwise.
+ */
+static bool in_graph(struct audio_module_handle const *const handle)
+{
+	return handle != NULL && handle->graph != NULL;
+}
+#else
+static bool in_graph(struct audio_module_handle const *const handle)
+{
+	ARG_UNUSED(handle);
+
+	return false;
+}
+#endif /* defined(CONFIG_AUDIO_MODULE_GRAPH) */
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
@@ -537,6 +564,280 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 	CODE_UNREACHABLE;
 }
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+/**
+ * @brief Run the data process function of a module in a graph.
+ *
+ * @param handle         [in/out]  The handle for the module instance.
+ * @param audio_data_rx  [in]      Pointer to the input audio data or NULL for an input module.
+ * @param audio_data_tx  [out]     Pointer to the output audio data, not used for an output
+ *                                 module.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int graph_module_process(struct audio_module_handle *handle,
+				struct audio_data const *const audio_data_rx,
+				struct audio_data *audio_data_tx)
+{
+	int ret;
+	void *data = NULL;
+
+	if (!has_input_type(handle->description->type)) {
+		return handle->description->functions->data_process(
+			(struct audio_module_handle_private *)handle, audio_data_rx, NULL);
+	}
+
+	ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
+	if (ret) {
+		LOG_ERR("No free data buffer for module %s, ret %d", handle->name, ret);
+		return ret;
+	}
+
+	audio_data_tx->data = data;
+	audio_data_tx->data_size = handle->thread.data_size;
+
+	ret = handle->description->functions->data_process(
+		(struct audio_module_handle_private *)handle, audio_data_rx, audio_data_tx);
+	if (ret) {
+		k_mem_slab_free(handle->thread.data_slab, data);
+		return ret;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Run all the modules of a graph for one frame of audio data.
+ *
+ * @param graph          [in/out]  Pointer to the graph.
+ * @param audio_data_rx  [in]      Pointer to the input audio data of the head module or NULL for
+ *                                 an input module.
+ */
+static void graph_frame_run(struct audio_module_graph *graph,
+			    struct audio_data const *const audio_data_rx)
+{
+	int ret;
+	struct audio_module_handle *handle;
+	struct audio_data const *rx;
+
+	for (int i = 0; i < graph->modules_num; i++) {
+		handle = graph->modules[i];
+		graph->output_valid[i] = false;
+
+		if (i == 0) {
+			rx = audio_data_rx;
+		} else if (graph->output_valid[graph->upstream[i]] && state_running(handle->state)) {
+			rx = &graph->outputs[graph->upstream[i]];
+		} else {
+			/* Nothing to process, as in a module that does not receive audio data. */
+			continue;
+		}
+
+		ret = graph_module_process(handle, rx, &graph->outputs[i]);
+		if (ret) {
+			LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+			continue;
+		}
+
+		graph->output_valid[i] = has_input_type(handle->description->type);
+	}
+
+	/* All modules have consumed the frame, so release the output audio data unless it is
+	 * returned on a TX FIFO.
+	 */
+	for (int i = 0; i < graph->modules_num; i++) {
+		if (!graph->output_valid[i]) {
+			continue;
+		}
+
+		handle = graph->modules[i];
+
+		if (handle->use_tx_queue && handle->thread.msg_tx) {
+			/* The semaphore counts the single audio data item on the TX FIFO. */
+			k_sem_init(&handle->sem, 1, 1);
+
+			ret = tx_fifo_put(handle, &graph->outputs[i]);
+			if (ret == 0) {
+				continue;
+			}
+
+			LOG_ERR("Failed to send audio data on module %s TX message queue",
+				handle->name);
+		}
+
+		k_mem_slab_free(handle->thread.data_slab, graph->outputs[i].data);
+	}
+}
+
+/**
+ * @brief The thread that runs all the modules of a graph.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ */
+static void graph_thread(struct audio_module_graph *graph, void *p2, void *p3)
+{
+	int ret;
+	struct audio_module_handle *head = graph->modules[0];
+	struct audio_module_message *msg_rx;
+	size_t size;
+
+	/* Execute thread. */
+	while (1) {
+		if (head->description->type == AUDIO_MODULE_TYPE_INPUT) {
+			/* The input module generates the data, so it controls the data flow. */
+			graph_frame_run(graph, NULL);
+			continue;
+		}
+
+		ret = data_fifo_pointer_last_filled_get(head->thread.msg_rx, (void **)&msg_rx,
+							&size, K_FOREVER);
+		__ASSERT(ret == 0, "Graph of %s error in getting last filled %d", head->name, ret);
+
+		graph_frame_run(graph, &msg_rx->audio_data);
+
+		if (msg_rx->response_cb != NULL) {
+			msg_rx->response_cb((struct audio_module_handle_private *)msg_rx->tx_handle,
+					    &msg_rx->audio_data);
+		}
+
+		data_fifo_block_free(head->thread.msg_rx, (void *)msg_rx);
+	}
+
+	CODE_UNREACHABLE;
+}
+
+/**
+ * @brief Add the modules connected to a module in the graph to the graph.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ * @param index  [in]      Index of the module in the graph.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int graph_destinations_add(struct audio_module_graph *graph, uint8_t index)
+{
+	int ret;
+	struct audio_module_handle *handle = graph->modules[index];
+	struct audio_module_handle *handle_to;
+
+	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
+	if (ret) {
+		LOG_ERR("Failed to take MUTEX lock in time");
+		return ret;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+		for (int i = 0; i < graph->modules_num; i++) {
+			if (graph->modules[i] == handle_to) {
+				LOG_ERR("Module %s is fed by more than one module", handle_to->name);
+				ret = -ENOTSUP;
+				goto unlock;
+			}
+		}
+
+		if (graph->modules_num == CONFIG_AUDIO_MODULE_GRAPH_MODULES_NUM) {
+			LOG_ERR("Too many modules in the graph");
+			ret = -ENOMEM;
+			goto unlock;
+		}
+
+		graph->modules[graph->modules_num] = handle_to;
+		graph->upstream[graph->modules_num] = index;
+		graph->modules_num++;
+	}
+
+unlock:
+	k_mutex_unlock(&handle->dest_mutex);
+
+	return ret;
+}
+
+int audio_module_graph_create(struct audio_module_graph *graph, struct audio_module_handle *head,
+			      k_thread_stack_t *stack, size_t stack_size, int priority)
+{
+	int ret;
+	struct audio_module_handle *handle;
+
+	if (graph == NULL || head == NULL || stack == NULL || stack_size == 0) {
+		LOG_ERR("Invalid parameter for the graph create function");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(head->state)) {
+		LOG_ERR("Module %s in an invalid state, %d, for a graph", head->name, head->state);
+		return -ECANCELED;
+	}
+
+	if (head->description->type != AUDIO_MODULE_TYPE_INPUT && head->thread.msg_rx == NULL) {
+		LOG_ERR("Module %s has no RX FIFO to feed the graph", head->name);
+		return -EINVAL;
+	}
+
+	memset(graph, 0, sizeof(struct audio_module_graph));
+
+	graph->modules[0] = head;
+	graph->modules_num = 1;
+
+	/* Visiting the modules breadth first gives a topological order, as each module is fed
+	 * by a single module.
+	 */
+	for (int i = 0; i < graph->modules_num; i++) {
+		ret = graph_destinations_add(graph, i);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	for (int i = 0; i < graph->modules_num; i++) {
+		handle = graph->modules[i];
+
+		if (handle->thread_id != NULL || in_graph(handle)) {
+			LOG_ERR("Module %s is already run by a thread or a graph", handle->name);
+			return -EBUSY;
+		}
+	}
+
+	for (int i = 0; i < graph->modules_num; i++) {
+		graph->modules[i]->graph = graph;
+	}
+
+	graph->thread_id = k_thread_create(&graph->thread_data, stack, stack_size,
+					   (k_thread_entry_t)graph_thread, (void *)graph, NULL,
+					   NULL, K_PRIO_PREEMPT(priority), 0, K_FOREVER);
+
+	(void)k_thread_name_set(graph->thread_id, "audio_module_graph");
+
+	k_thread_start(graph->thread_id);
+
+	LOG_DBG("Graph of %d module(s) started from module %s", graph->modules_num, head->name);
+
+	return 0;
+}
+
+int audio_module_graph_destroy(struct audio_module_graph *graph)
+{
+	if (graph == NULL) {
+		LOG_ERR("Graph is NULL");
+		return -EINVAL;
+	}
+
+	if (graph->thread_id == NULL) {
+		LOG_WRN("Graph is not running");
+		return -EALREADY;
+	}
+
+	k_thread_abort(graph->thread_id);
+
+	for (int i = 0; i < graph->modules_num; i++) {
+		graph->modules[i]->graph = NULL;
+	}
+
+	memset(graph, 0, sizeof(struct audio_module_graph));
+
+	return 0;
+}
+#endif /* defined(CONFIG_AUDIO_MODULE_GRAPH) */
+
 int audio_module_open(struct audio_module_parameters const *const parameters,
 		      struct audio_module_configuration const *const configuration,
 		      char const *const name, struct audio_module_context *context,
@@ -639,6 +940,15 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 	sys_slist_init(&handle->handle_dest_list);
 	k_mutex_init(&handle->dest_mutex);
 
+	if (handle->thread.stack == NULL) {
+		/* The module will be run by a graph executor. */
+		handle->state = AUDIO_MODULE_STATE_CONFIGURED;
+
+		LOG_DBG("Module %s opened without a thread", handle->name);
+
+		return 0;
+	}
+
 	handle->thread_id = k_thread_create(
 		&handle->thread_data, handle->thread.stack, handle->thread.stack_size, thread_entry,
 		(void *)handle, NULL, NULL, K_PRIO_PREEMPT(handle->thread.priority), 0, K_FOREVER);
@@ -676,6 +986,11 @@ int audio_module_close(struct audio_module_handle *handle)
 		return -ECANCELED;
 	}
 
+	if (in_graph(handle)) {
+		LOG_ERR("Module %s is part of a graph and cannot be closed", handle->name);
+		return -EBUSY;
+	}
+
 	if (handle->description->functions->close != NULL) {
 		ret = handle->description->functions->close(
 			(struct audio_module_handle_private *)handle);
@@ -698,7 +1013,9 @@ int audio_module_close(struct audio_module_handle *handle)
 	 *       Test the semaphore and wait for it to be zero.
 	 */
 
-	k_thread_abort(handle->thread_id);
+	if (handle->thread_id != NULL) {
+		k_thread_abort(handle->thread_id);
+	}
 
 	/* Ensure module handle data is fully cleared. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
@@ -819,6 +1136,11 @@ int audio_module_connect(struct audio_module_handle *handle_from,
 			LOG_WRN("A module is in an invalid state for connecting");
 			return -ECANCELED;
 		}
+
+		if (in_graph(handle_from) || in_graph(handle_to)) {
+			LOG_ERR("Connections between modules in a graph cannot be changed");
+			return -EBUSY;
+		}
 	}
 
 	ret = k_mutex_lock(&handle_from->dest_mutex, LOCK_TIMEOUT_US);
@@ -910,6 +1232,11 @@ int audio_module_disconnect(struct audio_module_handle *handle,
 			LOG_WRN("A module is in an invalid state for connecting");
 			return -ECANCELED;
 		}
+
+		if (in_graph(handle) || in_graph(handle_disconnect)) {
+			LOG_ERR("Connections between modules in a graph cannot be changed");
+			return -EBUSY;
+		}
 	}
 
 	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
@@ -1042,6 +1369,13 @@ int audio_module_data_tx(struct audio_module_handle *handle,
 		return -ECANCELED;
 	}
 
+#if defined(CONFIG_AUDIO_MODULE_GRAPH)
+	if (in_graph(handle) && handle != handle->graph->modules[0]) {
+		LOG_ERR("Module %s is fed by its graph", handle->name);
+		return -EBUSY;
+	}
+#endif /* defined(CONFIG_AUDIO_MODULE_GRAPH) */
+
 	if (audio_data == NULL) {
 		LOG_ERR("Output audio data for module %s has a NULL pointer", handle->name);
 		return -EINVAL;
@@ -5,6 +5,7 @@
  */
 
 #include <errno.h>
+#include <zephyr/kernel.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/random/random.h>
 #include <zephyr/bluetooth/bluetooth.h>
@@ -42,6 +43,10 @@ static const uint16_t fast_pair_uuid = BT_FAST_PAIR_UUID_FPS_VAL;
 static const uint8_t version_and_flags;
 static const uint8_t empty_account_key_list;
 
+/* The filter context is kept between calls, so it is shared by all callers. */
+static struct fp_crypto_account_key_filter_ctx ak_filter_ctx;
+static K_MUTEX_DEFINE(ak_filter_ctx_mutex);
+
 static int check_adv_config(struct bt_fast_pair_adv_config fp_adv_config)
 {
 	if ((fp_adv_config.mode >= BT_FAST_PAIR_ADV_MODE_COUNT) || (fp_adv_config.mode < 0)) {
@@ -202,6 +207,10 @@ static int fp_adv_data_fill_non_discoverable(struct net_buf_simple *buf, size_t
 	}
 
 	if (account_key_cnt == 0) {
+		/* Do not keep the removed Account Keys in RAM. */
+		k_mutex_lock(&ak_filter_ctx_mutex, K_FOREVER);
+		fp_crypto_account_key_filter_ctx_clear(&ak_filter_ctx);
+		k_mutex_unlock(&ak_filter_ctx_mutex);
 		net_buf_simple_add_u8(buf, empty_account_key_list);
 	} else {
 		struct fp_account_key ak[CONFIG_BT_FAST_PAIR_STORAGE_ACCOUNT_KEY_MAX];
@@ -229,9 +238,21 @@ static int fp_adv_data_fill_non_discoverable(struct net_buf_simple *buf, size_t
 		__ASSERT_NO_MSG(ak_filter_size <= BIT_MASK(LEN_BITS));
 		net_buf_simple_add_u8(buf, ENCODE_FIELD_LEN_TYPE(ak_filter_size, ak_filter_type));
 
-		err = fp_crypto_account_key_filter(net_buf_simple_add(buf, ak_filter_size), ak,
-						   account_key_cnt, salt,
-						   add_battery_info ? battery_info : NULL);
+		/* Only the Salt and battery info tail of the per-key hash inputs is updated here.
+		 * The per-key state is rebuilt only when the Account Key List changes.
+		 */
+		k_mutex_lock(&ak_filter_ctx_mutex, K_FOREVER);
+
+		err = fp_crypto_account_key_filter_ctx_keys_set(&ak_filter_ctx, ak,
+								account_key_cnt);
+		if (!err) {
+			err = fp_crypto_account_key_filter_ctx_compute(
+				&ak_filter_ctx, net_buf_simple_add(buf, ak_filter_size), salt,
+				add_battery_info ? battery_info : NULL);
+		}
+
+		k_mutex_unlock(&ak_filter_ctx_mutex);
+
 		if (err) {
 			return err;
 		}
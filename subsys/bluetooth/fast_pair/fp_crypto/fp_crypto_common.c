@@ -8,6 +8,7 @@
 #include <string.h>
 #include <limits.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/__assert.h>
 #include <zephyr/sys/byteorder.h>
 
 #include <zephyr/logging/log.h>
@@ -93,45 +94,147 @@ size_t fp_crypto_account_key_filter_size(size_t n)
 	}
 }
 
+static void account_key_filter_bits_set(uint8_t *out, size_t s, const uint8_t *h)
+{
+	uint32_t x;
+	uint32_t m;
+
+	for (size_t j = 0; j < FP_CRYPTO_SHA256_HASH_LEN / sizeof(x); j++) {
+		x = sys_get_be32(&h[j * sizeof(x)]);
+		m = x % (s * __CHAR_BIT__);
+		WRITE_BIT(out[m / __CHAR_BIT__], m % __CHAR_BIT__, 1);
+	}
+}
+
+static size_t account_key_filter_input_tail_set(uint8_t *v, uint16_t salt,
+						const uint8_t *battery_info)
+{
+	size_t pos = FP_ACCOUNT_KEY_LEN;
+
+	sys_put_be16(salt, &v[pos]);
+	pos += sizeof(salt);
+
+	if (battery_info) {
+		memcpy(&v[pos], battery_info, FP_CRYPTO_BATTERY_INFO_LEN);
+		pos += FP_CRYPTO_BATTERY_INFO_LEN;
+	}
+
+	return pos;
+}
+
 int fp_crypto_account_key_filter(uint8_t *out, const struct fp_account_key *account_key_list,
 				 size_t n, uint16_t salt, const uint8_t *battery_info)
 {
 	size_t s = fp_crypto_account_key_filter_size(n);
-	uint8_t v[FP_ACCOUNT_KEY_LEN + sizeof(salt) + FP_CRYPTO_BATTERY_INFO_LEN];
+	uint8_t v[FP_CRYPTO_ACCOUNT_KEY_FILTER_INPUT_LEN_MAX];
 	uint8_t h[FP_CRYPTO_SHA256_HASH_LEN];
-	uint32_t x;
-	uint32_t m;
 	int err;
 
 	memset(out, 0, s);
 	for (size_t i = 0; i < n; i++) {
-		size_t pos = 0;
+		size_t pos;
 
 		memcpy(v, account_key_list[i].key, FP_ACCOUNT_KEY_LEN);
-		pos += FP_ACCOUNT_KEY_LEN;
+		pos = account_key_filter_input_tail_set(v, salt, battery_info);
 
-		sys_put_be16(salt, &v[pos]);
-		pos += sizeof(salt);
+		err = fp_crypto_sha256(h, v, pos);
+		if (err) {
+			return err;
+		}
+
+		account_key_filter_bits_set(out, s, h);
+	}
+	return 0;
+}
 
-		if (battery_info) {
-			memcpy(&v[pos], battery_info, FP_CRYPTO_BATTERY_INFO_LEN);
-			pos += FP_CRYPTO_BATTERY_INFO_LEN;
+int fp_crypto_account_key_filter_ctx_keys_set(struct fp_crypto_account_key_filter_ctx *ctx,
+					      const struct fp_account_key *account_key_list,
+					      size_t n)
+{
+	if ((n == 0) || (n > ARRAY_SIZE(ctx->v))) {
+		return -EINVAL;
+	}
+
+	if (ctx->n == n) {
+		size_t i;
+
+		for (i = 0; i < n; i++) {
+			if (memcmp(ctx->v[i], account_key_list[i].key, FP_ACCOUNT_KEY_LEN)) {
+				break;
+			}
 		}
 
-		err = fp_crypto_sha256(h, v, pos);
+		if (i == n) {
+			/* Account Key List unchanged. */
+			return 0;
+		}
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		memcpy(ctx->v[i], account_key_list[i].key, FP_ACCOUNT_KEY_LEN);
+	}
+
+	ctx->n = n;
+	ctx->filter_valid = false;
+
+	return 0;
+}
+
+int fp_crypto_account_key_filter_ctx_compute(struct fp_crypto_account_key_filter_ctx *ctx,
+					     uint8_t *out, uint16_t salt,
+					     const uint8_t *battery_info)
+{
+	uint8_t tail[FP_CRYPTO_ACCOUNT_KEY_FILTER_INPUT_LEN_MAX];
+	uint8_t h[FP_CRYPTO_SHA256_HASH_LEN];
+	size_t s = fp_crypto_account_key_filter_size(ctx->n);
+	size_t tail_len;
+	size_t v_len;
+	int err;
+
+	if (ctx->n == 0) {
+		return -EINVAL;
+	}
+
+	__ASSERT_NO_MSG(s <= sizeof(ctx->filter));
+
+	v_len = account_key_filter_input_tail_set(tail, salt, battery_info);
+	tail_len = v_len - FP_ACCOUNT_KEY_LEN;
+
+	/* The Salt and battery info are the same for all Account Keys, so comparing with the hash
+	 * input of the first Account Key is enough to detect that nothing changed.
+	 */
+	if (ctx->filter_valid && (ctx->v_len == v_len) &&
+	    !memcmp(&ctx->v[0][FP_ACCOUNT_KEY_LEN], &tail[FP_ACCOUNT_KEY_LEN], tail_len)) {
+		memcpy(out, ctx->filter, s);
+		return 0;
+	}
+
+	ctx->filter_valid = false;
+	memset(ctx->filter, 0, s);
+
+	for (size_t i = 0; i < ctx->n; i++) {
+		memcpy(&ctx->v[i][FP_ACCOUNT_KEY_LEN], &tail[FP_ACCOUNT_KEY_LEN], tail_len);
+
+		err = fp_crypto_sha256(h, ctx->v[i], v_len);
 		if (err) {
 			return err;
 		}
 
-		for (size_t j = 0; j < FP_CRYPTO_SHA256_HASH_LEN / sizeof(x); j++) {
-			x = sys_get_be32(&h[j * sizeof(x)]);
-			m = x % (s * __CHAR_BIT__);
-			WRITE_BIT(out[m / __CHAR_BIT__], m % __CHAR_BIT__, 1);
-		}
+		account_key_filter_bits_set(ctx->filter, s, h);
 	}
+
+	ctx->v_len = v_len;
+	ctx->filter_valid = true;
+	memcpy(out, ctx->filter, s);
+
 	return 0;
 }
 
+void fp_crypto_account_key_filter_ctx_clear(struct fp_crypto_account_key_filter_ctx *ctx)
+{
+	memset(ctx, 0, sizeof(*ctx));
+}
+
 int fp_crypto_additional_data_encode(uint8_t *out_packet, const uint8_t *data, size_t data_len,
 				     const uint8_t *aes_key, const uint8_t *nonce)
 {
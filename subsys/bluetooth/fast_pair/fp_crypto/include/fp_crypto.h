@@ -50,6 +50,35 @@ extern "C" {
 #define FP_CRYPTO_ADDITIONAL_DATA_HEADER_LEN	16U
 /** Length of battery info (1-byte length and type field and 3-byte battery values field). */
 #define FP_CRYPTO_BATTERY_INFO_LEN		4U
+/** Max number of Account Keys in the Account Key Filter (limited by the field length). */
+#define FP_CRYPTO_ACCOUNT_KEY_FILTER_KEY_CNT_MAX	10U
+/** Max length of the Account Key Filter hash input (Account Key, Salt and battery info). */
+#define FP_CRYPTO_ACCOUNT_KEY_FILTER_INPUT_LEN_MAX \
+	(FP_ACCOUNT_KEY_LEN + sizeof(uint16_t) + FP_CRYPTO_BATTERY_INFO_LEN)
+/** Max length of the Account Key Filter. */
+#define FP_CRYPTO_ACCOUNT_KEY_FILTER_LEN_MAX \
+	((6 * FP_CRYPTO_ACCOUNT_KEY_FILTER_KEY_CNT_MAX) / 5 + 3)
+
+/** Account Key Filter context.
+ *
+ * The context keeps the Account Keys laid out as the per-key hash inputs together with the last
+ * computed Account Key Filter. The hash inputs are only rebuilt when the Account Key List
+ * changes and the filter is only recomputed when any of its inputs changes. The context stores
+ * Account Keys, so it must be cleared with @ref fp_crypto_account_key_filter_ctx_clear when no
+ * longer used.
+ */
+struct fp_crypto_account_key_filter_ctx {
+	/** Per-key hash inputs: Account Key followed by the Salt and optional battery info. */
+	uint8_t v[FP_CRYPTO_ACCOUNT_KEY_FILTER_KEY_CNT_MAX][FP_CRYPTO_ACCOUNT_KEY_FILTER_INPUT_LEN_MAX];
+	/** Last computed Account Key Filter. */
+	uint8_t filter[FP_CRYPTO_ACCOUNT_KEY_FILTER_LEN_MAX];
+	/** Number of Account Keys. */
+	uint8_t n;
+	/** Length of the per-key hash inputs used for the last computed filter. */
+	uint8_t v_len;
+	/** True if the last computed filter matches the current inputs. */
+	bool filter_valid;
+};
 
 /** Hash value using SHA-256.
  *
@@ -232,6 +261,48 @@ size_t fp_crypto_account_key_filter_size(size_t n);
 int fp_crypto_account_key_filter(uint8_t *out, const struct fp_account_key *account_key_list,
 				 size_t n, uint16_t salt, const uint8_t *battery_info);
 
+/** Set the Account Key List of the Account Key Filter context.
+ *
+ * The per-key state of the context is rebuilt only if the Account Key List differs from the one
+ * that was previously set.
+ *
+ * @param[in,out] ctx Account Key Filter context.
+ * @param[in] account_key_list Pointer to array of Account Keys.
+ * @param[in] n Number of Account Keys (1 <= n <= @ref FP_CRYPTO_ACCOUNT_KEY_FILTER_KEY_CNT_MAX).
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int fp_crypto_account_key_filter_ctx_keys_set(struct fp_crypto_account_key_filter_ctx *ctx,
+					      const struct fp_account_key *account_key_list,
+					      size_t n);
+
+/** Compute an Account Key Filter using the Account Key Filter context.
+ *
+ * The result is the same as for @ref fp_crypto_account_key_filter called with the Account Key
+ * List set in the context. Hashing is skipped if the Salt and battery info are the same as for
+ * the previous call and the Account Key List did not change in the meantime.
+ *
+ * @param[in,out] ctx Account Key Filter context with the Account Key List set.
+ * @param[out] out Buffer to receive Account Key Filter. Buffer size must be at least
+ *                 @ref fp_crypto_account_key_filter_size.
+ * @param[in] salt Random 2-byte value - Salt.
+ * @param[in] battery_info Battery info or NULL if there is no battery info. Length of battery info
+ *			   must be equal to @ref FP_CRYPTO_BATTERY_INFO_LEN.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int fp_crypto_account_key_filter_ctx_compute(struct fp_crypto_account_key_filter_ctx *ctx,
+					     uint8_t *out, uint16_t salt,
+					     const uint8_t *battery_info);
+
+/** Clear the Account Key Filter context.
+ *
+ * Zeroize the Account Keys and the filter held by the context.
+ *
+ * @param[out] ctx Account Key Filter context.
+ */
+void fp_crypto_account_key_filter_ctx_clear(struct fp_crypto_account_key_filter_ctx *ctx);
+
 /** Encode data to Additional Data packet.
  *
  * @param[out] out_packet Buffer to receive Additional Data packet. Buffer size must be at least
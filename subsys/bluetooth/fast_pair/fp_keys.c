@@ -115,6 +115,15 @@ static void disconnected(struct bt_conn *conn, uint8_t reason)
 	struct fp_procedure *proc = &fp_procedures[bt_conn_index(conn)];
 
 	invalidate_key(proc);
+
+	if (IS_ENABLED(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_WRITE_BACK)) {
+		int err;
+
+		err = fp_storage_ak_order_flush();
+		if (err) {
+			LOG_ERR("Unable to flush Account Key order (err %d)", err);
+		}
+	}
 }
 
 BT_CONN_CB_DEFINE(conn_callbacks) = {
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/settings/settings.h>
 #include <bluetooth/fast_pair/fast_pair.h>
@@ -49,6 +50,10 @@ static uint8_t account_key_metadata[ACCOUNT_KEY_CNT];
 static uint8_t account_key_count;
 
 static uint8_t account_key_order[ACCOUNT_KEY_CNT];
+static bool account_key_order_dirty;
+
+static void ak_order_save_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(ak_order_save_work, ak_order_save_work_handler);
 
 static int settings_set_err;
 static bool is_enabled;
@@ -274,6 +279,83 @@ static void ak_order_update_ram(uint8_t used_id)
 	account_key_order[0] = used_id;
 }
 
+static int ak_order_save(void)
+{
+	uint8_t order[ACCOUNT_KEY_CNT];
+	int err;
+
+	/* The copy is made before the potentially blocking Settings operation, so the saved
+	 * order is consistent even if it is updated in RAM in the meantime.
+	 */
+	memcpy(order, account_key_order, sizeof(order));
+	account_key_order_dirty = false;
+
+	if (IS_ENABLED(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_WRITE_BACK)) {
+		(void)k_work_cancel_delayable(&ak_order_save_work);
+	}
+
+	err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, order, sizeof(order));
+	if (err) {
+		account_key_order_dirty = true;
+	}
+
+	return err;
+}
+
+static void ak_order_save_work_handler(struct k_work *work)
+{
+	int err;
+
+	ARG_UNUSED(work);
+
+	if (!account_key_order_dirty) {
+		return;
+	}
+
+	err = ak_order_save();
+	if (err) {
+		LOG_ERR("Unable to save deferred Account Key order in Settings (err %d). "
+			"Retrying on the next flush.", err);
+	}
+}
+
+static void ak_order_used_save(void)
+{
+	int err;
+
+	if (IS_ENABLED(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_WRITE_BACK)) {
+		/* Only the usage order of already stored Account Keys changed here. The order
+		 * stored in Settings remains a valid permutation of the stored Account Key IDs,
+		 * so the write can be deferred without risking consistency on reset.
+		 */
+		account_key_order_dirty = true;
+		(void)k_work_reschedule(&ak_order_save_work,
+				K_MSEC(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_WRITE_BACK_DELAY));
+		return;
+	}
+
+	err = ak_order_save();
+	if (err) {
+		LOG_ERR("Unable to save new Account Key order in Settings. "
+			"Not propagating the error and keeping updated Account Key "
+			"order in RAM. After the Settings error the Account Key "
+			"order may change at reboot.");
+	}
+}
+
+int fp_storage_ak_order_flush(void)
+{
+	if (!is_enabled) {
+		return -EACCES;
+	}
+
+	if (!account_key_order_dirty) {
+		return 0;
+	}
+
+	return ak_order_save();
+}
+
 static int fp_settings_validate_ak_order(void)
 {
 	int err;
@@ -311,8 +393,7 @@ static int fp_settings_validate_ak_order(void)
 	}
 
 	if (ak_order_update_count > 0) {
-		err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
-					sizeof(account_key_order));
+		err = ak_order_save();
 		if (err) {
 			return err;
 		}
@@ -580,18 +661,9 @@ int fp_storage_ak_find(struct fp_account_key *account_key,
 
 	for (size_t i = 0; i < account_key_count; i++) {
 		if (account_key_check_cb(&account_key_list[i], context)) {
-			int err;
-
 			ak_order_update_ram(ACCOUNT_KEY_METADATA_FIELD_GET(account_key_metadata[i],
 									   ID));
-			err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
-						sizeof(account_key_order));
-			if (err) {
-				LOG_ERR("Unable to save new Account Key order in Settings. "
-					"Not propagating the error and keeping updated Account Key "
-					"order in RAM. After the Settings error the Account Key "
-					"order may change at reboot.");
-			}
+			ak_order_used_save();
 
 			if (account_key) {
 				*account_key = account_key_list[i];
@@ -738,9 +810,11 @@ int fp_storage_ak_save(const struct fp_account_key *account_key, const void *con
 		bond->conn_ctx = NULL;
 	}
 
+	/* The Account Key set changed, so the order is always saved immediately. This also
+	 * stores any pending deferred order update.
+	 */
 	ak_order_update_ram(id);
-	err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
-				sizeof(account_key_order));
+	err = ak_order_save();
 	if (err) {
 		LOG_ERR("Unable to save new Account Key order in Settings. "
 			"Not propagating the error and keeping updated Account Key "
@@ -972,6 +1046,12 @@ void fp_storage_ak_ram_clear(void)
 	account_key_count = 0;
 
 	memset(account_key_order, 0, sizeof(account_key_order));
+	account_key_order_dirty = false;
+
+	if (IS_ENABLED(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_WRITE_BACK)) {
+		/* Drop the pending deferred write without saving it. */
+		(void)k_work_cancel_delayable(&ak_order_save_work);
+	}
 
 	if (IS_ENABLED(CONFIG_BT_FAST_PAIR_STORAGE_AK_BOND)) {
 		memset(fp_bonds, 0, sizeof(fp_bonds));
@@ -1028,11 +1108,18 @@ static int fp_storage_ak_init(void)
 
 static int fp_storage_ak_uninit(void)
 {
+	int err;
+
 	if (!is_enabled) {
 		LOG_WRN("fp_storage_ak module already uninitialized");
 		return 0;
 	}
 
+	err = fp_storage_ak_order_flush();
+	if (err) {
+		LOG_ERR("Unable to flush Account Key order (err %d)", err);
+	}
+
 	is_enabled = false;
 
 	return 0;
@@ -92,6 +92,17 @@ int fp_storage_ak_get(struct fp_account_key *buf, size_t *key_count);
 int fp_storage_ak_find(struct fp_account_key *account_key,
 		       fp_storage_ak_check_cb account_key_check_cb, void *context);
 
+/** Save the pending Account Key usage order update.
+ *
+ *  If the CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_WRITE_BACK Kconfig option is enabled, the Account
+ *  Key usage order updated by @ref fp_storage_ak_find is not saved immediately. This function
+ *  saves the pending update, if there is any. The function is available only for the standard
+ *  Account Key storage backend.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int fp_storage_ak_order_flush(void);
+
 /** Check if a given Account Key belongs to the Owner.
  *
  *  The current implementation assumes that the Owner Account Key is the first Account Key
@@ -10,6 +10,15 @@
 
 #include <bluetooth/gatt_dm.h>
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#include <stdlib.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/byteorder.h>
+#endif
+
 LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 
 /* Available sizes: 128, 512, 2048... */
@@ -40,6 +49,66 @@ static int gatt_dm_wq_init(void)
 SYS_INIT(gatt_dm_wq_init, POST_KERNEL, CONFIG_BT_GATT_DM_WORKQ_INIT_PRIO);
 #endif
 
+static void dm_work_submit(struct k_work *work)
+{
+#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
+	k_work_submit_to_queue(&bt_gatt_dm_wq, work);
+#else
+	k_work_submit(work);
+#endif
+}
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#define CACHE_SETTINGS_SUBTREE "bt/dm_cache"
+#define CACHE_SETTINGS_KEY_LEN (sizeof(CACHE_SETTINGS_SUBTREE) + 4)
+
+/* Size of the Database Hash characteristic value */
+#define CACHE_HASH_LEN 16
+
+/* Size of the record header: length, start handle, end handle and attribute count */
+#define CACHE_RECORD_HDR_LEN 8
+
+/* Cached discovery results of a bonded peer, stored in settings.
+ *
+ * The data consists of records, one for each completed discovery. A record holds the start
+ * handle and the service UUID the discovery was started with, followed by the discovered
+ * attributes. The records are valid only as long as the Database Hash of the peer is unchanged.
+ */
+struct dm_cache_entry {
+	/* Identity address of the peer */
+	bt_addr_le_t addr;
+	/* Local identity of the bond */
+	uint8_t id;
+	/* Database Hash of the peer at the time of the discovery */
+	uint8_t hash[CACHE_HASH_LEN];
+	/* Used length of the record data */
+	uint16_t len;
+	/* Discovery records */
+	uint8_t data[CONFIG_BT_GATT_DM_CACHE_PEER_SIZE];
+};
+
+struct dm_cache_slot {
+	struct dm_cache_entry entry;
+	/* Value of the use counter when the entry was last used, for replacement */
+	uint32_t last_used;
+	bool valid;
+	bool dirty;
+};
+
+static struct dm_cache_slot cache_slots[CONFIG_BT_GATT_DM_CACHE_PEER_COUNT];
+static uint32_t cache_use_cnt;
+static struct bt_gatt_dm_cache_stats cache_stats;
+static struct k_work cache_save_work;
+static K_MUTEX_DEFINE(cache_lock);
+
+union dm_cache_uuid {
+	struct bt_uuid uuid;
+	struct bt_uuid_16 u16;
+	struct bt_uuid_32 u32;
+	struct bt_uuid_128 u128;
+};
+#endif /* defined(CONFIG_BT_GATT_DM_CACHE) */
+
 /* Flags for parsed attribute array state */
 enum {
 	STATE_ATTRS_LOCKED,
@@ -92,6 +161,26 @@ struct bt_gatt_dm {
 
 	/* Work item used for discovery callbacks. */
 	struct k_work discover_work;
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Work item used to serve discovery from the cache. */
+	struct k_work cache_work;
+	/* Parameters used to read the Database Hash of the peer. */
+	struct bt_gatt_read_params hash_read_params;
+	/* Database Hash of the peer. */
+	uint8_t hash[CACHE_HASH_LEN];
+	/* Identity of the bonded peer. */
+	bt_addr_le_t peer_addr;
+	uint8_t peer_id;
+	/* Indicates that the peer is bonded and its discovery can be cached. */
+	bool peer_bonded;
+	/* Indicates that the Database Hash was read from the peer. */
+	bool hash_valid;
+	/* Indicates that the results of the ongoing discovery should be cached. */
+	bool cache_pending;
+	/* Start handle of the ongoing discovery. */
+	uint16_t cache_start_handle;
+#endif
 };
 
 /* Currently only one instance is supported */
@@ -268,9 +357,498 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 	return NULL;
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+static struct dm_cache_slot *cache_slot_find(uint8_t id, const bt_addr_le_t *addr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_slots); i++) {
+		struct dm_cache_slot *slot = &cache_slots[i];
+
+		if (slot->valid && (slot->entry.id == id) && bt_addr_le_eq(&slot->entry.addr, addr)) {
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+
+static struct dm_cache_slot *cache_slot_alloc(uint8_t id, const bt_addr_le_t *addr)
+{
+	struct dm_cache_slot *slot = cache_slot_find(id, addr);
+
+	if (slot) {
+		return slot;
+	}
+
+	/* Use a free slot or replace the least recently used one. */
+	slot = &cache_slots[0];
+	for (size_t i = 0; i < ARRAY_SIZE(cache_slots); i++) {
+		if (!cache_slots[i].valid) {
+			slot = &cache_slots[i];
+			break;
+		}
+
+		if (cache_slots[i].last_used < slot->last_used) {
+			slot = &cache_slots[i];
+		}
+	}
+
+	memset(&slot->entry, 0, sizeof(slot->entry));
+	slot->entry.id = id;
+	bt_addr_le_copy(&slot->entry.addr, addr);
+	slot->valid = true;
+
+	return slot;
+}
+
+/* Stores the UUID as its length followed by its little-endian value. A NULL UUID has length 0. */
+static bool cache_uuid_add(struct net_buf_simple *buf, const struct bt_uuid *uuid)
+{
+	uint8_t len;
+
+	if (!uuid) {
+		len = 0;
+	} else if (uuid->type == BT_UUID_TYPE_16) {
+		len = BT_UUID_SIZE_16;
+	} else if (uuid->type == BT_UUID_TYPE_32) {
+		len = BT_UUID_SIZE_32;
+	} else if (uuid->type == BT_UUID_TYPE_128) {
+		len = BT_UUID_SIZE_128;
+	} else {
+		return false;
+	}
+
+	if (net_buf_simple_tailroom(buf) < sizeof(len) + len) {
+		return false;
+	}
+
+	net_buf_simple_add_u8(buf, len);
+
+	switch (len) {
+	case BT_UUID_SIZE_16:
+		net_buf_simple_add_le16(buf, BT_UUID_16(uuid)->val);
+		break;
+	case BT_UUID_SIZE_32:
+		net_buf_simple_add_le32(buf, BT_UUID_32(uuid)->val);
+		break;
+	case BT_UUID_SIZE_128:
+		net_buf_simple_add_mem(buf, BT_UUID_128(uuid)->val, len);
+		break;
+	default:
+		break;
+	}
+
+	return true;
+}
+
+/* Returns 1 if the UUID was decoded, 0 if a NULL UUID was stored or a negative error code. */
+static int cache_uuid_pull(struct net_buf_simple *buf, union dm_cache_uuid *uuid)
+{
+	uint8_t len;
+
+	if (buf->len < sizeof(len)) {
+		return -EINVAL;
+	}
+
+	len = net_buf_simple_pull_u8(buf);
+	if (len == 0) {
+		return 0;
+	}
+
+	if ((buf->len < len) || !bt_uuid_create(&uuid->uuid, buf->data, len)) {
+		return -EINVAL;
+	}
+
+	net_buf_simple_pull(buf, len);
+
+	return 1;
+}
+
+static bool cache_attr_add(struct net_buf_simple *buf, const struct bt_gatt_dm_attr *attr)
+{
+	const struct bt_gatt_service_val *service_val = bt_gatt_dm_attr_service_val(attr);
+	const struct bt_gatt_chrc *chrc = bt_gatt_dm_attr_chrc_val(attr);
+
+	if (net_buf_simple_tailroom(buf) < sizeof(uint16_t) + sizeof(uint8_t)) {
+		return false;
+	}
+
+	net_buf_simple_add_le16(buf, attr->handle);
+	net_buf_simple_add_u8(buf, attr->perm);
+
+	if (!cache_uuid_add(buf, attr->uuid)) {
+		return false;
+	}
+
+	if (service_val) {
+		if (net_buf_simple_tailroom(buf) < sizeof(uint16_t)) {
+			return false;
+		}
+
+		net_buf_simple_add_le16(buf, service_val->end_handle);
+
+		return cache_uuid_add(buf, service_val->uuid);
+	}
+
+	if (chrc) {
+		if (net_buf_simple_tailroom(buf) < sizeof(uint16_t) + sizeof(uint8_t)) {
+			return false;
+		}
+
+		net_buf_simple_add_le16(buf, chrc->value_handle);
+		net_buf_simple_add_u8(buf, chrc->properties);
+
+		return cache_uuid_add(buf, chrc->uuid);
+	}
+
+	return true;
+}
+
+static int cache_attr_load(struct bt_gatt_dm *dm, struct net_buf_simple *buf)
+{
+	union dm_cache_uuid uuid;
+	union dm_cache_uuid val_uuid;
+	struct bt_gatt_attr attr = {.uuid = &uuid.uuid};
+	struct bt_gatt_dm_attr *cur_attr;
+
+	if (buf->len < sizeof(uint16_t) + sizeof(uint8_t)) {
+		return -EINVAL;
+	}
+
+	attr.handle = net_buf_simple_pull_le16(buf);
+	attr.perm = net_buf_simple_pull_u8(buf);
+
+	if (cache_uuid_pull(buf, &uuid) <= 0) {
+		return -EINVAL;
+	}
+
+	if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_PRIMARY) ||
+	    !bt_uuid_cmp(attr.uuid, BT_UUID_GATT_SECONDARY)) {
+		struct bt_gatt_service_val *service_val;
+		uint16_t end_handle;
+
+		if (buf->len < sizeof(uint16_t)) {
+			return -EINVAL;
+		}
+
+		end_handle = net_buf_simple_pull_le16(buf);
+		if (cache_uuid_pull(buf, &val_uuid) <= 0) {
+			return -EINVAL;
+		}
+
+		cur_attr = attr_store(dm, &attr, sizeof(*service_val));
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+
+		service_val = bt_gatt_dm_attr_service_val(cur_attr);
+		service_val->end_handle = end_handle;
+		service_val->uuid = uuid_store(dm, &val_uuid.uuid);
+
+		return service_val->uuid ? 0 : -ENOMEM;
+	}
+
+	if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_CHRC)) {
+		struct bt_gatt_chrc *chrc;
+		uint16_t value_handle;
+		uint8_t properties;
+
+		if (buf->len < sizeof(uint16_t) + sizeof(uint8_t)) {
+			return -EINVAL;
+		}
+
+		value_handle = net_buf_simple_pull_le16(buf);
+		properties = net_buf_simple_pull_u8(buf);
+		if (cache_uuid_pull(buf, &val_uuid) <= 0) {
+			return -EINVAL;
+		}
+
+		cur_attr = attr_store(dm, &attr, sizeof(*chrc));
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+		chrc->value_handle = value_handle;
+		chrc->properties = properties;
+		chrc->uuid = uuid_store(dm, &val_uuid.uuid);
+
+		return chrc->uuid ? 0 : -ENOMEM;
+	}
+
+	return attr_store(dm, &attr, 0) ? 0 : -ENOMEM;
+}
+
+static bool cache_record_add(struct net_buf_simple *buf, const struct bt_gatt_dm *dm)
+{
+	uint8_t *hdr;
+
+	if (net_buf_simple_tailroom(buf) < CACHE_RECORD_HDR_LEN) {
+		return false;
+	}
+
+	hdr = net_buf_simple_add(buf, CACHE_RECORD_HDR_LEN);
+
+	if (!cache_uuid_add(buf, dm->search_svc_by_uuid ? &dm->svc_uuid.uuid : NULL)) {
+		return false;
+	}
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		if (!cache_attr_add(buf, &dm->attrs[i])) {
+			return false;
+		}
+	}
+
+	sys_put_le16(buf->len, &hdr[0]);
+	sys_put_le16(dm->cache_start_handle, &hdr[2]);
+	sys_put_le16(dm->discover_params.end_handle, &hdr[4]);
+	sys_put_le16(dm->cur_attr_id, &hdr[6]);
+
+	return true;
+}
+
+/* Returns the number of loaded attributes, or -ENOENT if the record is for another discovery. */
+static int cache_record_load(struct bt_gatt_dm *dm, struct net_buf_simple *buf)
+{
+	const struct bt_uuid *svc_uuid = dm->search_svc_by_uuid ? &dm->svc_uuid.uuid : NULL;
+	union dm_cache_uuid uuid;
+	uint16_t start_handle;
+	uint16_t end_handle;
+	uint16_t attr_cnt;
+	int err;
+
+	(void)net_buf_simple_pull_le16(buf);
+	start_handle = net_buf_simple_pull_le16(buf);
+	end_handle = net_buf_simple_pull_le16(buf);
+	attr_cnt = net_buf_simple_pull_le16(buf);
+
+	err = cache_uuid_pull(buf, &uuid);
+	if (err < 0) {
+		return err;
+	}
+
+	if ((start_handle != dm->cache_start_handle) || ((err == 0) != (svc_uuid == NULL)) ||
+	    (svc_uuid && bt_uuid_cmp(svc_uuid, &uuid.uuid))) {
+		return -ENOENT;
+	}
+
+	for (size_t i = 0; i < attr_cnt; i++) {
+		err = cache_attr_load(dm, buf);
+		if (err) {
+			return err;
+		}
+	}
+
+	dm->discover_params.end_handle = end_handle;
+
+	return attr_cnt;
+}
+
+/* Fills the instance with the cached results of the discovery.
+ *
+ * Returns the number of attributes of the discovered service or a negative error code if
+ * the discovery must be done with the peer.
+ */
+static int cache_load(struct bt_gatt_dm *dm)
+{
+	struct dm_cache_slot *slot;
+	struct net_buf_simple buf;
+	int ret = -ENOENT;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	slot = cache_slot_find(dm->peer_id, &dm->peer_addr);
+
+	if (slot && dm->hash_valid && !memcmp(slot->entry.hash, dm->hash, sizeof(dm->hash))) {
+		net_buf_simple_init_with_data(&buf, slot->entry.data, slot->entry.len);
+
+		while (buf.len >= CACHE_RECORD_HDR_LEN) {
+			struct net_buf_simple record;
+			uint16_t record_len = sys_get_le16(buf.data);
+
+			if ((record_len < CACHE_RECORD_HDR_LEN) || (record_len > buf.len)) {
+				ret = -EINVAL;
+				break;
+			}
+
+			net_buf_simple_init_with_data(&record,
+						      net_buf_simple_pull_mem(&buf, record_len),
+						      record_len);
+
+			ret = cache_record_load(dm, &record);
+			if (ret != -ENOENT) {
+				break;
+			}
+		}
+
+		if (ret == -EINVAL) {
+			LOG_WRN("Invalid cache entry, dropping it");
+			slot->entry.len = 0;
+			slot->dirty = true;
+			dm_work_submit(&cache_save_work);
+		} else if (ret >= 0) {
+			slot->last_used = ++cache_use_cnt;
+		}
+	}
+
+	if (ret >= 0) {
+		cache_stats.hits++;
+	} else {
+		cache_stats.misses++;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return ret;
+}
+
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	struct dm_cache_slot *slot;
+	struct net_buf_simple buf;
+	uint8_t *data;
+	size_t len;
+
+	dm->cache_pending = false;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	slot = cache_slot_alloc(dm->peer_id, &dm->peer_addr);
+	slot->last_used = ++cache_use_cnt;
+
+	if (memcmp(slot->entry.hash, dm->hash, sizeof(dm->hash))) {
+		/* The peer database changed, the records are no longer valid. */
+		memcpy(slot->entry.hash, dm->hash, sizeof(dm->hash));
+		slot->entry.len = 0;
+		slot->dirty = true;
+	}
+
+	data = &slot->entry.data[slot->entry.len];
+	len = sizeof(slot->entry.data) - slot->entry.len;
+	net_buf_simple_init_with_data(&buf, data, len);
+	net_buf_simple_reset(&buf);
+
+	if (cache_record_add(&buf, dm)) {
+		LOG_DBG("Cached %zu attributes", dm->cur_attr_id);
+		slot->entry.len += buf.len;
+		slot->dirty = true;
+	} else {
+		LOG_DBG("No space in cache for %zu attributes", dm->cur_attr_id);
+	}
+
+	if (slot->dirty) {
+		dm_work_submit(&cache_save_work);
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+static void cache_save(struct k_work *work)
+{
+	char key[CACHE_SETTINGS_KEY_LEN];
+	int err;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_slots); i++) {
+		struct dm_cache_slot *slot = &cache_slots[i];
+
+		if (!slot->valid || !slot->dirty) {
+			continue;
+		}
+
+		snprintk(key, sizeof(key), CACHE_SETTINGS_SUBTREE "/%zu", i);
+		err = settings_save_one(key, &slot->entry,
+					offsetof(struct dm_cache_entry, data) + slot->entry.len);
+		if (err) {
+			LOG_WRN("Failed to store cache entry %zu, err: %d", i, err);
+		}
+
+		slot->dirty = false;
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+static int cache_settings_set(const char *key, size_t len, settings_read_cb read_cb,
+			      void *cb_arg)
+{
+	unsigned long index = strtoul(key, NULL, 10);
+	struct dm_cache_slot *slot;
+	ssize_t size;
+
+	if ((index >= ARRAY_SIZE(cache_slots)) || (len > sizeof(slot->entry))) {
+		LOG_DBG("Ignoring cache entry %s", key);
+		return 0;
+	}
+
+	slot = &cache_slots[index];
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	size = read_cb(cb_arg, &slot->entry, sizeof(slot->entry));
+	slot->valid = (size >= (ssize_t)offsetof(struct dm_cache_entry, data)) &&
+		      (slot->entry.len == size - offsetof(struct dm_cache_entry, data));
+	slot->dirty = false;
+
+	k_mutex_unlock(&cache_lock);
+
+	if (!slot->valid) {
+		LOG_WRN("Invalid cache entry %s", key);
+	}
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bt_gatt_dm_cache, CACHE_SETTINGS_SUBTREE, NULL,
+			       cache_settings_set, NULL, NULL);
+
+static void cache_bond_deleted(uint8_t id, const bt_addr_le_t *peer)
+{
+	char key[CACHE_SETTINGS_KEY_LEN];
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_slots); i++) {
+		struct dm_cache_slot *slot = &cache_slots[i];
+
+		if (!slot->valid || (slot->entry.id != id) ||
+		    (!bt_addr_le_eq(peer, BT_ADDR_LE_ANY) &&
+		     !bt_addr_le_eq(&slot->entry.addr, peer))) {
+			continue;
+		}
+
+		slot->valid = false;
+		slot->dirty = false;
+
+		snprintk(key, sizeof(key), CACHE_SETTINGS_SUBTREE "/%zu", i);
+		(void)settings_delete(key);
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+static struct bt_conn_auth_info_cb cache_auth_info_cb = {
+	.bond_deleted = cache_bond_deleted,
+};
+
+static int gatt_dm_cache_init(void)
+{
+	k_work_init(&cache_save_work, cache_save);
+
+	return bt_conn_auth_info_cb_register(&cache_auth_info_cb);
+}
+
+SYS_INIT(gatt_dm_cache_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* defined(CONFIG_BT_GATT_DM_CACHE) */
+
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->cache_pending) {
+		cache_store(dm);
+	}
+#endif
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
@@ -281,6 +859,12 @@ static void discovery_complete_not_found(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discover complete. No service found.");
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->cache_pending) {
+		cache_store(dm);
+	}
+#endif
+
 	svc_attr_memory_release(dm);
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 
@@ -291,6 +875,9 @@ static void discovery_complete_not_found(struct bt_gatt_dm *dm)
 
 static void discovery_complete_error(struct bt_gatt_dm *dm, int err)
 {
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	dm->cache_pending = false;
+#endif
 	svc_attr_memory_release(dm);
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 	if (dm->callback->error_found) {
@@ -315,6 +902,107 @@ static void gatt_discover_work(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+static void cache_discover_work(struct k_work *work)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(work, struct bt_gatt_dm, cache_work);
+	int attr_cnt;
+	int err;
+
+	if (!atomic_test_bit(dm->state_flags, STATE_ATTRS_LOCKED)) {
+		LOG_WRN("Attributes not locked");
+		return;
+	}
+
+	attr_cnt = cache_load(dm);
+	if (attr_cnt > 0) {
+		discovery_complete(dm);
+		return;
+	} else if (attr_cnt == 0) {
+		discovery_complete_not_found(dm);
+		return;
+	}
+
+	/* Drop the attributes loaded before the cached record turned out to be unusable,
+	 * for example because they did not fit in the instance.
+	 */
+	svc_attr_memory_release(dm);
+
+	/* Results can be cached only if they are bound to the current peer database. */
+	dm->cache_pending = dm->hash_valid;
+
+	err = bt_gatt_discover(dm->conn, &dm->discover_params);
+	if (err) {
+		LOG_ERR("Discover failed, error: %d.", err);
+		discovery_complete_error(dm, err);
+	}
+}
+
+static uint8_t cache_hash_read_cb(struct bt_conn *conn, uint8_t err,
+				  struct bt_gatt_read_params *params,
+				  const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm, hash_read_params);
+
+	if (!err && data && (length == sizeof(dm->hash))) {
+		memcpy(dm->hash, data, sizeof(dm->hash));
+		dm->hash_valid = true;
+	} else {
+		LOG_DBG("Database Hash not available, err: %u", err);
+	}
+
+	dm_work_submit(&dm->cache_work);
+
+	return BT_GATT_ITER_STOP;
+}
+
+/* Reads the Database Hash of a bonded peer, to validate its cached discovery results. */
+static int cache_hash_read(struct bt_gatt_dm *dm)
+{
+	struct bt_conn_info info;
+	int err;
+
+	dm->peer_bonded = false;
+	dm->hash_valid = false;
+	dm->cache_pending = false;
+
+	err = bt_conn_get_info(dm->conn, &info);
+	if (err) {
+		return err;
+	}
+
+	if ((info.type != BT_CONN_TYPE_LE) || !bt_le_bond_exists(info.id, info.le.dst)) {
+		return -ENOENT;
+	}
+
+	dm->peer_id = info.id;
+	bt_addr_le_copy(&dm->peer_addr, info.le.dst);
+	dm->peer_bonded = true;
+
+	dm->hash_read_params.func = cache_hash_read_cb;
+	dm->hash_read_params.handle_count = 0;
+	dm->hash_read_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+	dm->hash_read_params.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	dm->hash_read_params.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+
+	err = bt_gatt_read(dm->conn, &dm->hash_read_params);
+	if (err) {
+		LOG_WRN("Database Hash read failed, error: %d.", err);
+		dm->peer_bonded = false;
+		return err;
+	}
+
+	return 0;
+}
+
+void bt_gatt_dm_cache_stats_get(struct bt_gatt_dm_cache_stats *stats)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	*stats = cache_stats;
+	k_mutex_unlock(&cache_lock);
+}
+#endif /* defined(CONFIG_BT_GATT_DM_CACHE) */
+
 static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 				      const struct bt_gatt_attr *attr,
 				      struct bt_gatt_discover_params *params)
@@ -373,11 +1061,7 @@ static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 	dm->discover_params.start_handle = cur_attr->handle + 1;
 	LOG_DBG("Starting descriptors discovery");
 
-#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
-	k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
-#else
-	k_work_submit(&dm->discover_work);
-#endif
+	dm_work_submit(&dm->discover_work);
 
 	return BT_GATT_ITER_STOP;
 }
@@ -396,11 +1080,7 @@ static uint8_t discovery_process_attribute(struct bt_gatt_dm *dm,
 			dm->discover_params.type =
 				BT_GATT_DISCOVER_CHARACTERISTIC;
 
-#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
-			k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
-#else
-			k_work_submit(&dm->discover_work);
-#endif
+			dm_work_submit(&dm->discover_work);
 		} else {
 			discovery_complete(dm);
 		}
@@ -679,6 +1359,16 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	k_work_init(&dm->discover_work, gatt_discover_work);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	k_work_init(&dm->cache_work, cache_discover_work);
+	dm->cache_start_handle = dm->discover_params.start_handle;
+
+	if (!cache_hash_read(dm)) {
+		/* Discovery continues when the Database Hash is read. */
+		return 0;
+	}
+#endif
+
 	err = bt_gatt_discover(conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -722,6 +1412,14 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	dm->discover_params.uuid = dm->search_svc_by_uuid ? &dm->svc_uuid.uuid : NULL;
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->peer_bonded) {
+		dm->cache_start_handle = dm->discover_params.start_handle;
+		dm_work_submit(&dm->cache_work);
+		return 0;
+	}
+#endif
+
 	err = bt_gatt_discover(dm->conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -740,6 +1438,9 @@ int bt_gatt_dm_data_release(struct bt_gatt_dm *dm)
 	}
 
 	k_work_cancel(&dm->discover_work);
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	k_work_cancel(&dm->cache_work);
+#endif
 	svc_attr_memory_release(dm);
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 
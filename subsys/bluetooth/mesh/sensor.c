@@ -241,6 +241,64 @@ int sensor_status_encode(struct net_buf_simple *buf,
 	return sensor_value_encode(buf, type, values);
 }
 
+int bt_mesh_sensor_status_decode(struct net_buf_simple *buf,
+				 struct bt_mesh_sensor_data *sensors,
+				 uint32_t *count)
+{
+	struct bt_mesh_sensor_value discard[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+	uint32_t decoded = 0;
+	bool truncated = false;
+
+	while (buf->len) {
+		const struct bt_mesh_sensor_type *type;
+		struct bt_mesh_sensor_value *value;
+		uint8_t length;
+		uint16_t id;
+		int err;
+
+		sensor_status_id_decode(buf, &length, &id);
+		if (length == 0) {
+			/* The sensor has no data. */
+			continue;
+		}
+
+		if (buf->len < length) {
+			return -EMSGSIZE;
+		}
+
+		type = bt_mesh_sensor_type_get(id);
+		if (!type) {
+			net_buf_simple_pull(buf, length);
+			continue;
+		}
+
+		if (length != sensor_value_len(type)) {
+			return -EMSGSIZE;
+		}
+
+		if (decoded < *count) {
+			/* Decode straight into the output to avoid copying
+			 * the channels afterwards.
+			 */
+			sensors[decoded].type = type;
+			value = sensors[decoded].value;
+			decoded++;
+		} else {
+			value = discard;
+			truncated = true;
+		}
+
+		err = sensor_value_decode(buf, type, value);
+		if (err) {
+			return err;
+		}
+	}
+
+	*count = decoded;
+
+	return truncated ? -ENOBUFS : 0;
+}
+
 const struct bt_mesh_sensor_format *
 bt_mesh_sensor_column_format_get(const struct bt_mesh_sensor_type *type)
 {
@@ -7,6 +7,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "sensor.h"
+#include <zephyr/init.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/toolchain.h>
 #include <bluetooth/mesh/properties.h>
@@ -1761,8 +1762,87 @@ SENSOR_TYPE(total_dev_runtime) = {
 
 /******************************************************************************/
 
+#ifdef CONFIG_BT_MESH_SENSOR_TYPE_INDEX
+/* Section indices of all known sensor types, sorted by Device Property ID.
+ * Populated once at boot, and only read afterwards.
+ */
+static uint16_t type_index[CONFIG_BT_MESH_SENSOR_TYPE_INDEX_SIZE];
+static size_t type_index_count;
+
+static const struct bt_mesh_sensor_type *type_at(size_t i)
+{
+	const struct bt_mesh_sensor_type *type;
+
+	STRUCT_SECTION_GET(bt_mesh_sensor_type, type_index[i], &type);
+	return type;
+}
+
+static int sensor_type_index_init(void)
+{
+	size_t count;
+
+	STRUCT_SECTION_COUNT(bt_mesh_sensor_type, &count);
+	if (count > ARRAY_SIZE(type_index)) {
+		/* Leave the index empty, and fall back to the linear search. */
+		return 0;
+	}
+
+	/* Stable insertion sort, so that the first type in the section wins if
+	 * several types share an ID, as with the linear search.
+	 */
+	for (size_t i = 0; i < count; i++) {
+		const struct bt_mesh_sensor_type *type;
+		size_t j = i;
+
+		STRUCT_SECTION_GET(bt_mesh_sensor_type, i, &type);
+
+		while (j > 0 && type_at(j - 1)->id > type->id) {
+			type_index[j] = type_index[j - 1];
+			j--;
+		}
+
+		type_index[j] = i;
+	}
+
+	type_index_count = count;
+
+	return 0;
+}
+
+SYS_INIT(sensor_type_index_init, PRE_KERNEL_1, 0);
+
+static const struct bt_mesh_sensor_type *sensor_type_index_find(uint16_t id)
+{
+	size_t lo = 0;
+	size_t hi = type_index_count;
+
+	/* Lower bound search, returning the first type with the given ID. */
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (type_at(mid)->id < id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if (lo < type_index_count && type_at(lo)->id == id) {
+		return type_at(lo);
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_BT_MESH_SENSOR_TYPE_INDEX */
+
 const struct bt_mesh_sensor_type *bt_mesh_sensor_type_get(uint16_t id)
 {
+#ifdef CONFIG_BT_MESH_SENSOR_TYPE_INDEX
+	if (type_index_count) {
+		return sensor_type_index_find(id);
+	}
+#endif
+
 	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
 		if (type->id == id) {
 			return type;
@@ -18,6 +18,26 @@
 
 static K_MUTEX_DEFINE(bt_rpc_conn_mutex);
 
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+/* Connection information kept on the client. The cache is invalidated by the connection
+ * callbacks that the host forwards to the client, see bt_conn_info_cache_invalidate().
+ */
+struct bt_conn_info_cache {
+	/* Incremented on each invalidation to drop responses that raced with an event. */
+	uint32_t generation;
+	bool info_valid;
+	struct bt_conn_info info;
+#if defined(CONFIG_BT_SMP)
+	bool security_valid;
+	bt_security_t security;
+	bool enc_key_size_valid;
+	uint8_t enc_key_size;
+#endif /* defined(CONFIG_BT_SMP) */
+};
+
+static uint32_t conn_info_cache_hits;
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
+
 struct bt_conn {
 	atomic_t ref;
 	uint8_t features[8];
@@ -35,10 +55,46 @@ struct bt_conn {
 	struct bt_le_oob_sc_data oobd_local;
 	struct bt_le_oob_sc_data oobd_remote;
 #endif /* defined(CONFIG_BT_SMP) && !defined(CONFIG_BT_SMP_OOB_LEGACY_PAIR_ONLY) */
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	struct bt_conn_info_cache cache;
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
 };
 
 static struct bt_conn connections[CONFIG_BT_MAX_CONN];
 
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+static void bt_conn_info_cache_invalidate(struct bt_conn *conn)
+{
+	if (!conn) {
+		return;
+	}
+
+	LOCK_CONN_INFO();
+	conn->cache.generation++;
+	conn->cache.info_valid = false;
+#if defined(CONFIG_BT_SMP)
+	conn->cache.security_valid = false;
+	conn->cache.enc_key_size_valid = false;
+#endif /* defined(CONFIG_BT_SMP) */
+	UNLOCK_CONN_INFO();
+}
+
+uint32_t bt_rpc_conn_info_cache_hits(void)
+{
+	uint32_t hits;
+
+	LOCK_CONN_INFO();
+	hits = conn_info_cache_hits;
+	UNLOCK_CONN_INFO();
+
+	return hits;
+}
+#else
+static inline void bt_conn_info_cache_invalidate(struct bt_conn *conn)
+{
+}
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
+
 static inline uint8_t get_conn_index(const struct bt_conn *conn)
 {
 	return (uint8_t)(conn - connections);
@@ -360,6 +416,23 @@ int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
 	struct nrf_rpc_cbor_ctx ctx;
 	struct bt_conn_get_info_rpc_res result;
 	size_t buffer_size_max = 3;
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	struct bt_conn *cached_conn = (struct bt_conn *)conn;
+	uint32_t generation = 0;
+
+	if (cached_conn) {
+		LOCK_CONN_INFO();
+		if (cached_conn->cache.info_valid) {
+			*info = cached_conn->cache.info;
+			conn_info_cache_hits++;
+			UNLOCK_CONN_INFO();
+			return 0;
+		}
+
+		generation = cached_conn->cache.generation;
+		UNLOCK_CONN_INFO();
+	}
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
 
 	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
 
@@ -371,6 +444,20 @@ int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
 	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_CONN_GET_INFO_RPC_CMD,
 				&ctx, bt_conn_get_info_rpc_rsp, &result);
 
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	/* The state of a connection that is being established or terminated changes without
+	 * an event, so only the information about an established connection is cached.
+	 */
+	if (cached_conn && result.result == 0 && info->state == BT_CONN_STATE_CONNECTED) {
+		LOCK_CONN_INFO();
+		if (cached_conn->cache.generation == generation) {
+			cached_conn->cache.info = *info;
+			cached_conn->cache.info_valid = true;
+		}
+		UNLOCK_CONN_INFO();
+	}
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
+
 	return result.result;
 }
 
@@ -536,6 +623,9 @@ int bt_conn_disconnect(struct bt_conn *conn, uint8_t reason)
 	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_CONN_DISCONNECT_RPC_CMD,
 				&ctx, nrf_rpc_rsp_decode_i32, &result);
 
+	/* The connection is in the disconnecting state until the disconnected callback. */
+	bt_conn_info_cache_invalidate(conn);
+
 	return result;
 }
 
@@ -669,6 +759,21 @@ bt_security_t bt_conn_get_security(const struct bt_conn *conn)
 	struct nrf_rpc_cbor_ctx ctx;
 	struct bt_conn_get_security_rpc_res result;
 	size_t buffer_size_max = 3;
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	struct bt_conn *cached_conn = (struct bt_conn *)conn;
+	uint32_t generation;
+
+	LOCK_CONN_INFO();
+	if (cached_conn->cache.security_valid) {
+		result.result = cached_conn->cache.security;
+		conn_info_cache_hits++;
+		UNLOCK_CONN_INFO();
+		return result.result;
+	}
+
+	generation = cached_conn->cache.generation;
+	UNLOCK_CONN_INFO();
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
 
 	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
 
@@ -677,6 +782,16 @@ bt_security_t bt_conn_get_security(const struct bt_conn *conn)
 	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_CONN_GET_SECURITY_RPC_CMD,
 				&ctx, bt_conn_get_security_rpc_rsp, &result);
 
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	/* The security level only changes with the security changed callback. */
+	LOCK_CONN_INFO();
+	if (cached_conn->cache.generation == generation) {
+		cached_conn->cache.security = result.result;
+		cached_conn->cache.security_valid = true;
+	}
+	UNLOCK_CONN_INFO();
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
+
 	return result.result;
 }
 
@@ -685,6 +800,21 @@ uint8_t bt_conn_enc_key_size(const struct bt_conn *conn)
 	struct nrf_rpc_cbor_ctx ctx;
 	uint8_t result;
 	size_t buffer_size_max = 3;
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	struct bt_conn *cached_conn = (struct bt_conn *)conn;
+	uint32_t generation;
+
+	LOCK_CONN_INFO();
+	if (cached_conn->cache.enc_key_size_valid) {
+		result = cached_conn->cache.enc_key_size;
+		conn_info_cache_hits++;
+		UNLOCK_CONN_INFO();
+		return result;
+	}
+
+	generation = cached_conn->cache.generation;
+	UNLOCK_CONN_INFO();
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
 
 	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
 
@@ -693,6 +823,15 @@ uint8_t bt_conn_enc_key_size(const struct bt_conn *conn)
 	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_CONN_ENC_KEY_SIZE_RPC_CMD,
 				&ctx, nrf_rpc_rsp_decode_u8, &result);
 
+#if defined(CONFIG_BT_RPC_CONN_INFO_CACHE)
+	LOCK_CONN_INFO();
+	if (cached_conn->cache.generation == generation) {
+		cached_conn->cache.enc_key_size = result;
+		cached_conn->cache.enc_key_size_valid = true;
+	}
+	UNLOCK_CONN_INFO();
+#endif /* defined(CONFIG_BT_RPC_CONN_INFO_CACHE) */
+
 	return result;
 }
 #endif /* defined(CONFIG_BT_SMP) */
@@ -730,6 +869,7 @@ static void bt_conn_cb_connected_call_rpc_handler(const struct nrf_rpc_group *gr
 		goto decoding_error;
 	}
 
+	bt_conn_info_cache_invalidate(conn);
 	bt_conn_cb_connected_call(conn, err);
 
 	nrf_rpc_rsp_send_void(group);
@@ -773,6 +913,7 @@ static void bt_conn_cb_disconnected_call_rpc_handler(const struct nrf_rpc_group
 		goto decoding_error;
 	}
 
+	bt_conn_info_cache_invalidate(conn);
 	bt_conn_cb_disconnected_call(conn, reason);
 
 	nrf_rpc_rsp_send_void(group);
@@ -905,6 +1046,7 @@ static void bt_conn_cb_le_param_updated_call_rpc_handler(const struct nrf_rpc_gr
 		goto decoding_error;
 	}
 
+	bt_conn_info_cache_invalidate(conn);
 	bt_conn_cb_le_param_updated_call(conn, interval, latency, timeout);
 
 	nrf_rpc_rsp_send_void(group);
@@ -955,6 +1097,7 @@ static void bt_conn_cb_identity_resolved_call_rpc_handler(const struct nrf_rpc_g
 		goto decoding_error;
 	}
 
+	bt_conn_info_cache_invalidate(conn);
 	bt_conn_cb_identity_resolved_call(conn, rpa, identity);
 
 	nrf_rpc_rsp_send_void(group);
@@ -1004,6 +1147,7 @@ static void bt_conn_cb_security_changed_call_rpc_handler(const struct nrf_rpc_gr
 		goto decoding_error;
 	}
 
+	bt_conn_info_cache_invalidate(conn);
 	bt_conn_cb_security_changed_call(conn, level, err);
 
 	nrf_rpc_rsp_send_void(group);
@@ -1099,6 +1243,7 @@ static void bt_conn_cb_le_phy_updated_call_rpc_handler(const struct nrf_rpc_grou
 		goto decoding_error;
 	}
 
+	bt_conn_info_cache_invalidate(conn);
 	bt_conn_cb_le_phy_updated_call(conn, &param);
 
 	nrf_rpc_rsp_send_void(group);
@@ -1146,6 +1291,7 @@ static void bt_conn_cb_le_data_len_updated_call_rpc_handler(const struct nrf_rpc
 		goto decoding_error;
 	}
 
+	bt_conn_info_cache_invalidate(conn);
 	bt_conn_cb_le_data_len_updated_call(conn, &info);
 
 	nrf_rpc_rsp_send_void(group);
@@ -1215,7 +1361,9 @@ int bt_conn_cb_unregister(struct bt_conn_cb *cb)
 	}
 	UNLOCK_CONN_INFO();
 
-	if (err == 0 && sys_slist_is_empty(&conn_cbs)) {
+	/* The connection information cache depends on the callbacks, keep them on remote. */
+	if (err == 0 && sys_slist_is_empty(&conn_cbs) &&
+	    !IS_ENABLED(CONFIG_BT_RPC_CONN_INFO_CACHE)) {
 		/* No callbacks left, unregister on remote */
 		err = bt_conn_cb_unregister_on_remote();
 	}
@@ -1938,6 +2086,12 @@ bt_security_t bt_conn_get_security(const struct bt_conn *conn)
 
 void bt_rpc_conn_init(void)
 {
+	if (IS_ENABLED(CONFIG_BT_RPC_CONN_INFO_CACHE)) {
+		/* The cache is kept coherent by the connection callbacks called by the host. */
+		bt_conn_cb_register_on_remote();
+		return;
+	}
+
 	STRUCT_SECTION_FOREACH(bt_conn_cb, cb) {
 		bt_conn_cb_register_on_remote();
 		return;
@@ -769,8 +769,7 @@ static void bt_gatt_notify_params_enc(struct nrf_rpc_cbor_ctx *encoder,
 	}
 }
 
-int bt_gatt_notify_cb(struct bt_conn *conn,
-		      struct bt_gatt_notify_params *params)
+static int notify_send(struct bt_conn *conn, const struct bt_gatt_notify_params *params)
 {
 	struct nrf_rpc_cbor_ctx ctx;
 	int result;
@@ -793,6 +792,197 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 	return result;
 }
 
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH)
+struct notify_batch_entry {
+	struct bt_conn *conn;
+	const struct bt_gatt_attr *attr;
+	bt_gatt_complete_func_t func;
+	void *user_data;
+	uint16_t len;
+	uint16_t offset;
+	bool has_uuid;
+	union {
+		struct bt_uuid uuid;
+		struct bt_uuid_16 u16;
+		struct bt_uuid_32 u32;
+		struct bt_uuid_128 u128;
+	};
+};
+
+/* Notifications waiting to be sent to the host in a single command. The notifications are
+ * sent in the order in which they were queued, so the order per connection is preserved.
+ */
+static struct {
+	struct notify_batch_entry entries[CONFIG_BT_RPC_GATT_NOTIFY_BATCH_COUNT];
+	uint8_t data[CONFIG_BT_RPC_GATT_NOTIFY_BATCH_BUF_SIZE];
+	uint16_t count;
+	uint16_t data_len;
+	uint32_t notifications;
+	uint32_t batches;
+} notify_batch;
+
+static K_MUTEX_DEFINE(notify_batch_mutex);
+
+static void notify_batch_entry_params(const struct notify_batch_entry *entry,
+				      struct bt_gatt_notify_params *params)
+{
+	memset(params, 0, sizeof(*params));
+
+	params->uuid = entry->has_uuid ? &entry->uuid : NULL;
+	params->attr = entry->attr;
+	params->data = &notify_batch.data[entry->offset];
+	params->len = entry->len;
+	params->func = entry->func;
+	params->user_data = entry->user_data;
+}
+
+/* Must be called with the notify_batch_mutex locked. */
+static int notify_batch_send(void)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	struct bt_gatt_notify_params params;
+	struct bt_conn *conns[CONFIG_BT_RPC_GATT_NOTIFY_BATCH_COUNT];
+	size_t count = notify_batch.count;
+	int result;
+	size_t scratchpad_size = 0;
+	size_t buffer_size_max = 13;
+
+	if (notify_batch.count == 0) {
+		return 0;
+	}
+
+	/* The host reuses the scratchpad for each notification, so it fits the largest one. */
+	for (size_t i = 0; i < notify_batch.count; i++) {
+		notify_batch_entry_params(&notify_batch.entries[i], &params);
+
+		buffer_size_max += 3 + bt_gatt_notify_params_buf_size(&params);
+		buffer_size_max += params.uuid ? bt_uuid_buf_size(params.uuid) : 0;
+		scratchpad_size = MAX(scratchpad_size,
+				      NRF_RPC_SCRATCHPAD_ALIGN(params.len) +
+				      NRF_RPC_SCRATCHPAD_ALIGN(sizeof(struct bt_uuid_128)));
+	}
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+	nrf_rpc_encode_uint(&ctx, scratchpad_size);
+	nrf_rpc_encode_uint(&ctx, notify_batch.count);
+
+	for (size_t i = 0; i < notify_batch.count; i++) {
+		notify_batch_entry_params(&notify_batch.entries[i], &params);
+
+		bt_rpc_encode_bt_conn(&ctx, notify_batch.entries[i].conn);
+		bt_gatt_notify_params_enc(&ctx, &params);
+
+		conns[i] = notify_batch.entries[i].conn;
+	}
+
+	/* Notifications queued by callbacks called during the command go to the next batch. */
+	notify_batch.count = 0;
+	notify_batch.data_len = 0;
+	notify_batch.batches++;
+
+	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_GATT_NOTIFY_BATCH_RPC_CMD,
+		&ctx, nrf_rpc_rsp_decode_i32, &result);
+
+	/* Release the connections once the host has sent the notifications. */
+	for (size_t i = 0; i < count; i++) {
+		if (conns[i]) {
+			bt_conn_unref(conns[i]);
+		}
+	}
+
+	if (result < 0) {
+		LOG_WRN("Sending batched notifications error: %d", result);
+	}
+
+	return result;
+}
+
+static void notify_batch_timeout(struct k_work *work)
+{
+	k_mutex_lock(&notify_batch_mutex, K_FOREVER);
+	(void)notify_batch_send();
+	k_mutex_unlock(&notify_batch_mutex);
+}
+
+static K_WORK_DELAYABLE_DEFINE(notify_batch_work, notify_batch_timeout);
+
+static int notify_batch_add(struct bt_conn *conn, const struct bt_gatt_notify_params *params)
+{
+	struct notify_batch_entry *entry;
+	int err = 0;
+
+	k_mutex_lock(&notify_batch_mutex, K_FOREVER);
+
+	if (notify_batch.count == ARRAY_SIZE(notify_batch.entries) ||
+	    notify_batch.data_len + params->len > sizeof(notify_batch.data)) {
+		(void)notify_batch_send();
+	}
+
+	if (params->len > sizeof(notify_batch.data)) {
+		/* Too large to be queued, send it after the queued notifications. */
+		err = notify_send(conn, params);
+		goto exit;
+	}
+
+	entry = &notify_batch.entries[notify_batch.count];
+	/* Keep the connection object valid until the batch is sent. */
+	entry->conn = conn ? bt_conn_ref(conn) : NULL;
+	entry->attr = params->attr;
+	entry->func = params->func;
+	entry->user_data = params->user_data;
+	entry->len = params->len;
+	entry->offset = notify_batch.data_len;
+	entry->has_uuid = (params->uuid != NULL);
+
+	if (entry->has_uuid) {
+		memcpy(&entry->uuid, params->uuid,
+		       MAX(bt_uuid_buf_size(params->uuid), sizeof(struct bt_uuid)));
+	}
+
+	memcpy(&notify_batch.data[notify_batch.data_len], params->data, params->len);
+	notify_batch.data_len += params->len;
+	notify_batch.notifications++;
+
+	if (notify_batch.count++ == 0) {
+		k_work_schedule(&notify_batch_work, K_MSEC(CONFIG_BT_RPC_GATT_NOTIFY_BATCH_TIMEOUT));
+	}
+
+exit:
+	k_mutex_unlock(&notify_batch_mutex);
+
+	return err;
+}
+
+int bt_rpc_gatt_notify_flush(void)
+{
+	int err;
+
+	k_mutex_lock(&notify_batch_mutex, K_FOREVER);
+	err = notify_batch_send();
+	k_mutex_unlock(&notify_batch_mutex);
+
+	return err;
+}
+
+void bt_rpc_gatt_notify_batch_stats(uint32_t *notifications, uint32_t *batches)
+{
+	k_mutex_lock(&notify_batch_mutex, K_FOREVER);
+	*notifications = notify_batch.notifications;
+	*batches = notify_batch.batches;
+	k_mutex_unlock(&notify_batch_mutex);
+}
+#endif /* defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH) */
+
+int bt_gatt_notify_cb(struct bt_conn *conn,
+		      struct bt_gatt_notify_params *params)
+{
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH)
+	return notify_batch_add(conn, params);
+#else
+	return notify_send(conn, params);
+#endif /* defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH) */
+}
+
 #if defined(CONFIG_BT_GATT_NOTIFY_MULTIPLE)
 int bt_gatt_notify_multiple(struct bt_conn *conn, uint16_t num_params,
 			    struct bt_gatt_notify_params *params)
@@ -810,6 +1000,11 @@ int bt_gatt_notify_multiple(struct bt_conn *conn, uint16_t num_params,
 		}
 	}
 
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH)
+	/* The notifications are sent to the host together, do not wait for more. */
+	(void)bt_rpc_gatt_notify_flush();
+#endif /* defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH) */
+
 	return 0;
 }
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
@@ -861,6 +1056,11 @@ int bt_gatt_indicate(struct bt_conn *conn, struct bt_gatt_indicate_params *param
 	buffer_size_max += bt_gatt_indicate_params_buf_size(params);
 	scratchpad_size += bt_gatt_indicate_params_sp_size(params);
 
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH)
+	/* Keep the order of notifications and indications. */
+	(void)bt_rpc_gatt_notify_flush();
+#endif /* defined(CONFIG_BT_RPC_GATT_NOTIFY_BATCH) */
+
 	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
 	nrf_rpc_encode_uint(&ctx, scratchpad_size);
 
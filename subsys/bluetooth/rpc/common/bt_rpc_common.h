@@ -144,6 +144,8 @@ enum bt_rpc_cmd_from_cli_to_host {
 	/* internal.h API */
 	BT_ADDR_LE_IS_BONDED_CMD,
 	BT_HCI_CMD_SEND_SYNC_RPC_CMD,
+	/* gatt.h API, appended to keep the IDs of the commands above unchanged */
+	BT_GATT_NOTIFY_BATCH_RPC_CMD,
 };
 
 /** @brief Host commands IDs used in bluetooth API serialization.
@@ -819,6 +819,51 @@ decoding_error:
 NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_notify_cb, BT_GATT_NOTIFY_CB_RPC_CMD,
 			 bt_gatt_notify_cb_rpc_handler, NULL);
 
+static void bt_gatt_notify_batch_rpc_handler(const struct nrf_rpc_group *group,
+					     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct bt_conn *conn;
+	struct bt_gatt_notify_params params;
+	struct nrf_rpc_scratchpad scratchpad;
+	uint32_t count;
+	int result = 0;
+	int err;
+
+	NRF_RPC_SCRATCHPAD_DECLARE(&scratchpad, ctx);
+
+	count = nrf_rpc_decode_uint(ctx);
+
+	/* Each notification is sent as soon as it is decoded, so the scratchpad is reused. */
+	for (uint32_t i = 0; i < count; i++) {
+		net_buf_simple_reset(&scratchpad.buf);
+
+		conn = bt_rpc_decode_bt_conn(ctx);
+		bt_gatt_notify_params_dec(&scratchpad, &params);
+
+		if (!nrf_rpc_decode_valid(ctx)) {
+			break;
+		}
+
+		err = bt_gatt_notify_cb(conn, &params);
+		if (err && result == 0) {
+			result = err;
+		}
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	nrf_rpc_rsp_send_int(group, result);
+
+	return;
+decoding_error:
+	bt_rpc_report_decoding_error(BT_GATT_NOTIFY_BATCH_RPC_CMD);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_notify_batch, BT_GATT_NOTIFY_BATCH_RPC_CMD,
+			 bt_gatt_notify_batch_rpc_handler, NULL);
+
 static void bt_gatt_indicate_params_dec(struct nrf_rpc_scratchpad *scratchpad,
 					struct bt_gatt_indicate_params *data)
 {
@@ -145,6 +145,12 @@ bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
 #include <zephyr/toolchain.h>
 #include <bl_crypto.h>
 #include "bl_validation_internal.h"
+#ifdef CONFIG_SB_VALIDATION_CACHE
+#include "bl_validation_cache.h"
+#endif
+#ifdef CONFIG_SB_VALIDATION_CACHE_TIMING
+#include <zephyr/timing/timing.h>
+#endif
 
 /* We keep the S0/S1 nomenclature, regardless of core, but partition S0/S1
  * targets differs. Below configuration, currently, addresses nRF5340
@@ -412,6 +418,84 @@ static bool validate_hash(const uint32_t fw_src_address, const uint32_t fw_size,
 #endif
 
 
+/* Check the integrity and authenticity of the image contents. */
+static bool validate_image(uint32_t fw_src_address, const struct fw_info *fwinfo,
+			   const struct fw_validation_info *fw_val_info,
+			   bool external)
+{
+#if defined(CONFIG_SB_VALIDATE_FW_SIGNATURE)
+#if defined(CONFIG_SB_LCS_AWARE)
+	if (nrf_lcs_get() == NRF_LCS_ASSEMBLY_AND_TEST) {
+		LOG_WRN("Device is in ASSEMBLY_AND_TEST, skipping signature validation.");
+#ifdef SB_VALIDATION_STRUCT_HAS_HASH
+		return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
+					external);
+#else
+		LOG_ERR("Hash unavailable. Accepting firmware without validation.");
+		return true;
+#endif /* SB_VALIDATION_STRUCT_HAS_HASH */
+	}
+#endif
+	return validate_signature(fw_src_address, fwinfo->size, fw_val_info,
+				external);
+#elif defined(CONFIG_SB_VALIDATE_FW_HASH)
+	return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
+				external);
+#else
+	#error "Validation not specified."
+#endif
+}
+
+#ifdef CONFIG_SB_VALIDATION_CACHE
+static bool validate_image_cached(uint32_t fw_src_address, const struct fw_info *fwinfo,
+				  const struct fw_validation_info *fw_val_info)
+{
+	__aligned(4) struct bl_validation_cache_record record = {
+		.magic = BL_VALIDATION_CACHE_MAGIC,
+		.address = fw_src_address,
+		.size = fwinfo->size,
+		.version = fwinfo->version,
+	};
+	enum bl_validation_cache_result result;
+	bool valid;
+#ifdef CONFIG_SB_VALIDATION_CACHE_TIMING
+	timing_t start;
+
+	timing_init();
+	timing_start();
+	start = timing_counter_get();
+#endif
+
+	memcpy(record.signature, fw_val_info->signature, sizeof(record.signature));
+
+	result = bl_validation_cache_lookup(&record);
+	if (result == BL_VALIDATION_CACHE_HIT) {
+		valid = true;
+	} else {
+		valid = validate_image(fw_src_address, fwinfo, fw_val_info, false);
+		if (valid) {
+			bl_validation_cache_store(&record);
+		}
+	}
+
+#ifdef CONFIG_SB_VALIDATION_CACHE_TIMING
+	timing_t end = timing_counter_get();
+
+	timing_stop();
+	LOG_INF("Validation (%s) took %u us.",
+		(result == BL_VALIDATION_CACHE_HIT) ? "cached" :
+		(result == BL_VALIDATION_CACHE_EXPIRED) ? "forced" : "cache miss",
+		(uint32_t)(timing_cycles_to_ns(timing_cycles_get(&start, &end)) / 1000));
+#else
+	if (result == BL_VALIDATION_CACHE_HIT) {
+		LOG_INF("Firmware found in validation cache.");
+	}
+#endif
+
+	return valid;
+}
+#endif
+
 static bool validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address,
 			      const struct fw_info *fwinfo, bool external)
 {
@@ -550,27 +634,13 @@ static bool validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address,
 		return false;
 	}
 
-#if defined(CONFIG_SB_VALIDATE_FW_SIGNATURE)
-#if defined(CONFIG_SB_LCS_AWARE)
-	if (nrf_lcs_get() == NRF_LCS_ASSEMBLY_AND_TEST) {
-		LOG_WRN("Device is in ASSEMBLY_AND_TEST, skipping signature validation.");
-#ifdef SB_VALIDATION_STRUCT_HAS_HASH
-		return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
-					external);
-#else
-		LOG_ERR("Hash unavailable. Accepting firmware without validation.");
-		return true;
-#endif /* SB_VALIDATION_STRUCT_HAS_HASH */
+#ifdef CONFIG_SB_VALIDATION_CACHE
+	if (!external) {
+		return validate_image_cached(fw_src_address, fwinfo, fw_val_info);
 	}
 #endif
-	return validate_signature(fw_src_address, fwinfo->size, fw_val_info,
-				external);
-#elif defined(CONFIG_SB_VALIDATE_FW_HASH)
-	return validate_hash(fw_src_address, fwinfo->size, fw_val_info,
-				external);
-#else
-	#error "Validation not specified."
-#endif
+
+	return validate_image(fw_src_address, fwinfo, fw_val_info, external);
 }
 
 bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
@@ -590,6 +660,9 @@ bool bl_validate_firmware_local(uint32_t fw_address, const struct fw_info *fwinf
 void bl_validate_housekeeping(void)
 {
 	bl_root_of_trust_housekeeping();
+#ifdef CONFIG_SB_VALIDATION_CACHE
+	bl_validation_cache_lock();
+#endif
 }
 #endif
 
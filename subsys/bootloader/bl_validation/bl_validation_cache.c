@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <bl_validation.h>
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/logging/log.h>
+#include <fprotect.h>
+#include <nrfx_nvmc.h>
+#include "bl_validation_internal.h"
+#include "bl_validation_cache.h"
+
+LOG_MODULE_DECLARE(bl_validation, CONFIG_SECURE_BOOT_VALIDATION_LOG_LEVEL);
+
+#if USE_PARTITION_MANAGER
+#include <pm_config.h>
+#define B0_ADDRESS	PM_B0_ADDRESS
+#define B0_SIZE		PM_B0_SIZE
+#else
+#include <zephyr/storage/flash_map.h>
+#define B0_ADDRESS	PARTITION_ADDRESS(b0_partition)
+#define B0_SIZE		PARTITION_SIZE(b0_partition)
+#endif
+
+/* The cache occupies the end of the bootloader partition, so that it is
+ * write-protected together with the bootloader once the boot decision is made.
+ */
+#define CACHE_ADDRESS	(B0_ADDRESS + B0_SIZE - CONFIG_SB_VALIDATION_CACHE_SIZE)
+#define CACHE_NUM_MARKS	((CONFIG_SB_VALIDATION_CACHE_SIZE - \
+			  sizeof(struct bl_validation_cache_record)) / sizeof(uint32_t))
+#define ERASE_BLOCK_SIZE DT_PROP(DT_CHOSEN(zephyr_flash), erase_block_size)
+
+BUILD_ASSERT(CONFIG_SB_SIGNATURE_LEN >= BL_VALIDATION_CACHE_SIGNATURE_LEN,
+	     "Signature is too short to identify the image.");
+BUILD_ASSERT(CONFIG_SB_VALIDATION_CACHE_MAX_BOOTS <= CACHE_NUM_MARKS,
+	     "CONFIG_SB_VALIDATION_CACHE_SIZE is too small for the boot count.");
+BUILD_ASSERT((CONFIG_SB_VALIDATION_CACHE_SIZE % CONFIG_FPROTECT_BLOCK_SIZE) == 0,
+	     "The cache area must be aligned to the protection block size.");
+BUILD_ASSERT((CONFIG_SB_VALIDATION_CACHE_SIZE % ERASE_BLOCK_SIZE) == 0,
+	     "The cache area must be aligned to the flash page size.");
+BUILD_ASSERT(CONFIG_SB_VALIDATION_CACHE_SIZE < B0_SIZE,
+	     "The cache area does not fit in the bootloader partition.");
+
+extern const uint32_t _flash_used[];
+
+static const struct bl_validation_cache *const cache =
+	(const struct bl_validation_cache *)CACHE_ADDRESS;
+
+static bool cache_available(void)
+{
+	/* The partition size is known at build time, but the image size is not. */
+	if ((B0_ADDRESS + (uint32_t)_flash_used) > CACHE_ADDRESS) {
+		LOG_WRN("Bootloader overlaps the validation cache, cache disabled.");
+		return false;
+	}
+
+	return true;
+}
+
+__weak bool bl_validation_cache_tamper_detected(void)
+{
+	return false;
+}
+
+enum bl_validation_cache_result
+bl_validation_cache_lookup(const struct bl_validation_cache_record *expected)
+{
+	enum bl_validation_cache_result result;
+	uint32_t used;
+
+	if (!cache_available()) {
+		return BL_VALIDATION_CACHE_MISS;
+	}
+
+	result = cache_check(cache, CACHE_NUM_MARKS, expected,
+			     CONFIG_SB_VALIDATION_CACHE_MAX_BOOTS,
+			     bl_validation_cache_tamper_detected());
+	if (result != BL_VALIDATION_CACHE_HIT) {
+		return result;
+	}
+
+	/* Count the boot before it happens, so that a reset cannot skip it. */
+	used = cache_boots_used(cache, CACHE_NUM_MARKS);
+	nrfx_nvmc_word_write((uint32_t)&cache->boot_marks[used], 0);
+
+	return BL_VALIDATION_CACHE_HIT;
+}
+
+void bl_validation_cache_store(const struct bl_validation_cache_record *record)
+{
+	if (!cache_available()) {
+		return;
+	}
+
+	for (uint32_t addr = CACHE_ADDRESS; addr < (B0_ADDRESS + B0_SIZE);
+	     addr += ERASE_BLOCK_SIZE) {
+		if (nrfx_nvmc_page_erase(addr) != NRFX_SUCCESS) {
+			LOG_ERR("Failed to erase the validation cache.");
+			return;
+		}
+	}
+
+	nrfx_nvmc_words_write(CACHE_ADDRESS, record,
+			      offsetof(struct bl_validation_cache_record, committed) /
+			      sizeof(uint32_t));
+	nrfx_nvmc_word_write((uint32_t)&cache->record.committed,
+			     BL_VALIDATION_CACHE_COMMITTED);
+}
+
+void bl_validation_cache_lock(void)
+{
+	int err = fprotect_area(CACHE_ADDRESS, CONFIG_SB_VALIDATION_CACHE_SIZE);
+
+	if (err) {
+		/* An unprotected cache could be forged by the booted image. */
+		LOG_ERR("Failed to protect the validation cache: %d.", err);
+		k_panic();
+	}
+}
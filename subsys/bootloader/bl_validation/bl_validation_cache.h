@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BL_VALIDATION_CACHE_H__
+#define BL_VALIDATION_CACHE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "bl_validation_internal.h"
+
+/** Check whether @p expected matches the validated image cache.
+ *
+ * A hit is counted as a boot, so it must only be requested for an image that
+ * is about to be booted.
+ */
+enum bl_validation_cache_result
+bl_validation_cache_lookup(const struct bl_validation_cache_record *expected);
+
+/** Replace the cache contents with @p record and reset the boot count. */
+void bl_validation_cache_store(const struct bl_validation_cache_record *record);
+
+/** Write-protect the cache until the next reset. */
+void bl_validation_cache_lock(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BL_VALIDATION_CACHE_H__ */
@@ -11,10 +11,12 @@
 extern "C" {
 #endif
 
+#include <string.h>
+#include <stddef.h>
 #include <zephyr/types.h>
 
 
-static bool within(uint32_t addr, uint32_t start, uint32_t end)
+static inline bool within(uint32_t addr, uint32_t start, uint32_t end)
 {
 	if (start > end) {
 		return false;
@@ -28,8 +30,8 @@ static bool within(uint32_t addr, uint32_t start, uint32_t end)
 	return true;
 }
 
-static bool region_within(uint32_t inner_start, uint32_t inner_end,
-			uint32_t start, uint32_t end)
+static inline bool region_within(uint32_t inner_start, uint32_t inner_end,
+				 uint32_t start, uint32_t end)
 {
 	if (inner_start > inner_end) {
 		return false;
@@ -43,6 +45,89 @@ static bool region_within(uint32_t inner_start, uint32_t inner_end,
 	return true;
 }
 
+/** Magic value at the start of a validated image cache record. */
+#define BL_VALIDATION_CACHE_MAGIC	0x4256c4c3
+
+/** Value of the 'committed' word of a completely written record. */
+#define BL_VALIDATION_CACHE_COMMITTED	0x5a5a5a5a
+
+/** Number of signature bytes stored in a record. The signature covers the
+ *  hash of the image, so it identifies the validated image contents.
+ */
+#define BL_VALIDATION_CACHE_SIGNATURE_LEN 64
+
+/** Value of an erased word in the cache area. */
+#define BL_VALIDATION_CACHE_ERASED	0xFFFFFFFF
+
+/** Record describing the last image that passed a full validation. */
+struct bl_validation_cache_record {
+	uint32_t magic;
+	/* Address, size and version of the image as found in its fw_info. */
+	uint32_t address;
+	uint32_t size;
+	uint32_t version;
+	uint8_t signature[BL_VALIDATION_CACHE_SIGNATURE_LEN];
+	/* Written last, so that a record torn by a reset is never used. */
+	uint32_t committed;
+};
+
+/** Layout of the cache area. */
+struct bl_validation_cache {
+	struct bl_validation_cache_record record;
+	/* One word is cleared for every boot that used the record, so that the
+	 * boot count can be updated without erasing the area.
+	 */
+	uint32_t boot_marks[];
+};
+
+enum bl_validation_cache_result {
+	/* The image matches the record and can be booted without validation. */
+	BL_VALIDATION_CACHE_HIT,
+	/* There is no record for the image. */
+	BL_VALIDATION_CACHE_MISS,
+	/* The image matches the record, but a full validation is required. */
+	BL_VALIDATION_CACHE_EXPIRED,
+};
+
+static inline bool cache_record_valid(const struct bl_validation_cache_record *record)
+{
+	return (record->magic == BL_VALIDATION_CACHE_MAGIC) &&
+	       (record->committed == BL_VALIDATION_CACHE_COMMITTED);
+}
+
+/* Boot marks are cleared in order, so the first erased word ends the count. */
+static inline uint32_t cache_boots_used(const struct bl_validation_cache *cache,
+					uint32_t num_marks)
+{
+	uint32_t used = 0;
+
+	while ((used < num_marks) &&
+	       (cache->boot_marks[used] != BL_VALIDATION_CACHE_ERASED)) {
+		used++;
+	}
+
+	return used;
+}
+
+static inline enum bl_validation_cache_result
+cache_check(const struct bl_validation_cache *cache, uint32_t num_marks,
+	    const struct bl_validation_cache_record *expected, uint32_t max_boots,
+	    bool tamper_detected)
+{
+	if (!cache_record_valid(&cache->record) ||
+	    (memcmp(&cache->record, expected,
+		    offsetof(struct bl_validation_cache_record, committed)) != 0)) {
+		return BL_VALIDATION_CACHE_MISS;
+	}
+
+	if (tamper_detected || (max_boots > num_marks) ||
+	    (cache_boots_used(cache, num_marks) >= max_boots)) {
+		return BL_VALIDATION_CACHE_EXPIRED;
+	}
+
+	return BL_VALIDATION_CACHE_HIT;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,14 @@
 
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#endif /* CONFIG_DFU_MULTI_IMAGE_PIPELINE */
+
 #define FIXED_HEADER_SIZE sizeof(uint16_t)
 #define CBOR_HEADER_NESTING_LEVEL 3
 #define IMAGE_NO_FIXED_HEADER -2
@@ -78,6 +86,33 @@ struct dfu_multi_image_ctx {
 
 static struct dfu_multi_image_ctx ctx;
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+
+/*
+ * In the pipelined mode, the caller of dfu_multi_image_write() only parses the package and
+ * queues the image data. The image writers are called from a dedicated work queue, in the
+ * package order, so that writing to the flash overlaps with receiving the next chunks.
+ */
+struct pipeline_ctx {
+	struct k_work work;
+	struct k_mutex lock;
+	/* Given by the consumer whenever it frees space in the buffer */
+	struct k_sem space;
+	/* First error reported by an image writer */
+	atomic_t err;
+	/* Consumer state, valid once the first image data is queued */
+	bool started;
+	int image_no;
+	size_t item_offset;
+};
+
+static struct pipeline_ctx pipeline;
+static struct k_work_q pipeline_work_q;
+static K_THREAD_STACK_DEFINE(pipeline_stack, CONFIG_DFU_MULTI_IMAGE_PIPELINE_STACK_SIZE);
+RING_BUF_DECLARE(pipeline_buf, CONFIG_DFU_MULTI_IMAGE_PIPELINE_BUFFER_SIZE);
+
+#endif /* CONFIG_DFU_MULTI_IMAGE_PIPELINE */
+
 static int parse_fixed_header(void)
 {
 	ctx.cur_item_size += sys_get_le16(ctx.buffer);
@@ -163,10 +198,10 @@ static int save_image_finished(uint8_t image_no)
 
 #endif
 
-static const struct dfu_image_writer *current_image_writer(void)
+static const struct dfu_image_writer *image_writer(int image_no)
 {
-	if (ctx.cur_image_no >= 0 && (size_t)ctx.cur_image_no < ctx.header.image_count) {
-		const int image_id = ctx.header.images[ctx.cur_image_no].id;
+	if (image_no >= 0 && (size_t)image_no < ctx.header.image_count) {
+		const int image_id = ctx.header.images[image_no].id;
 
 		for (size_t i = 0; i < ctx.writer_count; i++) {
 			if (ctx.writers[i].image_id == image_id) {
@@ -178,6 +213,11 @@ static const struct dfu_image_writer *current_image_writer(void)
 	return NULL;
 }
 
+static const struct dfu_image_writer *current_image_writer(void)
+{
+	return image_writer(ctx.cur_image_no);
+}
+
 static void select_next_image(void)
 {
 	ctx.cur_item_offset = 0;
@@ -192,6 +232,178 @@ static void select_next_image(void)
 	}
 }
 
+static int write_image_data(int image_no, size_t item_offset, const uint8_t *chunk,
+			    size_t chunk_size)
+{
+	const struct dfu_image_writer *writer = image_writer(image_no);
+	const size_t image_size = ctx.header.images[image_no].size;
+	int err = 0;
+
+	if (!writer) {
+		return -ESPIPE;
+	}
+
+	if (item_offset == 0 && !ctx.cur_item_opened) {
+		err = writer->open(writer->image_id, image_size);
+		ctx.cur_item_opened = true;
+	}
+
+	if (!err) {
+		err = writer->write(chunk, chunk_size);
+	}
+
+	if (!err && item_offset + chunk_size == image_size) {
+#ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
+		save_image_finished((uint8_t) image_no);
+#endif
+		err = writer->close(true);
+		ctx.cur_item_opened = false;
+	}
+
+	return err;
+}
+
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+
+static void pipeline_work_handler(struct k_work *work)
+{
+	uint8_t *data;
+	uint32_t size;
+	int err;
+
+	ARG_UNUSED(work);
+
+	while (atomic_get(&pipeline.err) == 0 && pipeline.image_no < ctx.header.image_count) {
+		k_mutex_lock(&pipeline.lock, K_FOREVER);
+		size = ring_buf_get_claim(&pipeline_buf, &data,
+					  ctx.header.images[pipeline.image_no].size -
+					  pipeline.item_offset);
+		k_mutex_unlock(&pipeline.lock);
+
+		if (size == 0) {
+			break;
+		}
+
+		/* The claimed data stays valid, the producer only writes to the free space */
+		err = write_image_data(pipeline.image_no, pipeline.item_offset, data, size);
+
+		k_mutex_lock(&pipeline.lock, K_FOREVER);
+		ring_buf_get_finish(&pipeline_buf, size);
+		k_mutex_unlock(&pipeline.lock);
+
+		if (err) {
+			LOG_ERR("Writing image %d failed (err %d)", pipeline.image_no, err);
+			atomic_cas(&pipeline.err, 0, err);
+			/* Keep the position at the failed image, so that done() closes its writer */
+			break;
+		}
+
+		pipeline.item_offset += size;
+
+		if (pipeline.item_offset == ctx.header.images[pipeline.image_no].size) {
+			pipeline.item_offset = 0;
+
+			while (++pipeline.image_no < ctx.header.image_count &&
+			       image_writer(pipeline.image_no) == NULL) {
+			}
+		}
+
+		k_sem_give(&pipeline.space);
+	}
+
+	/* Wake up the producer in case it waits for space that will not be freed */
+	k_sem_give(&pipeline.space);
+}
+
+static int pipeline_put(const uint8_t *chunk, size_t chunk_size)
+{
+	size_t queued = 0;
+	uint32_t size;
+	int err;
+
+	if (!pipeline.started) {
+		/* Nothing is queued yet, so the consumer starts where the parser is */
+		pipeline.image_no = ctx.cur_image_no;
+		pipeline.item_offset = ctx.cur_item_offset;
+		pipeline.started = true;
+	}
+
+	while (queued < chunk_size) {
+		err = atomic_get(&pipeline.err);
+		if (err) {
+			return err;
+		}
+
+		k_mutex_lock(&pipeline.lock, K_FOREVER);
+		size = ring_buf_put(&pipeline_buf, chunk + queued, chunk_size - queued);
+		k_mutex_unlock(&pipeline.lock);
+
+		if (size > 0) {
+			queued += size;
+			k_work_submit_to_queue(&pipeline_work_q, &pipeline.work);
+		} else {
+			/* Bounded buffering, wait for the writers to catch up */
+			k_sem_take(&pipeline.space, K_FOREVER);
+		}
+	}
+
+	return 0;
+}
+
+/* Wait until all queued data is written and return the first writer error, if any. */
+static int pipeline_flush(void)
+{
+	struct k_work_sync sync;
+	int err;
+
+	k_work_flush(&pipeline.work, &sync);
+
+	err = atomic_get(&pipeline.err);
+	if (err) {
+		/* Data queued after the failure is dropped */
+		ring_buf_reset(&pipeline_buf);
+	}
+
+	return err;
+}
+
+static void pipeline_init(void)
+{
+	static bool work_q_started;
+
+	if (work_q_started) {
+		/* Finish writing anything left from the previous package */
+		(void)pipeline_flush();
+	} else {
+		k_work_queue_init(&pipeline_work_q);
+		k_work_queue_start(&pipeline_work_q, pipeline_stack,
+				   K_THREAD_STACK_SIZEOF(pipeline_stack),
+				   CONFIG_DFU_MULTI_IMAGE_PIPELINE_PRIORITY,
+				   &(struct k_work_queue_config){ .name = "dfu_multi_image" });
+		work_q_started = true;
+	}
+
+	memset(&pipeline, 0, sizeof(pipeline));
+	k_work_init(&pipeline.work, pipeline_work_handler);
+	k_mutex_init(&pipeline.lock);
+	k_sem_init(&pipeline.space, 0, 1);
+	ring_buf_reset(&pipeline_buf);
+}
+
+#endif /* CONFIG_DFU_MULTI_IMAGE_PIPELINE */
+
+/* Writer of the image that is currently being written, which may lag behind the parser. */
+static const struct dfu_image_writer *active_image_writer(void)
+{
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	if (pipeline.started) {
+		return image_writer(pipeline.image_no);
+	}
+#endif
+
+	return current_image_writer();
+}
+
 static int process_current_item(const uint8_t *chunk, size_t chunk_size)
 {
 	int err = 0;
@@ -216,29 +428,11 @@ static int process_current_item(const uint8_t *chunk, size_t chunk_size)
 		}
 	} else {
 		/* Image data */
-		const struct dfu_image_writer *writer = current_image_writer();
-
-		if (!writer) {
-			err = -ESPIPE;
-		}
-
-		if (!err && ctx.cur_item_offset == 0 && !ctx.cur_item_opened) {
-			err = writer->open(writer->image_id,
-					   ctx.header.images[ctx.cur_image_no].size);
-			ctx.cur_item_opened = true;
-		}
-
-		if (!err) {
-			err = writer->write(chunk, chunk_size);
-		}
-
-		if (!err && ctx.cur_item_offset + chunk_size == ctx.cur_item_size) {
-#ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
-			save_image_finished((uint8_t) ctx.cur_image_no);
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+		err = pipeline_put(chunk, chunk_size);
+#else
+		err = write_image_data(ctx.cur_image_no, ctx.cur_item_offset, chunk, chunk_size);
 #endif
-			err = writer->close(true);
-			ctx.cur_item_opened = false;
-		}
 	}
 
 	if (err) {
@@ -457,6 +651,10 @@ int dfu_multi_image_init(uint8_t *buffer, size_t buffer_size)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	pipeline_init();
+#endif
+
 	memset(&ctx, 0, sizeof(ctx));
 	ctx.buffer = buffer;
 	ctx.buffer_size = buffer_size;
@@ -492,6 +690,14 @@ int dfu_multi_image_write(size_t offset, const uint8_t *chunk, size_t chunk_size
 	}
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	/* Report a failure of a writer that happened since the previous call */
+	result = atomic_get(&pipeline.err);
+	if (result) {
+		return result;
+	}
+#endif
+
 	if (offset > ctx.cur_offset) {
 		/* Unexpected data gap */
 		return -ESPIPE;
@@ -547,14 +753,30 @@ int dfu_multi_image_done(bool success)
 	}
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
-	const struct dfu_image_writer *writer = current_image_writer();
+	const struct dfu_image_writer *writer;
 	int err = 0;
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	int pipeline_err = pipeline_flush();
+
+	if (pipeline_err) {
+		success = false;
+	}
+#endif
+
+	writer = active_image_writer();
+
 	/* Close any active writer if such exists */
 	if (writer != NULL) {
 		err = writer->close(success);
 	}
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	if (pipeline_err) {
+		return pipeline_err;
+	}
+#endif
+
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
 	if (success) {
 		err = settings_clear();
@@ -572,7 +794,14 @@ int dfu_multi_image_done(bool success)
 int dfu_multi_image_reset(void)
 {
 	int err = 0;
-	const struct dfu_image_writer *writer = current_image_writer();
+	const struct dfu_image_writer *writer;
+
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	/* Writer errors are irrelevant here, the writers are reset anyway */
+	(void)pipeline_flush();
+#endif
+
+	writer = active_image_writer();
 
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
 	settings_subsys_init();
@@ -625,5 +854,9 @@ int dfu_multi_image_reset(void)
 	ctx.cur_image_no = IMAGE_NO_FIXED_HEADER;
 	ctx.cur_item_size = FIXED_HEADER_SIZE;
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_PIPELINE
+	pipeline_init();
+#endif
+
 	return err;
 }
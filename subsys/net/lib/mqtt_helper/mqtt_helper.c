@@ -15,6 +15,10 @@
 #include "mqtt-certs.h"
 #endif
 
+#if defined(CONFIG_MQTT_HELPER_QUEUE)
+#include "mqtt_helper_queue.h"
+#endif
+
 LOG_MODULE_REGISTER(mqtt_helper, CONFIG_MQTT_HELPER_LOG_LEVEL);
 
 #if defined(CONFIG_MQTT_LIB_TLS)
@@ -251,6 +255,32 @@ static int publish_get_payload(struct mqtt_client *const mqtt_client, size_t len
 	return mqtt_readall_publish_payload(mqtt_client, payload_buf, length);
 }
 
+static int publish_get_payload_chunked(struct mqtt_client *const mqtt_client,
+				       struct mqtt_helper_buf topic, size_t length)
+{
+	int err;
+	size_t offset = 0;
+	struct mqtt_helper_buf chunk = {
+		.ptr = payload_buf,
+	};
+
+	/* Deliver at least one chunk, so that empty payloads are also notified. */
+	do {
+		chunk.size = MIN(length - offset, sizeof(payload_buf));
+
+		err = mqtt_readall_publish_payload(mqtt_client, payload_buf, chunk.size);
+		if (err) {
+			return err;
+		}
+
+		current_cfg.cb.on_publish_chunk(topic, chunk, offset, length);
+
+		offset += chunk.size;
+	} while (offset < length);
+
+	return 0;
+}
+
 static void send_ack(struct mqtt_client *const mqtt_client, uint16_t message_id)
 {
 	int err;
@@ -279,6 +309,21 @@ MQTT_HELPER_STATIC void on_publish(const struct mqtt_evt *mqtt_evt)
 		.ptr = payload_buf,
 	};
 
+	if (current_cfg.cb.on_publish_chunk) {
+		err = publish_get_payload_chunked(&mqtt_client, topic, p->message.payload.len);
+		if (err) {
+			LOG_ERR("publish_get_payload_chunked, error: %d", err);
+			return;
+		}
+
+		/* Acknowledge only after the whole payload has been consumed. */
+		if (p->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+			send_ack(&mqtt_client, p->message_id);
+		}
+
+		return;
+	}
+
 	err = publish_get_payload(&mqtt_client, p->message.payload.len);
 	if (err) {
 		LOG_ERR("publish_get_payload, error: %d", err);
@@ -326,12 +371,22 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 			current_cfg.cb.on_connack(mqtt_evt->param.connack.return_code,
 						  mqtt_evt->param.connack.session_present_flag);
 		}
+
+#if defined(CONFIG_MQTT_HELPER_QUEUE)
+		if (mqtt_state_verify(MQTT_STATE_CONNECTED)) {
+			mqtt_helper_queue_drain(mqtt_client);
+		}
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE) */
 		break;
 	case MQTT_EVT_DISCONNECT:
 		LOG_DBG("MQTT_EVT_DISCONNECT: result = %d", mqtt_evt->result);
 
 		mqtt_state_set(MQTT_STATE_DISCONNECTED);
 
+#if defined(CONFIG_MQTT_HELPER_QUEUE)
+		mqtt_helper_queue_on_disconnect();
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE) */
+
 		if (current_cfg.cb.on_disconnect) {
 			current_cfg.cb.on_disconnect(mqtt_evt->result);
 		}
@@ -347,6 +402,13 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 			mqtt_evt->param.puback.message_id,
 			mqtt_evt->result);
 
+#if defined(CONFIG_MQTT_HELPER_QUEUE)
+		/* Queued messages keep the message ID given by the application, so their PUBACK
+		 * is passed on like the PUBACK of any other message.
+		 */
+		mqtt_helper_queue_on_puback(mqtt_client, mqtt_evt->param.puback.message_id);
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE) */
+
 		if (current_cfg.cb.on_puback) {
 			current_cfg.cb.on_puback(mqtt_evt->param.puback.message_id,
 						 mqtt_evt->result);
@@ -540,7 +602,9 @@ static int client_connect(struct mqtt_helper_conn_params *conn_params)
 	tls_cfg->peer_verify = ZSOCK_TLS_PEER_VERIFY_REQUIRED;
 	tls_cfg->cipher_count = 0;
 	tls_cfg->cipher_list = NULL; /* Use default */
-	tls_cfg->session_cache = ZSOCK_TLS_SESSION_CACHE_DISABLED;
+	tls_cfg->session_cache = IS_ENABLED(CONFIG_MQTT_HELPER_TLS_SESSION_CACHE) ?
+				 ZSOCK_TLS_SESSION_CACHE_ENABLED :
+				 ZSOCK_TLS_SESSION_CACHE_DISABLED;
 	tls_cfg->hostname = conn_params->hostname.ptr;
 	tls_cfg->set_native_tls = IS_ENABLED(CONFIG_MQTT_HELPER_NATIVE_TLS);
 
@@ -606,6 +670,14 @@ int mqtt_helper_init(struct mqtt_helper_cfg *cfg)
 		return -EOPNOTSUPP;
 	}
 
+#if defined(CONFIG_MQTT_HELPER_QUEUE)
+	int err = mqtt_helper_queue_init();
+
+	if (err) {
+		return err;
+	}
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE) */
+
 	current_cfg = *cfg;
 
 	mqtt_client_init(&mqtt_client);
@@ -712,6 +784,25 @@ int mqtt_helper_publish(const struct mqtt_publish_param *param)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_MQTT_HELPER_QUEUE)
+	/* Queue the message to keep the order of the messages that are already queued. */
+	if ((param->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) &&
+	    !mqtt_state_verify(MQTT_STATE_UNINIT) &&
+	    (!mqtt_state_verify(MQTT_STATE_CONNECTED) || !mqtt_helper_queue_is_empty())) {
+		int err = mqtt_helper_queue_add(param);
+
+		if (err) {
+			return err;
+		}
+
+		if (mqtt_state_verify(MQTT_STATE_CONNECTED)) {
+			mqtt_helper_queue_drain(&mqtt_client);
+		}
+
+		return 0;
+	}
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE) */
+
 	if (!mqtt_state_verify(MQTT_STATE_CONNECTED)) {
 		LOG_ERR("Library is in the wrong state (%s), %s required",
 			state_name_get(mqtt_state_get()),
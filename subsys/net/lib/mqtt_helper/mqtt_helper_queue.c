@@ -0,0 +1,440 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <net/mqtt_helper.h>
+
+#include "mqtt_helper_queue.h"
+
+LOG_MODULE_DECLARE(mqtt_helper, CONFIG_MQTT_HELPER_LOG_LEVEL);
+
+#define RECORD_HDR_SIZE sizeof(struct mqtt_helper_queue_record_hdr)
+
+struct queue_slot {
+	/* Uptime when the message was queued, or restored from the storage. */
+	int64_t queued_at;
+	/* Sequence number that defines the order of the queued messages. */
+	uint32_t seq;
+#if defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE)
+	/* Hash of the topic, so that the storage is only read for a likely topic match. */
+	uint32_t topic_hash;
+#endif
+	uint16_t topic_len;
+	uint16_t message_id;
+	/* The message is published and waits for PUBACK. */
+	bool in_flight;
+	bool used;
+};
+
+static struct queue_slot slots[CONFIG_MQTT_HELPER_QUEUE_MAX_ENTRIES];
+static uint8_t record_buf[MQTT_HELPER_QUEUE_RECORD_MAX_SIZE];
+static uint32_t next_seq;
+static size_t depth;
+static size_t in_flight;
+static size_t burst_count;
+static int64_t burst_start;
+static struct mqtt_helper_queue_stats stats;
+static bool initialized;
+static K_MUTEX_DEFINE(queue_lock);
+
+#if defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE)
+/* 32-bit FNV-1a hash. */
+static uint32_t topic_hash(const uint8_t *topic, size_t len)
+{
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash ^= topic[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE) */
+
+static void record_load(uint16_t slot, const uint8_t *data, size_t len)
+{
+	struct mqtt_helper_queue_record_hdr hdr;
+
+	if ((slot >= ARRAY_SIZE(slots)) || (len < RECORD_HDR_SIZE)) {
+		LOG_WRN("Ignoring invalid queued message in slot %d", slot);
+		return;
+	}
+
+	memcpy(&hdr, data, RECORD_HDR_SIZE);
+
+	if (hdr.topic_len > len - RECORD_HDR_SIZE) {
+		LOG_WRN("Ignoring invalid queued message in slot %d", slot);
+		return;
+	}
+
+	if (!slots[slot].used) {
+		depth++;
+	}
+
+	slots[slot] = (struct queue_slot) {
+		.queued_at = k_uptime_get(),
+		.seq = hdr.seq,
+		.topic_len = hdr.topic_len,
+		.message_id = hdr.message_id,
+		.used = true,
+	};
+
+#if defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE)
+	slots[slot].topic_hash = topic_hash(&data[RECORD_HDR_SIZE], hdr.topic_len);
+#endif
+
+	if (hdr.seq >= next_seq) {
+		next_seq = hdr.seq + 1;
+	}
+}
+
+static int free_slot_get(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		if (!slots[i].used) {
+			return i;
+		}
+	}
+
+	return -ENOMEM;
+}
+
+/* Get the oldest queued message that is not in flight. */
+static int pending_slot_get(void)
+{
+	int oldest = -ENOENT;
+
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		if (!slots[i].used || slots[i].in_flight) {
+			continue;
+		}
+
+		if ((oldest < 0) || (slots[i].seq < slots[oldest].seq)) {
+			oldest = i;
+		}
+	}
+
+	return oldest;
+}
+
+#if defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE)
+/* Get the queued message with the given topic that is not in flight. */
+static int coalesce_slot_get(const struct mqtt_utf8 *topic)
+{
+	size_t len;
+	uint32_t hash = topic_hash(topic->utf8, topic->size);
+
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		if (!slots[i].used || slots[i].in_flight || (slots[i].topic_len != topic->size) ||
+		    (slots[i].topic_hash != hash)) {
+			continue;
+		}
+
+		/* Compare the stored topic, as different topics may have the same hash. */
+
+		len = sizeof(record_buf);
+
+		if (mqtt_helper_queue_storage_read(i, record_buf, &len)) {
+			continue;
+		}
+
+		if ((len >= RECORD_HDR_SIZE + topic->size) &&
+		    (memcmp(&record_buf[RECORD_HDR_SIZE], topic->utf8, topic->size) == 0)) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE) */
+
+static void slot_remove(uint16_t slot)
+{
+	int err;
+
+	err = mqtt_helper_queue_storage_delete(slot);
+	if (err) {
+		LOG_WRN("Failed to delete queued message, error: %d", err);
+	}
+
+	slots[slot].used = false;
+	slots[slot].in_flight = false;
+	depth--;
+}
+
+static int record_write(uint16_t slot, const struct mqtt_publish_param *param)
+{
+	int err;
+	const struct mqtt_utf8 *topic = &param->message.topic.topic;
+	const struct mqtt_binstr *payload = &param->message.payload;
+	struct mqtt_helper_queue_record_hdr hdr = {
+		.seq = next_seq,
+		.topic_len = topic->size,
+		.message_id = param->message_id,
+		.retain = param->retain_flag,
+	};
+
+	memcpy(record_buf, &hdr, RECORD_HDR_SIZE);
+	memcpy(&record_buf[RECORD_HDR_SIZE], topic->utf8, topic->size);
+	memcpy(&record_buf[RECORD_HDR_SIZE + topic->size], payload->data, payload->len);
+
+	err = mqtt_helper_queue_storage_write(slot, record_buf,
+					      RECORD_HDR_SIZE + topic->size + payload->len);
+	if (err) {
+		return err;
+	}
+
+	slots[slot] = (struct queue_slot) {
+		.queued_at = k_uptime_get(),
+		.seq = next_seq++,
+		.topic_len = topic->size,
+		.message_id = param->message_id,
+		.used = true,
+	};
+
+#if defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE)
+	slots[slot].topic_hash = topic_hash(topic->utf8, topic->size);
+#endif
+
+	return 0;
+}
+
+static int record_publish(struct mqtt_client *client, uint16_t slot)
+{
+	int err;
+	size_t len = sizeof(record_buf);
+	struct mqtt_helper_queue_record_hdr hdr;
+	struct mqtt_publish_param param = {
+		.message.topic.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+	};
+
+	err = mqtt_helper_queue_storage_read(slot, record_buf, &len);
+	if (err) {
+		return err;
+	}
+
+	if (len < RECORD_HDR_SIZE) {
+		return -EBADMSG;
+	}
+
+	memcpy(&hdr, record_buf, RECORD_HDR_SIZE);
+
+	if (hdr.topic_len > len - RECORD_HDR_SIZE) {
+		return -EBADMSG;
+	}
+
+	param.message.topic.topic.utf8 = &record_buf[RECORD_HDR_SIZE];
+	param.message.topic.topic.size = hdr.topic_len;
+	param.message.payload.data = &record_buf[RECORD_HDR_SIZE + hdr.topic_len];
+	param.message.payload.len = len - RECORD_HDR_SIZE - hdr.topic_len;
+	/* Keep the message ID of the application, also when the message is published again. */
+	param.message_id = hdr.message_id;
+	param.retain_flag = hdr.retain;
+
+	err = mqtt_publish(client, &param);
+	if (err) {
+		return err;
+	}
+
+	slots[slot].in_flight = true;
+
+	return 0;
+}
+
+int mqtt_helper_queue_init(void)
+{
+	int err = 0;
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+
+	if (!initialized) {
+		err = mqtt_helper_queue_storage_init(record_load, record_buf, sizeof(record_buf));
+		if (err) {
+			LOG_ERR("Failed to restore the publish queue, error: %d", err);
+		} else {
+			LOG_DBG("Publish queue restored, %zu message(s) queued", depth);
+			initialized = true;
+		}
+	}
+
+	k_mutex_unlock(&queue_lock);
+
+	return err;
+}
+
+int mqtt_helper_queue_add(const struct mqtt_publish_param *param)
+{
+	int err;
+	int slot = -ENOENT;
+	bool replace = false;
+
+	if ((param->message.topic.topic.size + param->message.payload.len) >
+	    CONFIG_MQTT_HELPER_QUEUE_MAX_MSG_SIZE) {
+		LOG_ERR("Message is too large for the publish queue");
+		return -EMSGSIZE;
+	}
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+
+#if defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE)
+	slot = coalesce_slot_get(&param->message.topic.topic);
+	replace = (slot >= 0);
+#endif /* defined(CONFIG_MQTT_HELPER_QUEUE_COALESCE) */
+
+	if (slot < 0) {
+		slot = free_slot_get();
+	}
+
+	if (slot < 0) {
+		LOG_WRN("Publish queue is full, message dropped");
+		stats.dropped++;
+		err = slot;
+		goto out;
+	}
+
+	err = record_write(slot, param);
+	if (err) {
+		LOG_ERR("Failed to store the queued message, error: %d", err);
+		goto out;
+	}
+
+	stats.queued++;
+
+	if (replace) {
+		stats.coalesced++;
+	} else {
+		depth++;
+	}
+
+	LOG_DBG("Message queued in slot %d, queue depth: %zu", slot, depth);
+
+out:
+	k_mutex_unlock(&queue_lock);
+
+	return err;
+}
+
+bool mqtt_helper_queue_is_empty(void)
+{
+	bool empty;
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+	empty = (depth == 0);
+	k_mutex_unlock(&queue_lock);
+
+	return empty;
+}
+
+void mqtt_helper_queue_drain(struct mqtt_client *client)
+{
+	int err;
+	int slot;
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+
+	if (in_flight > 0) {
+		goto out;
+	}
+
+	burst_start = k_uptime_get();
+	burst_count = 0;
+
+	while (burst_count < CONFIG_MQTT_HELPER_QUEUE_DRAIN_BURST) {
+		slot = pending_slot_get();
+		if (slot < 0) {
+			break;
+		}
+
+		err = record_publish(client, slot);
+		if ((err == -ENOENT) || (err == -EBADMSG)) {
+			/* The message cannot be restored, do not let it block the queue. */
+			LOG_WRN("Dropping unreadable queued message in slot %d", slot);
+			slot_remove(slot);
+			stats.dropped++;
+			continue;
+		} else if (err) {
+			LOG_ERR("Failed to publish queued message, error: %d", err);
+			break;
+		}
+
+		burst_count++;
+		in_flight++;
+	}
+
+	if (burst_count > 0) {
+		LOG_DBG("Published %zu queued message(s), queue depth: %zu", burst_count, depth);
+	}
+
+out:
+	k_mutex_unlock(&queue_lock);
+}
+
+void mqtt_helper_queue_on_puback(struct mqtt_client *client, uint16_t message_id)
+{
+	bool found = false;
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		if (slots[i].used && slots[i].in_flight && (slots[i].message_id == message_id)) {
+			slot_remove(i);
+			in_flight--;
+			stats.drained++;
+			found = true;
+			break;
+		}
+	}
+
+	if (found && (in_flight == 0)) {
+		stats.drain_rate = burst_count * MSEC_PER_SEC /
+				   MAX(k_uptime_get() - burst_start, 1);
+	}
+
+	k_mutex_unlock(&queue_lock);
+
+	if (found) {
+		/* Continue with the next burst once the current one is acknowledged. */
+		mqtt_helper_queue_drain(client);
+	}
+}
+
+void mqtt_helper_queue_on_disconnect(void)
+{
+	k_mutex_lock(&queue_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		slots[i].in_flight = false;
+	}
+
+	in_flight = 0;
+
+	k_mutex_unlock(&queue_lock);
+}
+
+void mqtt_helper_queue_stats_get(struct mqtt_helper_queue_stats *queue_stats)
+{
+	int64_t oldest = 0;
+
+	__ASSERT_NO_MSG(queue_stats != NULL);
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		if (slots[i].used && ((oldest == 0) || (slots[i].queued_at < oldest))) {
+			oldest = slots[i].queued_at;
+		}
+	}
+
+	*queue_stats = stats;
+	queue_stats->depth = depth;
+	queue_stats->oldest_age_ms = (oldest > 0) ? (k_uptime_get() - oldest) : 0;
+
+	k_mutex_unlock(&queue_lock);
+}
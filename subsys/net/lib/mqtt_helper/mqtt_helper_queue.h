@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MQTT_HELPER_QUEUE_H_
+#define MQTT_HELPER_QUEUE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/net/mqtt.h>
+
+/* Store-and-forward publish queue, used internally by the MQTT helper library. */
+
+/* Restore the messages kept in the storage. Only the first call has an effect. */
+int mqtt_helper_queue_init(void);
+
+/* Add a QoS 1 message to the queue. */
+int mqtt_helper_queue_add(const struct mqtt_publish_param *param);
+
+bool mqtt_helper_queue_is_empty(void);
+
+/* Publish the next burst of queued messages, unless the previous burst is still in flight. */
+void mqtt_helper_queue_drain(struct mqtt_client *client);
+
+/* Remove the acknowledged message from the queue, if it was published from the queue, and
+ * continue draining.
+ */
+void mqtt_helper_queue_on_puback(struct mqtt_client *client, uint16_t message_id);
+
+/* Keep the messages that are in flight, so that they are published again after reconnecting. */
+void mqtt_helper_queue_on_disconnect(void);
+
+/* A queued message is stored as a record: the header, followed by the topic and the payload. */
+struct mqtt_helper_queue_record_hdr {
+	uint32_t seq;
+	uint16_t topic_len;
+	/* Message ID given by the application, used for every publication of the message. */
+	uint16_t message_id;
+	uint8_t retain;
+	uint8_t reserved;
+} __packed;
+
+#define MQTT_HELPER_QUEUE_RECORD_MAX_SIZE \
+	(sizeof(struct mqtt_helper_queue_record_hdr) + CONFIG_MQTT_HELPER_QUEUE_MAX_MSG_SIZE)
+
+/* Storage backend interface. Each slot holds one record. */
+typedef void (*mqtt_helper_queue_storage_load_cb_t)(uint16_t slot, const uint8_t *data,
+						    size_t len);
+
+int mqtt_helper_queue_storage_init(mqtt_helper_queue_storage_load_cb_t load_cb,
+				   uint8_t *buf, size_t buf_size);
+int mqtt_helper_queue_storage_write(uint16_t slot, const uint8_t *data, size_t len);
+int mqtt_helper_queue_storage_read(uint16_t slot, uint8_t *data, size_t *len);
+int mqtt_helper_queue_storage_delete(uint16_t slot);
+
+#endif /* MQTT_HELPER_QUEUE_H_ */
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include "mqtt_helper_queue.h"
+
+static uint8_t records[CONFIG_MQTT_HELPER_QUEUE_MAX_ENTRIES][MQTT_HELPER_QUEUE_RECORD_MAX_SIZE];
+static size_t record_len[CONFIG_MQTT_HELPER_QUEUE_MAX_ENTRIES];
+
+int mqtt_helper_queue_storage_init(mqtt_helper_queue_storage_load_cb_t load_cb,
+				   uint8_t *buf, size_t buf_size)
+{
+	ARG_UNUSED(load_cb);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(buf_size);
+
+	/* Nothing to restore, the RAM is not retained across reboots. */
+	return 0;
+}
+
+int mqtt_helper_queue_storage_write(uint16_t slot, const uint8_t *data, size_t len)
+{
+	if ((slot >= ARRAY_SIZE(records)) || (len > sizeof(records[0]))) {
+		return -EINVAL;
+	}
+
+	memcpy(records[slot], data, len);
+	record_len[slot] = len;
+
+	return 0;
+}
+
+int mqtt_helper_queue_storage_read(uint16_t slot, uint8_t *data, size_t *len)
+{
+	if ((slot >= ARRAY_SIZE(records)) || (record_len[slot] == 0)) {
+		return -ENOENT;
+	}
+
+	if (*len < record_len[slot]) {
+		return -ENOMEM;
+	}
+
+	memcpy(data, records[slot], record_len[slot]);
+	*len = record_len[slot];
+
+	return 0;
+}
+
+int mqtt_helper_queue_storage_delete(uint16_t slot)
+{
+	if (slot >= ARRAY_SIZE(records)) {
+		return -EINVAL;
+	}
+
+	record_len[slot] = 0;
+
+	return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+
+#include "mqtt_helper_queue.h"
+
+LOG_MODULE_DECLARE(mqtt_helper, CONFIG_MQTT_HELPER_LOG_LEVEL);
+
+#define QUEUE_SETTINGS_KEY "mqtt_helper/queue"
+
+/* Settings key, "/", slot number of up to five digits and the null terminator. */
+#define QUEUE_SETTINGS_KEY_MAX_LEN (sizeof(QUEUE_SETTINGS_KEY) + 6)
+
+struct queue_load_info {
+	mqtt_helper_queue_storage_load_cb_t load_cb;
+	uint8_t *buf;
+	size_t buf_size;
+};
+
+struct queue_read_info {
+	uint8_t *data;
+	size_t size;
+	ssize_t ret;
+};
+
+static void key_create(char *key, uint16_t slot)
+{
+	snprintf(key, QUEUE_SETTINGS_KEY_MAX_LEN, QUEUE_SETTINGS_KEY "/%u", slot);
+}
+
+static int queue_settings_load(const char *key, size_t len, settings_read_cb read_cb,
+			       void *cb_arg, void *param)
+{
+	struct queue_load_info *info = param;
+	unsigned long slot;
+	char *end;
+	ssize_t ret;
+
+	/* Skip deleted entries. */
+	if ((key == NULL) || (len == 0)) {
+		return 0;
+	}
+
+	slot = strtoul(key, &end, 10);
+
+	if ((end == key) || (*end != '\0') || (slot > UINT16_MAX) || (len > info->buf_size)) {
+		LOG_WRN("Ignoring invalid queued message: %s", key);
+		return 0;
+	}
+
+	ret = read_cb(cb_arg, info->buf, len);
+	if (ret < 0) {
+		LOG_WRN("Failed to read queued message %s, error: %d", key, (int)ret);
+		return 0;
+	}
+
+	info->load_cb((uint16_t)slot, info->buf, ret);
+
+	return 0;
+}
+
+static int queue_settings_read(const char *key, size_t len, settings_read_cb read_cb,
+			       void *cb_arg, void *param)
+{
+	struct queue_read_info *info = param;
+
+	/* Only the exact key matches. */
+	if (key != NULL) {
+		return 0;
+	}
+
+	if (len == 0) {
+		info->ret = -ENOENT;
+	} else if (len > info->size) {
+		info->ret = -ENOMEM;
+	} else {
+		info->ret = read_cb(cb_arg, info->data, len);
+	}
+
+	return 0;
+}
+
+int mqtt_helper_queue_storage_init(mqtt_helper_queue_storage_load_cb_t load_cb,
+				   uint8_t *buf, size_t buf_size)
+{
+	int err;
+	struct queue_load_info info = {
+		.load_cb = load_cb,
+		.buf = buf,
+		.buf_size = buf_size,
+	};
+
+	err = settings_subsys_init();
+	if (err) {
+		LOG_ERR("Failed to initialize settings, error: %d", err);
+		return err;
+	}
+
+	return settings_load_subtree_direct(QUEUE_SETTINGS_KEY, queue_settings_load, &info);
+}
+
+int mqtt_helper_queue_storage_write(uint16_t slot, const uint8_t *data, size_t len)
+{
+	char key[QUEUE_SETTINGS_KEY_MAX_LEN];
+
+	key_create(key, slot);
+
+	return settings_save_one(key, data, len);
+}
+
+int mqtt_helper_queue_storage_read(uint16_t slot, uint8_t *data, size_t *len)
+{
+	int err;
+	char key[QUEUE_SETTINGS_KEY_MAX_LEN];
+	struct queue_read_info info = {
+		.data = data,
+		.size = *len,
+		/* Set a fallback error if the key is not found. */
+		.ret = -ENOENT,
+	};
+
+	key_create(key, slot);
+
+	err = settings_load_subtree_direct(key, queue_settings_read, &info);
+	if (err) {
+		return err;
+	}
+
+	if (info.ret < 0) {
+		return info.ret;
+	}
+
+	*len = info.ret;
+
+	return 0;
+}
+
+int mqtt_helper_queue_storage_delete(uint16_t slot)
+{
+	char key[QUEUE_SETTINGS_KEY_MAX_LEN];
+
+	key_create(key, slot);
+
+	return settings_delete(key);
+}
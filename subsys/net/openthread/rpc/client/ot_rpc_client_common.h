@@ -7,7 +7,40 @@
 #include <ot_rpc_common.h>
 #include <ot_rpc_ids.h>
 
+#include <openthread/message.h>
 #include <openthread/thread.h>
 
 size_t ot_rpc_get_string(enum ot_rpc_cmd_server cmd, char *buffer, size_t buffer_size);
 otError ot_rpc_set_string(enum ot_rpc_cmd_server cmd, const char *data);
+
+/** Counts an RPC command issued by the message API. */
+void ot_rpc_msg_round_trip_count(void);
+
+/** Locks the message staging slots. The lock is recursive. */
+void ot_rpc_msg_lock(void);
+
+/** Unlocks the message staging slots. */
+void ot_rpc_msg_unlock(void);
+
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+/** Message data collected on the client before it is passed to the RPC server. */
+struct ot_rpc_msg_staging {
+	/** Message key, or 0 if the staging slot is free. */
+	ot_rpc_res_tab_key key;
+	/** Length of the message data already passed to the RPC server. */
+	uint16_t server_length;
+	/** Length of the staged data. */
+	uint16_t length;
+	/** Staged data. */
+	uint8_t data[CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING_SIZE];
+};
+
+/**
+ * Returns the staging slot of the message, or NULL if the message is not staged.
+ * The slot may only be accessed while holding the lock taken with @ref ot_rpc_msg_lock.
+ */
+struct ot_rpc_msg_staging *ot_rpc_msg_staging_find(const otMessage *message);
+
+/** Releases the staging slot, the message is handled by the RPC server afterwards. */
+void ot_rpc_msg_staging_free(struct ot_rpc_msg_staging *staging);
+#endif /* CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING */
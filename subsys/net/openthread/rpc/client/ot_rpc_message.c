@@ -8,34 +8,186 @@
 #include <ot_rpc_ids.h>
 #include <ot_rpc_types.h>
 #include <ot_rpc_common.h>
+#include <ot_rpc_client_common.h>
 #include <ot_rpc_macros.h>
 
 #include <nrf_rpc_cbor.h>
+#include <net/ot_rpc.h>
 
 #include <openthread/error.h>
 #include <openthread/udp.h>
 
+#include <zephyr/kernel.h>
+
 #include <string.h>
 
-otError otMessageAppend(otMessage *aMessage, const void *aBuf, uint16_t aLength)
+/* Protects the round trip counter and the staging slots. */
+static K_MUTEX_DEFINE(message_mutex);
+static uint32_t round_trips;
+
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+static struct ot_rpc_msg_staging stagings[CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING_COUNT];
+#endif
+
+void ot_rpc_msg_lock(void)
+{
+	k_mutex_lock(&message_mutex, K_FOREVER);
+}
+
+void ot_rpc_msg_unlock(void)
+{
+	k_mutex_unlock(&message_mutex);
+}
+
+void ot_rpc_msg_round_trip_count(void)
+{
+	ot_rpc_msg_lock();
+	round_trips++;
+	ot_rpc_msg_unlock();
+}
+
+uint32_t ot_rpc_get_message_round_trips(void)
+{
+	uint32_t count;
+
+	ot_rpc_msg_lock();
+	count = round_trips;
+	ot_rpc_msg_unlock();
+
+	return count;
+}
+
+static otError message_append(ot_rpc_res_tab_key key, const void *buf, uint16_t length)
 {
 	struct nrf_rpc_cbor_ctx ctx;
-	ot_rpc_res_tab_key key = (ot_rpc_res_tab_key)aMessage;
 	otError error = OT_ERROR_NONE;
 
-	if (aLength == 0 || aBuf == NULL) {
-		return error;
-	}
-
-	NRF_RPC_CBOR_ALLOC(&ot_group, ctx, aLength + sizeof(key) + 5);
+	NRF_RPC_CBOR_ALLOC(&ot_group, ctx, length + sizeof(key) + 5);
 	nrf_rpc_encode_uint(&ctx, key);
-	nrf_rpc_encode_buffer(&ctx, aBuf, aLength);
+	nrf_rpc_encode_buffer(&ctx, buf, length);
+	ot_rpc_msg_round_trip_count();
 	nrf_rpc_cbor_cmd_no_err(&ot_group, OT_RPC_CMD_MESSAGE_APPEND, &ctx, ot_rpc_decode_error,
 				&error);
 
 	return error;
 }
 
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+struct ot_rpc_msg_staging *ot_rpc_msg_staging_find(const otMessage *message)
+{
+	ot_rpc_res_tab_key key = (ot_rpc_res_tab_key)message;
+
+	if (key == 0) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(stagings); i++) {
+		if (stagings[i].key == key) {
+			return &stagings[i];
+		}
+	}
+
+	return NULL;
+}
+
+void ot_rpc_msg_staging_free(struct ot_rpc_msg_staging *staging)
+{
+	staging->key = 0;
+	staging->server_length = 0;
+	staging->length = 0;
+}
+
+static void staging_alloc(ot_rpc_res_tab_key key)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(stagings); i++) {
+		if (stagings[i].key == 0) {
+			/* A new UDP message has no data, the headers are only reserved. */
+			stagings[i].key = key;
+			return;
+		}
+	}
+}
+
+static otError staging_flush(struct ot_rpc_msg_staging *staging)
+{
+	otError error;
+
+	if (staging->length == 0) {
+		return OT_ERROR_NONE;
+	}
+
+	error = message_append(staging->key, staging->data, staging->length);
+
+	/* Keep the data if it was not appended, it is passed again by the next flush or send. */
+	if (error == OT_ERROR_NONE) {
+		staging->server_length += staging->length;
+		staging->length = 0;
+	}
+
+	return error;
+}
+
+static otError staging_append(struct ot_rpc_msg_staging *staging, const void *buf,
+			      uint16_t length)
+{
+	otError error;
+
+	if (staging->server_length + staging->length + length > UINT16_MAX) {
+		return OT_ERROR_NO_BUFS;
+	}
+
+	if (staging->length + length > sizeof(staging->data)) {
+		error = staging_flush(staging);
+
+		if (error != OT_ERROR_NONE) {
+			return error;
+		}
+	}
+
+	if (length > sizeof(staging->data)) {
+		error = message_append(staging->key, buf, length);
+
+		if (error == OT_ERROR_NONE) {
+			staging->server_length += length;
+		}
+
+		return error;
+	}
+
+	memcpy(&staging->data[staging->length], buf, length);
+	staging->length += length;
+
+	return OT_ERROR_NONE;
+}
+#endif /* CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING */
+
+otError otMessageAppend(otMessage *aMessage, const void *aBuf, uint16_t aLength)
+{
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	struct ot_rpc_msg_staging *staging;
+#endif
+
+	if (aLength == 0 || aBuf == NULL) {
+		return OT_ERROR_NONE;
+	}
+
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	ot_rpc_msg_lock();
+	staging = ot_rpc_msg_staging_find(aMessage);
+
+	if (staging != NULL) {
+		otError error = staging_append(staging, aBuf, aLength);
+
+		ot_rpc_msg_unlock();
+		return error;
+	}
+
+	ot_rpc_msg_unlock();
+#endif
+
+	return message_append((ot_rpc_res_tab_key)aMessage, aBuf, aLength);
+}
+
 otMessage *otUdpNewMessage(otInstance *aInstance, const otMessageSettings *aSettings)
 {
 	otMessage *msg = NULL;
@@ -48,6 +200,7 @@ otMessage *otUdpNewMessage(otInstance *aInstance, const otMessageSettings *aSett
 
 	ot_rpc_encode_message_settings(&ctx, aSettings);
 
+	ot_rpc_msg_round_trip_count();
 	nrf_rpc_cbor_cmd_rsp_no_err(&ot_group, OT_RPC_CMD_UDP_NEW_MESSAGE, &ctx);
 
 	key = nrf_rpc_decode_uint(&ctx);
@@ -56,6 +209,14 @@ otMessage *otUdpNewMessage(otInstance *aInstance, const otMessageSettings *aSett
 		return msg;
 	}
 
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	if (key != 0) {
+		ot_rpc_msg_lock();
+		staging_alloc(key);
+		ot_rpc_msg_unlock();
+	}
+#endif
+
 	msg = (otMessage *)key;
 	return msg;
 }
@@ -64,10 +225,23 @@ void otMessageFree(otMessage *aMessage)
 {
 	struct nrf_rpc_cbor_ctx ctx;
 	ot_rpc_res_tab_key key = (ot_rpc_res_tab_key)aMessage;
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	struct ot_rpc_msg_staging *staging;
+
+	ot_rpc_msg_lock();
+	staging = ot_rpc_msg_staging_find(aMessage);
+
+	if (staging != NULL) {
+		ot_rpc_msg_staging_free(staging);
+	}
+
+	ot_rpc_msg_unlock();
+#endif
 
 	NRF_RPC_CBOR_ALLOC(&ot_group, ctx, sizeof(ot_rpc_res_tab_key) + 1);
 
 	nrf_rpc_encode_uint(&ctx, key);
+	ot_rpc_msg_round_trip_count();
 	nrf_rpc_cbor_cmd_rsp_no_err(&ot_group, OT_RPC_CMD_MESSAGE_FREE, &ctx);
 	nrf_rpc_cbor_decoding_done(&ot_group, &ctx);
 }
@@ -77,10 +251,25 @@ uint16_t otMessageGetLength(const otMessage *aMessage)
 	struct nrf_rpc_cbor_ctx ctx;
 	ot_rpc_res_tab_key key = (ot_rpc_res_tab_key)aMessage;
 	uint16_t ret = 0;
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	struct ot_rpc_msg_staging *staging;
+
+	ot_rpc_msg_lock();
+	staging = ot_rpc_msg_staging_find(aMessage);
+
+	if (staging != NULL) {
+		ret = staging->server_length + staging->length;
+		ot_rpc_msg_unlock();
+		return ret;
+	}
+
+	ot_rpc_msg_unlock();
+#endif
 
 	NRF_RPC_CBOR_ALLOC(&ot_group, ctx, sizeof(uint32_t) + 1);
 
 	nrf_rpc_encode_uint(&ctx, key);
+	ot_rpc_msg_round_trip_count();
 	nrf_rpc_cbor_cmd_rsp_no_err(&ot_group, OT_RPC_CMD_MESSAGE_GET_LENGTH, &ctx);
 
 	ret = nrf_rpc_decode_uint(&ctx);
@@ -99,9 +288,23 @@ uint16_t otMessageGetOffset(const otMessage *aMessage)
 	ot_rpc_res_tab_key key = (ot_rpc_res_tab_key)aMessage;
 	uint16_t ret = 0;
 
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	bool staged;
+
+	ot_rpc_msg_lock();
+	staged = ot_rpc_msg_staging_find(aMessage) != NULL;
+	ot_rpc_msg_unlock();
+
+	/* The offset of a new UDP message is 0 and the API does not allow changing it. */
+	if (staged) {
+		return 0;
+	}
+#endif
+
 	NRF_RPC_CBOR_ALLOC(&ot_group, ctx, sizeof(uint32_t) + 1);
 
 	nrf_rpc_encode_uint(&ctx, key);
+	ot_rpc_msg_round_trip_count();
 	nrf_rpc_cbor_cmd_rsp_no_err(&ot_group, OT_RPC_CMD_MESSAGE_GET_OFFSET, &ctx);
 
 	ret = nrf_rpc_decode_uint(&ctx);
@@ -120,17 +323,50 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
 	ot_rpc_res_tab_key key = (ot_rpc_res_tab_key)aMessage;
 	size_t size = 0;
 	const void *buf = NULL;
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	struct ot_rpc_msg_staging *staging;
+#endif
 
 	if (aLength == 0 || aBuf == NULL || aMessage == NULL) {
 		return 0;
 	}
 
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	ot_rpc_msg_lock();
+	staging = ot_rpc_msg_staging_find(aMessage);
+
+	if (staging != NULL) {
+		if (aOffset >= staging->server_length + staging->length) {
+			ot_rpc_msg_unlock();
+			return 0;
+		}
+
+		/* Read the staged part locally, the rest is read from the RPC server. */
+		if (aOffset >= staging->server_length) {
+			size = MIN(aLength, staging->server_length + staging->length - aOffset);
+			memcpy(aBuf, &staging->data[aOffset - staging->server_length], size);
+			ot_rpc_msg_unlock();
+
+			return size;
+		}
+
+		if (aOffset + aLength > staging->server_length &&
+		    staging_flush(staging) != OT_ERROR_NONE) {
+			ot_rpc_msg_unlock();
+			return 0;
+		}
+	}
+
+	ot_rpc_msg_unlock();
+#endif
+
 	NRF_RPC_CBOR_ALLOC(&ot_group, ctx, sizeof(key) + sizeof(aOffset) + sizeof(aLength) + 5);
 
 	nrf_rpc_encode_uint(&ctx, key);
 	nrf_rpc_encode_uint(&ctx, aOffset);
 	nrf_rpc_encode_uint(&ctx, aLength);
 
+	ot_rpc_msg_round_trip_count();
 	nrf_rpc_cbor_cmd_rsp_no_err(&ot_group, OT_RPC_CMD_MESSAGE_READ, &ctx);
 
 	buf = nrf_rpc_decode_buffer_ptr_and_size(&ctx, &size);
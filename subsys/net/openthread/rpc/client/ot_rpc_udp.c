@@ -8,6 +8,7 @@
 #include <ot_rpc_ids.h>
 #include <ot_rpc_types.h>
 #include <ot_rpc_common.h>
+#include <ot_rpc_client_common.h>
 #include <ot_rpc_lock.h>
 #include <ot_rpc_macros.h>
 #include <ot_rpc_os.h>
@@ -151,6 +152,9 @@ otError otUdpSend(otInstance *aInstance, otUdpSocket *aSocket, otMessage *aMessa
 	ot_socket_key soc_key = (ot_socket_key)aSocket;
 	ot_rpc_res_tab_key msg_key = (ot_rpc_res_tab_key)aMessage;
 	otError error = OT_ERROR_NONE;
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	struct ot_rpc_msg_staging *staging;
+#endif
 
 	OT_RPC_UNUSED(aInstance);
 
@@ -158,10 +162,39 @@ otError otUdpSend(otInstance *aInstance, otUdpSocket *aSocket, otMessage *aMessa
 		return OT_ERROR_INVALID_ARGS;
 	}
 
+#if defined(CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING)
+	ot_rpc_msg_lock();
+	staging = ot_rpc_msg_staging_find(aMessage);
+
+	if (staging != NULL && staging->length > 0) {
+		/* Append the staged data and send the message in a single command. */
+		NRF_RPC_CBOR_ALLOC(&ot_group, ctx, sizeof(otMessageInfo) + staging->length + 21);
+		nrf_rpc_encode_uint(&ctx, soc_key);
+		nrf_rpc_encode_uint(&ctx, msg_key);
+		nrf_rpc_encode_buffer(&ctx, staging->data, staging->length);
+		ot_rpc_encode_message_info(&ctx, aMessageInfo);
+		ot_rpc_msg_staging_free(staging);
+		ot_rpc_msg_unlock();
+		ot_rpc_msg_round_trip_count();
+		nrf_rpc_cbor_cmd_no_err(&ot_group, OT_RPC_CMD_UDP_SEND_WITH_DATA, &ctx,
+					ot_rpc_decode_error, &error);
+
+		return error;
+	}
+
+	/* Whatever the result, the message state is only known by the RPC server afterwards. */
+	if (staging != NULL) {
+		ot_rpc_msg_staging_free(staging);
+	}
+
+	ot_rpc_msg_unlock();
+#endif
+
 	NRF_RPC_CBOR_ALLOC(&ot_group, ctx, sizeof(otMessageInfo) + 16);
 	nrf_rpc_encode_uint(&ctx, soc_key);
 	nrf_rpc_encode_uint(&ctx, msg_key);
 	ot_rpc_encode_message_info(&ctx, aMessageInfo);
+	ot_rpc_msg_round_trip_count();
 	nrf_rpc_cbor_cmd_no_err(&ot_group, OT_RPC_CMD_UDP_SEND, &ctx, ot_rpc_decode_error, &error);
 
 	return error;
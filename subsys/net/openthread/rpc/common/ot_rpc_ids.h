@@ -175,6 +175,7 @@ enum ot_rpc_cmd_server {
 
 	/* OpenThread over RPC API additions */
 	OT_RPC_CMD_LINK_SET_FACTORY_ASSIGNED_EUI64,
+	OT_RPC_CMD_UDP_SEND_WITH_DATA,
 };
 
 #endif /* OT_RPC_IDS_H_ */
@@ -172,6 +172,59 @@ exit:
 	nrf_rpc_cbor_rsp_no_err(group, &rsp_ctx);
 }
 
+static void ot_rpc_udp_send_with_data(const struct nrf_rpc_group *group,
+				      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct nrf_rpc_cbor_ctx rsp_ctx;
+	otError error = OT_ERROR_INVALID_ARGS;
+	ot_socket_key soc_key;
+	ot_rpc_res_tab_key msg_key;
+	nrf_udp_socket *socket;
+	otMessageInfo message_info;
+	otMessage *message;
+	const void *data;
+	size_t size = 0;
+
+	memset(&message_info, 0, sizeof(message_info));
+
+	soc_key = nrf_rpc_decode_uint(ctx);
+	msg_key = nrf_rpc_decode_uint(ctx);
+	data = nrf_rpc_decode_buffer_ptr_and_size(ctx, &size);
+	ot_rpc_decode_message_info(ctx, &message_info);
+
+	/* The data is only valid until the decoding is done. */
+	if (nrf_rpc_decode_valid(ctx) && data != NULL) {
+		socket = nrf_udp_find_socket(soc_key);
+
+		ot_rpc_mutex_lock();
+		message = ot_res_tab_msg_get(msg_key);
+
+		if (socket != NULL && message != NULL) {
+			error = otMessageAppend(message, data, size);
+		}
+
+		if (error == OT_ERROR_NONE) {
+			error = otUdpSend(openthread_get_default_instance(), &socket->mSocket,
+					  message, &message_info);
+		}
+
+		if (error == OT_ERROR_NONE) {
+			ot_res_tab_msg_free(msg_key);
+		}
+
+		ot_rpc_mutex_unlock();
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		ot_rpc_report_cmd_decoding_error(OT_RPC_CMD_UDP_SEND_WITH_DATA);
+		return;
+	}
+
+	NRF_RPC_CBOR_ALLOC(group, rsp_ctx, sizeof(error) + 1);
+	nrf_rpc_encode_uint(&rsp_ctx, error);
+	nrf_rpc_cbor_rsp_no_err(group, &rsp_ctx);
+}
+
 static void ot_rpc_udp_bind(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 			    void *handler_data)
 {
@@ -317,3 +370,6 @@ NRF_RPC_CBOR_CMD_DECODER(ot_group, ot_rpc_udp_is_open, OT_RPC_CMD_UDP_IS_OPEN, o
 NRF_RPC_CBOR_CMD_DECODER(ot_group, ot_rpc_udp_open, OT_RPC_CMD_UDP_OPEN, ot_rpc_udp_open, NULL);
 
 NRF_RPC_CBOR_CMD_DECODER(ot_group, ot_rpc_udp_send, OT_RPC_CMD_UDP_SEND, ot_rpc_udp_send, NULL);
+
+NRF_RPC_CBOR_CMD_DECODER(ot_group, ot_rpc_udp_send_with_data, OT_RPC_CMD_UDP_SEND_WITH_DATA,
+			 ot_rpc_udp_send_with_data, NULL);
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
+#include <nfc/ndef/msg_view.h>
+
+/* Sum of sizes of fields: TNF-flags, Type Length,
+ * Payload Length in short NDEF record.
+ */
+#define NDEF_RECORD_BASE_SHORT_LEN (2 + NDEF_RECORD_PAYLOAD_LEN_SHORT_SIZE)
+
+int nfc_ndef_rec_view_parse(struct nfc_ndef_rec_view *rec, const uint8_t *data, uint32_t *len)
+{
+	uint32_t header_len = NDEF_RECORD_BASE_SHORT_LEN;
+	uint32_t fields_len;
+	uint8_t flags;
+
+	if (header_len > *len) {
+		return -EINVAL;
+	}
+
+	flags = data[0];
+
+	rec->tnf = (enum nfc_ndef_record_tnf)(flags & NDEF_RECORD_TNF_MASK);
+
+	/* An NDEF parser that receives an NDEF record with an unknown
+	 * or unsupported TNF field value
+	 * SHOULD treat it as Unknown. See NFCForum-TS-NDEF_1.0
+	 */
+	if (rec->tnf == TNF_RESERVED) {
+		rec->tnf = TNF_UNKNOWN_TYPE;
+	}
+
+	rec->location = (enum nfc_ndef_record_location)(flags & NDEF_RECORD_LOCATION_MASK);
+	rec->type_length = data[1];
+
+	if (flags & NDEF_RECORD_SR_MASK) {
+		rec->payload_length = data[2];
+	} else {
+		header_len += NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE - NDEF_RECORD_PAYLOAD_LEN_SHORT_SIZE;
+
+		if (header_len > *len) {
+			return -EINVAL;
+		}
+
+		rec->payload_length = sys_get_be32(&data[2]);
+	}
+
+	if (flags & NDEF_RECORD_IL_MASK) {
+		header_len += NDEF_RECORD_ID_LEN_SIZE;
+
+		if (header_len > *len) {
+			return -EINVAL;
+		}
+
+		rec->id_length = data[header_len - 1];
+	} else {
+		rec->id_length = 0;
+	}
+
+	/* Compare against the remaining data, so that the long payload length cannot overflow. */
+	fields_len = rec->type_length + rec->id_length;
+
+	if ((fields_len > *len - header_len) ||
+	    (rec->payload_length > *len - header_len - fields_len)) {
+		return -EINVAL;
+	}
+
+	data += header_len;
+
+	rec->type = (rec->type_length > 0) ? data : NULL;
+	data += rec->type_length;
+
+	rec->id = (rec->id_length > 0) ? data : NULL;
+	data += rec->id_length;
+
+	rec->payload = (rec->payload_length > 0) ? data : NULL;
+
+	*len = header_len + fields_len + rec->payload_length;
+
+	return 0;
+}
+
+bool nfc_ndef_rec_view_type_check(const struct nfc_ndef_rec_view *rec,
+				  enum nfc_ndef_record_tnf tnf, const uint8_t *type,
+				  uint8_t type_length)
+{
+	if ((rec->tnf != tnf) || (rec->type_length != type_length)) {
+		return false;
+	}
+
+	return (type_length == 0) || (memcmp(rec->type, type, type_length) == 0);
+}
+
+void nfc_ndef_msg_view_init(struct nfc_ndef_msg_view *msg, const uint8_t *data, uint32_t len)
+{
+	msg->data = data;
+	msg->len = len;
+	msg->offset = 0;
+	msg->record_count = 0;
+	msg->end = false;
+}
+
+int nfc_ndef_msg_view_nested_init(struct nfc_ndef_msg_view *msg,
+				  const struct nfc_ndef_rec_view *rec, uint32_t offset)
+{
+	if (offset > rec->payload_length) {
+		return -EINVAL;
+	}
+
+	nfc_ndef_msg_view_init(msg, rec->payload + offset, rec->payload_length - offset);
+
+	return 0;
+}
+
+int nfc_ndef_msg_view_next(struct nfc_ndef_msg_view *msg, struct nfc_ndef_rec_view *rec)
+{
+	uint32_t rec_len;
+	int err;
+
+	if (msg->end) {
+		return -ENOENT;
+	}
+
+	/* The message must be terminated by a record with the Message End flag. */
+	if (msg->offset >= msg->len) {
+		return -EFAULT;
+	}
+
+	rec_len = msg->len - msg->offset;
+
+	err = nfc_ndef_rec_view_parse(rec, &msg->data[msg->offset], &rec_len);
+	if (err) {
+		return err;
+	}
+
+	/* Verify the records location flags. */
+	if (msg->record_count == 0) {
+		if ((rec->location != NDEF_FIRST_RECORD) && (rec->location != NDEF_LONE_RECORD)) {
+			return -EFAULT;
+		}
+	} else {
+		if ((rec->location != NDEF_MIDDLE_RECORD) && (rec->location != NDEF_LAST_RECORD)) {
+			return -EFAULT;
+		}
+	}
+
+	msg->offset += rec_len;
+	msg->record_count++;
+
+	if ((rec->location == NDEF_LAST_RECORD) || (rec->location == NDEF_LONE_RECORD)) {
+		msg->end = true;
+	}
+
+	return 0;
+}
@@ -26,6 +26,11 @@ LOG_MODULE_REGISTER(nfc_t4t_hl_procedure,
 #define NFC_T4T_APDU_SELECT_DATA {0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01}
 #define APDU_LE_MAP_2_MAX_VALUE 0xFF
 #define NFC_T4T_APDU_RSP_ALL 256
+#define RAPDU_STATUS_SIZE 2
+#define CAPDU_HEADER_SIZE 4
+#define CAPDU_LC_LONG_FORMAT_SIZE 3
+#define CAPDU_LC_SHORT_FORMAT_SIZE 1
+#define CAPDU_LC_SHORT_FORMAT_MAX 0xFF
 
 enum nfc_t4t_hl_transaction_type {
 	NFC_T4T_HL_SELECT,
@@ -34,7 +39,11 @@ enum nfc_t4t_hl_transaction_type {
 	NFC_T4T_HL_NDEF_READ,
 	NFC_T4T_HL_NDEF_NLEN_CLEAR,
 	NFC_T4T_HL_NDEF_UPDATE,
-	NFC_T4T_HL_NDEF_NLEN_UPDATE
+	NFC_T4T_HL_NDEF_NLEN_UPDATE,
+	NFC_T4T_HL_NDEF_STREAM_NLEN_READ,
+	NFC_T4T_HL_NDEF_STREAM_READ,
+	NFC_T4T_HL_NDEF_STREAM_UPDATE,
+	NFC_T4T_HL_NONE
 };
 
 struct t4t_hl_ndef {
@@ -51,9 +60,23 @@ struct t4t_hl_cc {
 	uint8_t data[CONFIG_NFC_T4T_HL_PROCEDURE_CC_BUFFER_SIZE];
 };
 
+struct t4t_hl_stream {
+	nfc_t4t_hl_procedure_ndef_sink_t sink;
+	nfc_t4t_hl_procedure_ndef_source_t source;
+	void *user_data;
+	uint32_t offset;
+	uint32_t chunk_offset;
+	int err;
+	uint8_t status_len;
+	uint8_t status[RAPDU_STATUS_SIZE];
+};
+
 struct t4t_hl_procedure {
 	struct t4t_hl_cc cc_file;
 	struct t4t_hl_ndef ndef;
+#if defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM)
+	struct t4t_hl_stream stream;
+#endif /* defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM) */
 	enum nfc_t4t_hl_transaction_type transaction_type;
 	enum nfc_t4t_hl_procedure_select select_type;
 	uint16_t file_offset;
@@ -234,6 +257,179 @@ static int ndef_file_chunk_update(void)
 	return t4t_hl_data_exchange(&apdu_comm);
 }
 
+#if defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM)
+BUILD_ASSERT(sizeof(t4t_hl.apdu_buff) > (CAPDU_HEADER_SIZE + CAPDU_LC_LONG_FORMAT_SIZE),
+	     "APDU buffer is too small for NDEF streaming");
+
+static void ndef_stream_sink(const uint8_t *data, size_t len)
+{
+	struct t4t_hl_stream *stream = &t4t_hl.stream;
+
+	if ((len == 0) || stream->err) {
+		return;
+	}
+
+	/* The tag must not return more data than requested. */
+	if (len > (t4t_hl.ndef.nlen - stream->offset)) {
+		stream->err = -ENOMEM;
+		return;
+	}
+
+	stream->err = stream->sink(stream->offset, data, len, stream->user_data);
+	stream->offset += len;
+}
+
+static void ndef_stream_push(const uint8_t *data, size_t len)
+{
+	struct t4t_hl_stream *stream = &t4t_hl.stream;
+	size_t excess;
+
+	/* The R-APDU ends with the status field, so the last received bytes
+	 * are held back until it is known whether more data follows.
+	 */
+	if (len >= RAPDU_STATUS_SIZE) {
+		ndef_stream_sink(stream->status, stream->status_len);
+		ndef_stream_sink(data, len - RAPDU_STATUS_SIZE);
+
+		memcpy(stream->status, data + len - RAPDU_STATUS_SIZE, RAPDU_STATUS_SIZE);
+		stream->status_len = RAPDU_STATUS_SIZE;
+
+		return;
+	}
+
+	if ((stream->status_len + len) > RAPDU_STATUS_SIZE) {
+		excess = stream->status_len + len - RAPDU_STATUS_SIZE;
+
+		ndef_stream_sink(stream->status, excess);
+
+		stream->status_len -= excess;
+		memmove(stream->status, stream->status + excess, stream->status_len);
+	}
+
+	memcpy(stream->status + stream->status_len, data, len);
+	stream->status_len += len;
+}
+
+/* End the streaming procedure, so that no later response is taken for a part of the stream. */
+static void ndef_stream_end(void)
+{
+	t4t_hl.transaction_type = NFC_T4T_HL_NONE;
+}
+
+static int ndef_stream_chunk_read(void)
+{
+	struct nfc_t4t_apdu_comm apdu_comm;
+	struct t4t_hl_stream *stream = &t4t_hl.stream;
+	uint16_t file_id;
+
+	if (stream->offset < t4t_hl.ndef.nlen) {
+		nfc_t4t_apdu_comm_clear(&apdu_comm);
+
+		apdu_comm.instruction = NFC_T4T_APDU_COMM_INS_READ;
+		apdu_comm.parameter = stream->offset + NDEF_FILE_NLEN_SIZE;
+		apdu_comm.resp_len = MIN(t4t_hl.ndef.nlen - stream->offset,
+				MIN(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM_MAX_LE,
+				    t4t_hl.ndef.cc->max_rapdu_size));
+
+		stream->chunk_offset = stream->offset;
+		stream->status_len = 0;
+		t4t_hl.transaction_type = NFC_T4T_HL_NDEF_STREAM_READ;
+
+		return t4t_hl_data_exchange(&apdu_comm);
+	}
+
+	ndef_stream_end();
+
+	file_id = sys_get_be16(t4t_hl.ndef.file_id);
+
+	if (hl_cb->ndef_streamed) {
+		hl_cb->ndef_streamed(file_id, t4t_hl.ndef.nlen);
+	}
+
+	return 0;
+}
+
+static int on_ndef_stream_read(const uint8_t *data, size_t len)
+{
+	struct t4t_hl_stream *stream = &t4t_hl.stream;
+	uint16_t status;
+
+	ndef_stream_push(data, len);
+
+	if (stream->err) {
+		return stream->err;
+	}
+
+	if (stream->status_len < RAPDU_STATUS_SIZE) {
+		return -EINVAL;
+	}
+
+	status = sys_get_be16(stream->status);
+	if (status != NFC_T4T_APDU_RAPDU_STATUS_CMD_COMPLETED) {
+		LOG_ERR("NFC T4T R-APDU received status: %d different than command completed.",
+			status);
+		return -EPERM;
+	}
+
+	/* Make sure that the procedure progresses. */
+	if (stream->offset == stream->chunk_offset) {
+		return -ENODATA;
+	}
+
+	return ndef_stream_chunk_read();
+}
+
+static int ndef_stream_chunk_update(void)
+{
+	int err;
+	struct nfc_t4t_apdu_comm apdu_comm;
+	struct t4t_hl_stream *stream = &t4t_hl.stream;
+	uint8_t nlen_data[NDEF_FILE_NLEN_SIZE];
+	uint16_t len;
+	uint8_t *data;
+
+	nfc_t4t_apdu_comm_clear(&apdu_comm);
+
+	apdu_comm.instruction = NFC_T4T_APDU_COMM_INS_UPDATE;
+
+	if (stream->offset < t4t_hl.ndef.nlen) {
+		len = MIN(t4t_hl.ndef.nlen - stream->offset,
+			  MIN(t4t_hl.ndef.cc->max_capdu_size,
+			      sizeof(t4t_hl.apdu_buff) - CAPDU_HEADER_SIZE -
+			      CAPDU_LC_LONG_FORMAT_SIZE));
+
+		/* Let the source fill the data at its final position in the C-APDU. */
+		data = t4t_hl.apdu_buff + CAPDU_HEADER_SIZE;
+		data += (len > CAPDU_LC_SHORT_FORMAT_MAX) ?
+			CAPDU_LC_LONG_FORMAT_SIZE : CAPDU_LC_SHORT_FORMAT_SIZE;
+
+		err = stream->source(stream->offset, data, len, stream->user_data);
+		if (err) {
+			return err;
+		}
+
+		apdu_comm.parameter = stream->offset + NDEF_FILE_NLEN_SIZE;
+		apdu_comm.data.buff = data;
+		apdu_comm.data.len = len;
+
+		stream->offset += len;
+		t4t_hl.transaction_type = NFC_T4T_HL_NDEF_STREAM_UPDATE;
+
+		return t4t_hl_data_exchange(&apdu_comm);
+	}
+
+	sys_put_be16(t4t_hl.ndef.nlen, nlen_data);
+
+	apdu_comm.parameter = 0;
+	apdu_comm.data.buff = nlen_data;
+	apdu_comm.data.len = sizeof(nlen_data);
+
+	t4t_hl.transaction_type = NFC_T4T_HL_NDEF_NLEN_UPDATE;
+
+	return t4t_hl_data_exchange(&apdu_comm);
+}
+#endif /* defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM) */
+
 static void on_ndef_nlen_update(void)
 {
 	uint16_t file_id = sys_get_be16(t4t_hl.ndef.file_id);
@@ -281,6 +477,30 @@ static int on_rapdu_succes(const struct nfc_t4t_apdu_resp *resp)
 		on_ndef_nlen_update();
 		break;
 
+#if defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM)
+	case NFC_T4T_HL_NDEF_STREAM_NLEN_READ:
+		err = on_ndef_nlen_read(resp);
+		if (err) {
+			LOG_ERR("NDEF NLEN field read failed.");
+		}
+
+		if (!err) {
+			err = ndef_stream_chunk_read();
+		}
+
+		if (err) {
+			ndef_stream_end();
+		}
+		break;
+
+	case NFC_T4T_HL_NDEF_STREAM_UPDATE:
+		err = ndef_stream_chunk_update();
+		if (err) {
+			ndef_stream_end();
+		}
+		break;
+#endif /* defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM) */
+
 	default:
 		err = -EAGAIN;
 
@@ -305,7 +525,23 @@ int nfc_t4t_hl_procedure_on_data_received(const uint8_t *data, size_t len)
 	int err = 0;
 	struct nfc_t4t_apdu_resp apdu_resp;
 
-	if ((!data) || (len < RAPDU_MIN_LEN)) {
+	if (!data) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM)
+	/* Part of the response could have been already passed to the sink. */
+	if (t4t_hl.transaction_type == NFC_T4T_HL_NDEF_STREAM_READ) {
+		err = on_ndef_stream_read(data, len);
+		if (err) {
+			ndef_stream_end();
+		}
+
+		return err;
+	}
+#endif /* defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM) */
+
+	if (len < RAPDU_MIN_LEN) {
 		return -EINVAL;
 	}
 
@@ -330,6 +566,19 @@ int nfc_t4t_hl_procedure_on_data_received(const uint8_t *data, size_t len)
 	return err;
 }
 
+bool nfc_t4t_hl_procedure_on_chained_data_received(const uint8_t *data, size_t len)
+{
+#if defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM)
+	if (t4t_hl.transaction_type == NFC_T4T_HL_NDEF_STREAM_READ) {
+		ndef_stream_push(data, len);
+
+		return true;
+	}
+#endif /* defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM) */
+
+	return false;
+}
+
 int nfc_t4t_hl_procedure_ndef_tag_app_select(void)
 {
 	struct nfc_t4t_apdu_comm apdu_comm;
@@ -470,3 +719,91 @@ int nfc_t4t_hl_procedure_ndef_update(struct nfc_t4t_cc_file *cc,
 
 	return t4t_hl_data_exchange(&apdu_comm);
 }
+
+int nfc_t4t_hl_procedure_ndef_read_stream(struct nfc_t4t_cc_file *cc,
+					  nfc_t4t_hl_procedure_ndef_sink_t sink,
+					  void *user_data)
+{
+#if defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM)
+	int err;
+	struct nfc_t4t_apdu_comm apdu_comm;
+
+	if (!cc || !sink) {
+		return -EINVAL;
+	}
+
+	memset(&t4t_hl.stream, 0, sizeof(t4t_hl.stream));
+
+	t4t_hl.stream.sink = sink;
+	t4t_hl.stream.user_data = user_data;
+	t4t_hl.ndef.cc = cc;
+
+	nfc_t4t_apdu_comm_clear(&apdu_comm);
+
+	apdu_comm.instruction = NFC_T4T_APDU_COMM_INS_READ;
+	apdu_comm.parameter = 0;
+	apdu_comm.resp_len = NDEF_FILE_NLEN_SIZE;
+
+	t4t_hl.transaction_type = NFC_T4T_HL_NDEF_STREAM_NLEN_READ;
+
+	err = t4t_hl_data_exchange(&apdu_comm);
+	if (err) {
+		ndef_stream_end();
+	}
+
+	return err;
+#else
+	return -ENOTSUP;
+#endif /* defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM) */
+}
+
+int nfc_t4t_hl_procedure_ndef_update_stream(struct nfc_t4t_cc_file *cc, uint16_t nlen,
+					    nfc_t4t_hl_procedure_ndef_source_t source,
+					    void *user_data)
+{
+#if defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM)
+	int err;
+	struct nfc_t4t_apdu_comm apdu_comm;
+	struct nfc_t4t_tlv_block *tlv_block;
+	uint8_t nlen_val[] = {0x00, 0x00};
+
+	if (!cc || !source) {
+		return -EINVAL;
+	}
+
+	tlv_block = nfc_t4t_cc_file_content_get(cc, sys_get_be16(t4t_hl.ndef.file_id));
+	if (!tlv_block) {
+		return -EACCES;
+	}
+
+	if ((nlen + NDEF_FILE_NLEN_SIZE) > tlv_block->value.max_file_size) {
+		return -ENOMEM;
+	}
+
+	memset(&t4t_hl.stream, 0, sizeof(t4t_hl.stream));
+
+	t4t_hl.stream.source = source;
+	t4t_hl.stream.user_data = user_data;
+	t4t_hl.ndef.nlen = nlen;
+	t4t_hl.ndef.cc = cc;
+
+	nfc_t4t_apdu_comm_clear(&apdu_comm);
+
+	/* Set NDEF NLEN to 0. */
+	apdu_comm.instruction = NFC_T4T_APDU_COMM_INS_UPDATE;
+	apdu_comm.parameter = 0;
+	apdu_comm.data.buff = nlen_val;
+	apdu_comm.data.len = sizeof(nlen_val);
+
+	t4t_hl.transaction_type = NFC_T4T_HL_NDEF_STREAM_UPDATE;
+
+	err = t4t_hl_data_exchange(&apdu_comm);
+	if (err) {
+		ndef_stream_end();
+	}
+
+	return err;
+#else
+	return -ENOTSUP;
+#endif /* defined(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM) */
+}
@@ -203,6 +203,11 @@ static int ats_parse(const uint8_t *data, size_t len)
 
 	fsci = t0 & T4T_ATS_T0_FSCI_MASK;
 
+	/* FSCI values above 8 are RFU and shall be interpreted as 8.
+	 * NFC Forum Digital Specification 2.0 14.6.2.
+	 */
+	fsci = MIN(fsci, ARRAY_SIZE(fsd_value_map) - 1);
+
 	/* FSC is mapped from FSCI in the same way like FSD.
 	 * NFC Forum Digital Specification 2.0 14.6.2.
 	 */
@@ -568,8 +573,17 @@ static int isodep_i_frame_handle(const uint8_t *data, size_t len)
 
 	LOG_DBG("Valid I-Frame received");
 
-	if ((t4t_isodep.rx_data.len + (len - index)) >
-	    t4t_isodep.rx_data.buf_size) {
+	len -= index;
+
+	/* Pass the chained block directly to the user if possible, so that
+	 * the response does not have to fit in the Rx buffer.
+	 */
+	if ((i_block & I_BLOCK_CHAINING_BIT) && t4t_isodep_cb->chained_data_received &&
+	    t4t_isodep_cb->chained_data_received(&data[index], len)) {
+		len = 0;
+	}
+
+	if ((t4t_isodep.rx_data.len + len) > t4t_isodep.rx_data.buf_size) {
 		return -ENOMEM;
 	}
 
@@ -579,8 +593,6 @@ static int isodep_i_frame_handle(const uint8_t *data, size_t len)
 		block_num_toggle();
 	}
 
-	len -= index;
-
 	memcpy(&t4t_isodep.rx_data.data[t4t_isodep.rx_data.len],
 	       &data[index], len);
 	t4t_isodep.rx_data.len += len;
@@ -22,6 +22,13 @@
 #include <psa/crypto.h>
 #include <sxsymcrypt/keyref.h>
 
+/** Maximum number of counter blocks encrypted in a single AES-ECB job. */
+#if defined(CONFIG_CRACEN_SW_CTR_BATCH_BLOCKS)
+#define CRACEN_SW_CTR_BATCH_MAX_BLOCKS CONFIG_CRACEN_SW_CTR_BATCH_BLOCKS
+#else
+#define CRACEN_SW_CTR_BATCH_MAX_BLOCKS 1
+#endif
+
 /**
  * @brief Encrypt a single AES block using ECB mode.
  *
@@ -90,6 +97,39 @@ psa_status_t cracen_sw_aes_primitive(struct sxblkcipher *blkciph, const struct s
 psa_status_t cracen_sw_increment_counter_be(uint8_t *ctr_buf, size_t ctr_buf_size,
 					    size_t start_pos);
 
+/** @brief Generate several CTR mode keystream blocks in a single AES-ECB job.
+ *
+ * The first keystream block is the encryption of @p ctr_block. The counter is incremented
+ * between consecutive blocks, so on return @p ctr_block holds the counter value used for the
+ * last generated block. The counter wraps around silently, modes that must not reuse a counter
+ * value are responsible for detecting the wrap.
+ *
+ * @param[in] blkciph The block cipher struct.
+ * @param[in] key The AES key reference.
+ * @param[in,out] ctr_block Counter block.
+ * @param[in] start_pos Counter starting position index.
+ * @param[out] keystream Output buffer of @p blocks * 16 bytes.
+ * @param[in] blocks Number of blocks, at most @ref CRACEN_SW_CTR_BATCH_MAX_BLOCKS.
+ *
+ * @retval PSA_SUCCESS		      The operation completed successfully.
+ * @retval PSA_ERROR_INVALID_ARGUMENT @p blocks is out of range.
+ * @return Another PSA error code if the AES operation failed.
+ */
+psa_status_t cracen_sw_ctr_keystream_generate(struct sxblkcipher *blkciph,
+					       const struct sxkeyref *key, uint8_t *ctr_block,
+					       size_t start_pos, uint8_t *keystream, size_t blocks);
+
+/** @brief XOR two buffers using word-sized operations.
+ *
+ * The output buffer may be the same as either of the input buffers.
+ *
+ * @param[out] output Output buffer.
+ * @param[in] a First input buffer.
+ * @param[in] b Second input buffer.
+ * @param[in] length Length of the buffers.
+ */
+void cracen_sw_xor_bytes(uint8_t *output, const uint8_t *a, const uint8_t *b, size_t length);
+
 /** @brief Encode value as big-endian, right-aligned in buffer.
  *
  * This function is used by software workarounds for CRACEN peripheral.
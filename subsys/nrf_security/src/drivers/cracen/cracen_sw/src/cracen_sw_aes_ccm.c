@@ -331,62 +331,119 @@ static psa_status_t generate_tag(cracen_aead_operation_t *operation, uint8_t *ta
 	return PSA_SUCCESS;
 }
 
-/* Accumulate plaintext bytes for CBC-MAC, processing complete blocks */
+/* Accumulate plaintext bytes for CBC-MAC, processing complete blocks directly from the input */
 static psa_status_t accumulate_for_mac(cracen_aead_operation_t *operation, const uint8_t *data,
 				       size_t length, struct sxblkcipher *cipher)
 {
 	cracen_sw_ccm_context_t *ccm_ctx = &operation->sw_ccm_ctx;
 	psa_status_t status;
+	size_t processed = 0;
 
-	for (size_t i = 0; i < length; i++) {
-		ccm_ctx->partial_block[ccm_ctx->data_partial_len++] = data[i];
-		if (ccm_ctx->data_partial_len == SX_BLKCIPHER_AES_BLK_SZ) {
-			status = cbc_mac_update_block(cipher, &operation->keyref, ccm_ctx->cbc_mac,
-						      ccm_ctx->partial_block);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			ccm_ctx->data_partial_len = 0;
+	if (ccm_ctx->data_partial_len != 0) {
+		processed = MIN(length, SX_BLKCIPHER_AES_BLK_SZ - ccm_ctx->data_partial_len);
+		memcpy(&ccm_ctx->partial_block[ccm_ctx->data_partial_len], data, processed);
+		ccm_ctx->data_partial_len += processed;
+		if (ccm_ctx->data_partial_len < SX_BLKCIPHER_AES_BLK_SZ) {
+			return PSA_SUCCESS;
+		}
+		status = cbc_mac_update_block(cipher, &operation->keyref, ccm_ctx->cbc_mac,
+					      ccm_ctx->partial_block);
+		if (status != PSA_SUCCESS) {
+			return status;
 		}
+		ccm_ctx->data_partial_len = 0;
+	}
+
+	while (processed + SX_BLKCIPHER_AES_BLK_SZ <= length) {
+		status = cbc_mac_update_block(cipher, &operation->keyref, ccm_ctx->cbc_mac,
+					      &data[processed]);
+		if (status != PSA_SUCCESS) {
+			return status;
+		}
+		processed += SX_BLKCIPHER_AES_BLK_SZ;
+	}
+
+	if (processed < length) {
+		memcpy(ccm_ctx->partial_block, &data[processed], length - processed);
+		ccm_ctx->data_partial_len = length - processed;
 	}
 	return PSA_SUCCESS;
 }
 
-/* XOR data with CTR mode keystream, managing keystream generation and counter */
+/* XOR data with CTR mode keystream, managing keystream generation and counter.
+ * Whole blocks are generated in batches of up to CRACEN_SW_CTR_BATCH_MAX_BLOCKS per AES job,
+ * a trailing partial block keeps its keystream in the context for the next call.
+ */
 static psa_status_t ctr_xor(cracen_aead_operation_t *operation, struct sxblkcipher *cipher,
 			    const uint8_t *input, uint8_t *output, size_t length,
 			    size_t counter_size)
 {
 	cracen_sw_ccm_context_t *ccm_ctx = &operation->sw_ccm_ctx;
-	psa_status_t status;
+	uint8_t keystream[CRACEN_SW_CTR_BATCH_MAX_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ];
+	uint8_t first_ctr[SX_BLKCIPHER_AES_BLK_SZ];
+	psa_status_t status = PSA_SUCCESS;
 	size_t counter_start_pos = SX_BLKCIPHER_AES_BLK_SZ - counter_size;
+	size_t processed = 0;
+	size_t chunk_size;
+	size_t blocks;
+
+	/* Use up what is left of the current keystream block */
+	if (ccm_ctx->keystream_offset < SX_BLKCIPHER_AES_BLK_SZ) {
+		chunk_size = MIN(length, SX_BLKCIPHER_AES_BLK_SZ - ccm_ctx->keystream_offset);
+		cracen_sw_xor_bytes(output, input, &ccm_ctx->keystream[ccm_ctx->keystream_offset],
+				    chunk_size);
+		ccm_ctx->keystream_offset += chunk_size;
+		processed += chunk_size;
+	}
+
+	while (processed < length) {
+		blocks = MIN((length - processed) / SX_BLKCIPHER_AES_BLK_SZ,
+			     CRACEN_SW_CTR_BATCH_MAX_BLOCKS);
+		if (blocks == 0) {
+			/* Trailing partial block, keep its keystream for the next call */
+			blocks = 1;
+		}
 
-	for (size_t i = 0; i < length; i++) {
-		/* Generate new keystream block when current one is exhausted */
-		if (ccm_ctx->keystream_offset >= SX_BLKCIPHER_AES_BLK_SZ) {
-			status = cracen_sw_increment_counter_be(ccm_ctx->ctr_block,
-								SX_BLKCIPHER_AES_BLK_SZ,
-								counter_start_pos);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			status = cracen_sw_aes_primitive(cipher, &operation->keyref,
-							 ccm_ctx->ctr_block, ccm_ctx->keystream);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			ccm_ctx->keystream_offset = 0;
+		status = cracen_sw_increment_counter_be(ccm_ctx->ctr_block,
+							SX_BLKCIPHER_AES_BLK_SZ,
+							counter_start_pos);
+		if (status != PSA_SUCCESS) {
+			break;
+		}
+		memcpy(first_ctr, ccm_ctx->ctr_block, SX_BLKCIPHER_AES_BLK_SZ);
+		status = cracen_sw_ctr_keystream_generate(cipher, &operation->keyref,
+							  ccm_ctx->ctr_block, counter_start_pos,
+							  keystream, blocks);
+		if (status != PSA_SUCCESS) {
+			break;
+		}
+		/* The counter must not wrap within the batch either */
+		if (memcmp(&ccm_ctx->ctr_block[counter_start_pos], &first_ctr[counter_start_pos],
+			   counter_size) < 0) {
+			status = PSA_ERROR_INVALID_ARGUMENT;
+			break;
+		}
+
+		chunk_size = MIN(length - processed, blocks * SX_BLKCIPHER_AES_BLK_SZ);
+		cracen_sw_xor_bytes(&output[processed], &input[processed], keystream, chunk_size);
+		processed += chunk_size;
+
+		if (chunk_size < blocks * SX_BLKCIPHER_AES_BLK_SZ) {
+			memcpy(ccm_ctx->keystream, keystream, SX_BLKCIPHER_AES_BLK_SZ);
+			ccm_ctx->keystream_offset = chunk_size;
+		} else {
+			ccm_ctx->keystream_offset = SX_BLKCIPHER_AES_BLK_SZ;
 		}
-		output[i] = input[i] ^ ccm_ctx->keystream[ccm_ctx->keystream_offset++];
 	}
-	return PSA_SUCCESS;
+
+	safe_memzero(keystream, sizeof(keystream));
+	return status;
 }
 
 psa_status_t cracen_sw_aes_ccm_update(cracen_aead_operation_t *operation, const uint8_t *input,
 				      size_t input_length, uint8_t *output, size_t output_size,
 				      size_t *output_length)
 {
-	cracen_sw_ccm_context_t *ccm_ctx = &operation->sw_ccm_ctx;
 	struct sxblkcipher cipher;
 	psa_status_t status;
 	size_t processed = 0;
@@ -403,14 +460,15 @@ psa_status_t cracen_sw_aes_ccm_update(cracen_aead_operation_t *operation, const
 	}
 	initialize_ctr(operation);
 
-	/* Process data with CTR mode encryption/decryption and CBC-MAC authentication */
-	if (operation->dir == CRACEN_ENCRYPT) {
-		/* Encrypt: MAC plaintext, then apply CTR keystream */
-		while (processed < input_length) {
-			size_t chunk_size =
-				MIN(input_length - processed,
-				    SX_BLKCIPHER_AES_BLK_SZ - ccm_ctx->data_partial_len);
+	/* Process data with CTR mode encryption/decryption and CBC-MAC authentication,
+	 * one keystream batch at a time
+	 */
+	while (processed < input_length) {
+		size_t chunk_size = MIN(input_length - processed,
+					CRACEN_SW_CTR_BATCH_MAX_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ);
 
+		if (operation->dir == CRACEN_ENCRYPT) {
+			/* Encrypt: MAC plaintext, then apply CTR keystream */
 			status = accumulate_for_mac(operation, &input[processed], chunk_size,
 						    &cipher);
 			if (status != PSA_SUCCESS) {
@@ -422,18 +480,11 @@ psa_status_t cracen_sw_aes_ccm_update(cracen_aead_operation_t *operation, const
 			if (status != PSA_SUCCESS) {
 				return status;
 			}
-			processed += chunk_size;
-		}
-	} else {
-		/*
-		 * Decryption does the reverse of encryption, so apply CTR keystream first,
-		 * then MAC plaintext
-		 */
-		while (processed < input_length) {
-			size_t chunk_size =
-				MIN(input_length - processed,
-				    SX_BLKCIPHER_AES_BLK_SZ - ccm_ctx->data_partial_len);
-
+		} else {
+			/*
+			 * Decryption does the reverse of encryption, so apply CTR keystream first,
+			 * then MAC plaintext
+			 */
 			status = ctr_xor(operation, &cipher, &input[processed], &output[processed],
 					 chunk_size, counter_size);
 			if (status != PSA_SUCCESS) {
@@ -445,8 +496,8 @@ psa_status_t cracen_sw_aes_ccm_update(cracen_aead_operation_t *operation, const
 			if (status != PSA_SUCCESS) {
 				return status;
 			}
-			processed += chunk_size;
 		}
+		processed += chunk_size;
 	}
 	*output_length = processed;
 	return PSA_SUCCESS;
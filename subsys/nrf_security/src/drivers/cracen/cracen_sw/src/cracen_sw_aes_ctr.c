@@ -79,14 +79,12 @@ psa_status_t cracen_sw_aes_ctr_update(cracen_cipher_operation_t *operation, cons
 				      size_t *output_length)
 {
 	psa_status_t status = PSA_SUCCESS;
-	size_t bytes_written = 0;
-	size_t remaining_input;
-	const uint8_t *current_input;
-	uint8_t *current_output;
+	uint8_t keystream[CRACEN_SW_CTR_BATCH_MAX_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ];
 	uint8_t *keystream_block;
 	size_t keystream_used;
-	size_t remaining_keystream_bytes;
+	size_t bytes_written = 0;
 	size_t bytes_to_process;
+	size_t blocks;
 
 	*output_length = 0;
 
@@ -104,51 +102,61 @@ psa_status_t cracen_sw_aes_ctr_update(cracen_cipher_operation_t *operation, cons
 		return PSA_ERROR_BUFFER_TOO_SMALL;
 	}
 
-	remaining_input = input_length;
-	current_input = input;
-	current_output = output;
-
 	keystream_block = operation->unprocessed_input;
 	keystream_used = operation->unprocessed_input_bytes;
 
-	while (remaining_input > 0) {
-		/* Generate a keystream block when starting a new one */
-		if (keystream_used == 0) {
-			uint8_t current_ctr[SX_BLKCIPHER_AES_BLK_SZ];
-
-			memcpy(current_ctr, operation->iv, SX_BLKCIPHER_AES_BLK_SZ);
+	/* Use up what is left of the keystream block from the previous call */
+	if (keystream_used != 0) {
+		bytes_to_process = MIN(input_length, SX_BLKCIPHER_AES_BLK_SZ - keystream_used);
+		cracen_sw_xor_bytes(output, input, &keystream_block[keystream_used],
+				    bytes_to_process);
+		bytes_written += bytes_to_process;
+		keystream_used += bytes_to_process;
 
-			status = cracen_sw_aes_primitive(&operation->cipher, &operation->keyref,
-							 current_ctr, keystream_block);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
+		/* If the keystream block was fully consumed, bump counter for next block */
+		if (keystream_used == SX_BLKCIPHER_AES_BLK_SZ) {
+			keystream_used = 0;
+			cracen_sw_increment_counter_be(operation->iv, SX_BLKCIPHER_AES_BLK_SZ,
+						       AES_CTR_COUNTER_START_BYTE);
 		}
+	}
 
-		remaining_keystream_bytes = SX_BLKCIPHER_AES_BLK_SZ - keystream_used;
-		bytes_to_process = MIN(remaining_input, remaining_keystream_bytes);
-
-		/* XOR keystream slice with input into output */
-		for (size_t j = 0; j < bytes_to_process; j++) {
-			current_output[j] = current_input[j] ^ keystream_block[keystream_used + j];
+	while (bytes_written < input_length) {
+		blocks = MIN((input_length - bytes_written) / SX_BLKCIPHER_AES_BLK_SZ,
+			     CRACEN_SW_CTR_BATCH_MAX_BLOCKS);
+		if (blocks == 0) {
+			/* Trailing partial block, keep its keystream for the next call */
+			blocks = 1;
 		}
 
+		status = cracen_sw_ctr_keystream_generate(&operation->cipher, &operation->keyref,
+							  operation->iv, AES_CTR_COUNTER_START_BYTE,
+							  keystream, blocks);
+		if (status != PSA_SUCCESS) {
+			break;
+		}
 
-		current_input += bytes_to_process;
-		current_output += bytes_to_process;
-		remaining_input -= bytes_to_process;
+		bytes_to_process = MIN(input_length - bytes_written,
+				       blocks * SX_BLKCIPHER_AES_BLK_SZ);
+		cracen_sw_xor_bytes(&output[bytes_written], &input[bytes_written], keystream,
+				    bytes_to_process);
 		bytes_written += bytes_to_process;
-		keystream_used += bytes_to_process;
 
-		/* If the keystream block was fully consumed, bump counter for next block */
-		if (keystream_used == SX_BLKCIPHER_AES_BLK_SZ) {
-			keystream_used = 0;
-			cracen_sw_increment_counter_be(operation->iv,
-						       SX_BLKCIPHER_AES_BLK_SZ,
+		if (bytes_to_process < blocks * SX_BLKCIPHER_AES_BLK_SZ) {
+			/* operation->iv already holds the counter of this partial block */
+			memcpy(keystream_block, keystream, SX_BLKCIPHER_AES_BLK_SZ);
+			keystream_used = bytes_to_process;
+		} else {
+			cracen_sw_increment_counter_be(operation->iv, SX_BLKCIPHER_AES_BLK_SZ,
 						       AES_CTR_COUNTER_START_BYTE);
 		}
 	}
 
+	safe_memzero(keystream, sizeof(keystream));
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
 	operation->unprocessed_input_bytes = keystream_used;
 
 	*output_length = bytes_written;
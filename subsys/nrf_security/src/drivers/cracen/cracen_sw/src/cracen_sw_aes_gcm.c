@@ -54,28 +54,50 @@ static bool is_tag_length_valid(size_t tag_length)
 	       (tag_length == GCM_SPECIAL_TAG_SIZE_1) || (tag_length == GCM_SPECIAL_TAG_SIZE_2);
 }
 
+static void ghash_block_update(cracen_sw_gcm_context_t *gcm_ctx, const uint8_t *block)
+{
+	uint8_t result[SX_BLKCIPHER_AES_BLK_SZ];
+
+	cracen_sw_xor_bytes(gcm_ctx->ghash_block, gcm_ctx->ghash_block, block,
+			    SX_BLKCIPHER_AES_BLK_SZ);
+	gcm_ext_mult(gcm_ctx->h_table, gcm_ctx->ghash_block, result);
+	memcpy(gcm_ctx->ghash_block, result, SX_BLKCIPHER_AES_BLK_SZ);
+}
+
 /** GHASH_H(X1 || X2 || ... || Xm) = Ym
- *  Note: the current implementation follows NIST SP800-38D,
- *  no Shoup's tables are used now
+ *  Complete blocks are hashed directly from the input, only a trailing partial block is
+ *  buffered in unprocessed_input until more data (or padding) arrives.
  */
 static void calc_gcm_ghash(cracen_aead_operation_t *operation, const uint8_t *input,
 			   size_t input_len)
 {
 	cracen_sw_gcm_context_t *gcm_ctx = &operation->sw_gcm_ctx;
-	uint8_t result[SX_BLKCIPHER_AES_BLK_SZ] = {};
+	size_t processed = 0;
 
-	for (size_t i = 0; i < input_len; i++) {
-		operation->unprocessed_input[operation->unprocessed_input_bytes++] = input[i];
-		if (operation->unprocessed_input_bytes == SX_BLKCIPHER_AES_BLK_SZ) {
-			/** The size of the input data chunk of GHASH algorithm
-			 * is expected to be multiple of block size (NIST SP800-38D)
-			 */
-			cracen_xorbytes(gcm_ctx->ghash_block, operation->unprocessed_input,
-					SX_BLKCIPHER_AES_BLK_SZ);
-			gcm_ext_mult(gcm_ctx->h_table, gcm_ctx->ghash_block, result);
-			memcpy(gcm_ctx->ghash_block, result, SX_BLKCIPHER_AES_BLK_SZ);
-			operation->unprocessed_input_bytes = 0;
+	if (operation->unprocessed_input_bytes != 0) {
+		processed = MIN(input_len,
+				SX_BLKCIPHER_AES_BLK_SZ - operation->unprocessed_input_bytes);
+		memcpy(&operation->unprocessed_input[operation->unprocessed_input_bytes], input,
+		       processed);
+		operation->unprocessed_input_bytes += processed;
+		if (operation->unprocessed_input_bytes < SX_BLKCIPHER_AES_BLK_SZ) {
+			return;
 		}
+		/** The size of the input data chunk of GHASH algorithm
+		 * is expected to be multiple of block size (NIST SP800-38D)
+		 */
+		ghash_block_update(gcm_ctx, operation->unprocessed_input);
+		operation->unprocessed_input_bytes = 0;
+	}
+
+	while (processed + SX_BLKCIPHER_AES_BLK_SZ <= input_len) {
+		ghash_block_update(gcm_ctx, &input[processed]);
+		processed += SX_BLKCIPHER_AES_BLK_SZ;
+	}
+
+	if (processed < input_len) {
+		memcpy(operation->unprocessed_input, &input[processed], input_len - processed);
+		operation->unprocessed_input_bytes = input_len - processed;
 	}
 }
 
@@ -179,21 +201,13 @@ psa_status_t cracen_sw_aes_gcm_update_ad(cracen_aead_operation_t *operation, con
 	cracen_sw_gcm_context_t *gcm_ctx = &operation->sw_gcm_ctx;
 	struct sxblkcipher cipher;
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-	size_t processed = 0;
 
 	status = initialize_gcm_h(operation, &cipher);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
 
-	while (processed < input_length) {
-		size_t chunk_size =
-			MIN(input_length - processed,
-			    SX_BLKCIPHER_AES_BLK_SZ - operation->unprocessed_input_bytes);
-
-		calc_gcm_ghash(operation, &input[processed], chunk_size);
-		processed += chunk_size;
-	}
+	calc_gcm_ghash(operation, input, input_length);
 	gcm_ctx->total_ad_fed += input_length;
 	return status;
 }
@@ -222,34 +236,74 @@ static void initialize_ctr(cracen_aead_operation_t *operation)
 	gcm_ctx->ctr_initialized = true;
 }
 
-/* XOR data with CTR mode keystream, managing keystream generation and counter */
+/* XOR data with CTR mode keystream, managing keystream generation and counter.
+ * Whole blocks are generated in batches of up to CRACEN_SW_CTR_BATCH_MAX_BLOCKS per AES job,
+ * a trailing partial block keeps its keystream in the context for the next call.
+ */
 static psa_status_t ctr_xor(cracen_aead_operation_t *operation, struct sxblkcipher *cipher,
 			    const uint8_t *input, uint8_t *output, size_t length,
 			    size_t counter_size)
 {
 	cracen_sw_gcm_context_t *gcm_ctx = &operation->sw_gcm_ctx;
-	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	uint8_t keystream[CRACEN_SW_CTR_BATCH_MAX_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ];
+	uint8_t first_ctr[SX_BLKCIPHER_AES_BLK_SZ];
+	psa_status_t status = PSA_SUCCESS;
 	size_t counter_start_pos = SX_BLKCIPHER_AES_BLK_SZ - counter_size;
+	size_t processed = 0;
+	size_t chunk_size;
+	size_t blocks;
+
+	/* Use up what is left of the current keystream block */
+	if (gcm_ctx->keystream_offset < SX_BLKCIPHER_AES_BLK_SZ) {
+		chunk_size = MIN(length, SX_BLKCIPHER_AES_BLK_SZ - gcm_ctx->keystream_offset);
+		cracen_sw_xor_bytes(output, input, &gcm_ctx->keystream[gcm_ctx->keystream_offset],
+				    chunk_size);
+		gcm_ctx->keystream_offset += chunk_size;
+		processed += chunk_size;
+	}
 
-	for (size_t i = 0; i < length; i++) {
-		/* Generate new keystream block when current one is exhausted */
-		if (gcm_ctx->keystream_offset >= SX_BLKCIPHER_AES_BLK_SZ) {
-			status = cracen_sw_increment_counter_be(gcm_ctx->ctr_block,
-								SX_BLKCIPHER_AES_BLK_SZ,
-								counter_start_pos);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			status = cracen_sw_aes_primitive(cipher, &operation->keyref,
-							 gcm_ctx->ctr_block, gcm_ctx->keystream);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-			gcm_ctx->keystream_offset = 0;
+	while (processed < length) {
+		blocks = MIN((length - processed) / SX_BLKCIPHER_AES_BLK_SZ,
+			     CRACEN_SW_CTR_BATCH_MAX_BLOCKS);
+		if (blocks == 0) {
+			/* Trailing partial block, keep its keystream for the next call */
+			blocks = 1;
+		}
+
+		status = cracen_sw_increment_counter_be(gcm_ctx->ctr_block,
+							SX_BLKCIPHER_AES_BLK_SZ,
+							counter_start_pos);
+		if (status != PSA_SUCCESS) {
+			break;
+		}
+		memcpy(first_ctr, gcm_ctx->ctr_block, SX_BLKCIPHER_AES_BLK_SZ);
+		status = cracen_sw_ctr_keystream_generate(cipher, &operation->keyref,
+							  gcm_ctx->ctr_block, counter_start_pos,
+							  keystream, blocks);
+		if (status != PSA_SUCCESS) {
+			break;
+		}
+		/* The counter must not wrap within the batch either */
+		if (memcmp(&gcm_ctx->ctr_block[counter_start_pos], &first_ctr[counter_start_pos],
+			   counter_size) < 0) {
+			status = PSA_ERROR_INVALID_ARGUMENT;
+			break;
+		}
+
+		chunk_size = MIN(length - processed, blocks * SX_BLKCIPHER_AES_BLK_SZ);
+		cracen_sw_xor_bytes(&output[processed], &input[processed], keystream, chunk_size);
+		processed += chunk_size;
+
+		if (chunk_size < blocks * SX_BLKCIPHER_AES_BLK_SZ) {
+			memcpy(gcm_ctx->keystream, keystream, SX_BLKCIPHER_AES_BLK_SZ);
+			gcm_ctx->keystream_offset = chunk_size;
+		} else {
+			gcm_ctx->keystream_offset = SX_BLKCIPHER_AES_BLK_SZ;
 		}
-		output[i] = input[i] ^ gcm_ctx->keystream[gcm_ctx->keystream_offset++];
 	}
-	return PSA_SUCCESS;
+
+	safe_memzero(keystream, sizeof(keystream));
+	return status;
 }
 
 /* Finalize any partial data block with zero-padding and update ghash */
@@ -306,49 +360,43 @@ psa_status_t cracen_sw_aes_gcm_update(cracen_aead_operation_t *operation, const
 	size_t processed = 0;
 	size_t counter_size = GCM_Q_LEN_FROM_NONCE(operation->nonce_length);
 
-	operation->ad_finished = true;
-
 	status = initialize_gcm_h(operation, &cipher);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
 	initialize_ctr(operation);
 
-	finalize_ad_padding(operation);
+	/* Only the AD is padded, a partial data block from a previous update is continued */
+	if (!operation->ad_finished) {
+		finalize_ad_padding(operation);
+		operation->ad_finished = true;
+	}
 
-	/* Process data with CTR mode encryption/decryption */
-	if (operation->dir == CRACEN_ENCRYPT) {
-		/* Encrypt: apply CTR keystream. then GHASH */
-		while (processed < input_length) {
-			size_t chunk_size =
-				MIN(input_length - processed,
-				    SX_BLKCIPHER_AES_BLK_SZ - operation->unprocessed_input_bytes);
+	/* Process data with CTR mode encryption/decryption, one keystream batch at a time */
+	while (processed < input_length) {
+		size_t chunk_size = MIN(input_length - processed,
+					CRACEN_SW_CTR_BATCH_MAX_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ);
 
+		if (operation->dir == CRACEN_ENCRYPT) {
+			/* Encrypt: apply CTR keystream, then GHASH */
 			status = ctr_xor(operation, &cipher, &input[processed], &output[processed],
 					 chunk_size, counter_size);
 			if (status != PSA_SUCCESS) {
 				return status;
 			}
 			calc_gcm_ghash(operation, &output[processed], chunk_size);
-			processed += chunk_size;
-		}
-	} else {
-		/** Decryption does the reverse of encryption, so apply GHASH first,
-		 *  then CTR keystream
-		 */
-		while (processed < input_length) {
-			size_t chunk_size =
-				MIN(input_length - processed,
-				    SX_BLKCIPHER_AES_BLK_SZ - operation->unprocessed_input_bytes);
-
+		} else {
+			/** Decryption does the reverse of encryption, so apply GHASH first,
+			 *  then CTR keystream
+			 */
 			calc_gcm_ghash(operation, &input[processed], chunk_size);
 			status = ctr_xor(operation, &cipher, &input[processed], &output[processed],
 					 chunk_size, counter_size);
 			if (status != PSA_SUCCESS) {
 				return status;
 			}
-			processed += chunk_size;
 		}
+		processed += chunk_size;
 	}
 	*output_length = processed;
 	gcm_ctx->total_data_enc += processed;
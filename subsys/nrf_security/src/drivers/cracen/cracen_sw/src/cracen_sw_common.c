@@ -9,7 +9,9 @@
 #include <sxsymcrypt/aes.h>
 #include <sxsymcrypt/internal.h>
 #include <cracen/statuscodes.h>
+#include <string.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
 #include <cracen/common.h>
 #include <cracen_sw_common.h>
 
@@ -133,6 +135,51 @@ psa_status_t cracen_sw_increment_counter_be(uint8_t *ctr_buf, size_t ctr_buf_siz
 	return PSA_ERROR_INVALID_ARGUMENT;
 }
 
+psa_status_t cracen_sw_ctr_keystream_generate(struct sxblkcipher *blkciph,
+					       const struct sxkeyref *key, uint8_t *ctr_block,
+					       size_t start_pos, uint8_t *keystream, size_t blocks)
+{
+	uint8_t ctr_blocks[CRACEN_SW_CTR_BATCH_MAX_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ];
+	size_t output_length;
+
+	if (blocks == 0 || blocks > CRACEN_SW_CTR_BATCH_MAX_BLOCKS) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	/* Lay out consecutive counter values so that a single ECB job covers all of them. */
+	memcpy(ctr_blocks, ctr_block, SX_BLKCIPHER_AES_BLK_SZ);
+	for (size_t i = 1; i < blocks; i++) {
+		/* Wrapping is up to the mode, see cracen_sw_ctr_keystream_generate() */
+		(void)cracen_sw_increment_counter_be(ctr_block, SX_BLKCIPHER_AES_BLK_SZ, start_pos);
+		memcpy(&ctr_blocks[i * SX_BLKCIPHER_AES_BLK_SZ], ctr_block,
+		       SX_BLKCIPHER_AES_BLK_SZ);
+	}
+
+	return cracen_sw_aes_ecb_encrypt(blkciph, key, ctr_blocks,
+					 blocks * SX_BLKCIPHER_AES_BLK_SZ, keystream,
+					 blocks * SX_BLKCIPHER_AES_BLK_SZ, &output_length);
+}
+
+void cracen_sw_xor_bytes(uint8_t *output, const uint8_t *a, const uint8_t *b, size_t length)
+{
+	size_t i = 0;
+
+	/* Word-sized chunks, memcpy keeps this safe for unaligned buffers. */
+	for (; i + sizeof(uint32_t) <= length; i += sizeof(uint32_t)) {
+		uint32_t word_a;
+		uint32_t word_b;
+
+		memcpy(&word_a, &a[i], sizeof(word_a));
+		memcpy(&word_b, &b[i], sizeof(word_b));
+		word_a ^= word_b;
+		memcpy(&output[i], &word_a, sizeof(word_a));
+	}
+
+	for (; i < length; i++) {
+		output[i] = a[i] ^ b[i];
+	}
+}
+
 void cracen_sw_encode_value_be(uint8_t *buffer, size_t buffer_size, size_t value,
 			       size_t value_size)
 {
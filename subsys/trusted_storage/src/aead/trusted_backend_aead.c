@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 #include <mbedtls/platform_util.h>
@@ -25,6 +26,13 @@ LOG_MODULE_REGISTER(internal_trusted_aead, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
  * - Flags+Size as additional parameter
  * - Nonce is a number that is incremented for each encryption.
  * - Tag is left at the end of output data
+ *
+ * With CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED, the data is split into
+ * segments that are encrypted separately:
+ * - Header+segment index as additional parameter for each segment
+ * - Each segment has its own nonce, and its tag is left at its end
+ * - An object tag over the header and all segment tags, computed with an
+ *   empty plaintext, prevents mixing segments from different objects
  */
 
 #define AEAD_NONCE_SIZE 12
@@ -47,6 +55,332 @@ typedef struct stored_object {
 	uint8_t data[AEAD_MAX_BUF_SIZE];
 } stored_object;
 
+#ifdef CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED
+/* Set in the stored create flags of segmented objects. Not a valid PSA flag. */
+#define OBJECT_FLAG_SEGMENTED  BIT(31)
+
+#define SEGMENT_SIZE	       CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENT_SIZE
+#define SEGMENT_MAX_COUNT      DIV_ROUND_UP(STORAGE_MAX_ASSET_SIZE, SEGMENT_SIZE)
+#define SEGMENT_OVERHEAD       (AEAD_NONCE_SIZE + AEAD_TAG_SIZE)
+#define SEGMENT_ADD_SIZE       (sizeof(segmented_object_header) + sizeof(uint32_t))
+
+/** Header of segmented object. Starts with the same fields as stored_object_header. */
+typedef struct segmented_object_header {
+	stored_object_header header;
+	uint32_t segment_size;
+} segmented_object_header;
+
+/** Segments are stored back to back, each as nonce, encrypted data and tag. */
+typedef struct segmented_object {
+	segmented_object_header header;
+	uint8_t nonce[AEAD_NONCE_SIZE];
+	uint8_t tag[AEAD_TAG_SIZE];
+	uint8_t segments[SEGMENT_MAX_COUNT * SEGMENT_OVERHEAD + STORAGE_MAX_ASSET_SIZE];
+} segmented_object;
+#endif /* CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED */
+
+#if CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE_TIMEOUT_MS > 0
+static struct {
+	psa_storage_uid_t uid;
+	uint8_t key[AEAD_KEY_SIZE];
+	bool valid;
+} key_cache;
+
+static K_MUTEX_DEFINE(key_cache_lock);
+
+static void key_cache_clear(void)
+{
+	mbedtls_platform_zeroize(&key_cache, sizeof(key_cache));
+}
+
+static void key_cache_expire(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&key_cache_lock, K_FOREVER);
+	key_cache_clear();
+	k_mutex_unlock(&key_cache_lock);
+}
+
+static K_WORK_DELAYABLE_DEFINE(key_cache_work, key_cache_expire);
+#endif
+
+/* Get the AEAD key for the uid, from the cache if it is enabled. */
+static psa_status_t get_key(const psa_storage_uid_t uid, uint8_t *key_buf)
+{
+#if CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE_TIMEOUT_MS > 0
+	psa_status_t status = PSA_SUCCESS;
+
+	k_mutex_lock(&key_cache_lock, K_FOREVER);
+
+	if (!key_cache.valid || key_cache.uid != uid) {
+		key_cache_clear();
+
+		status = trusted_storage_get_key(uid, key_cache.key, AEAD_KEY_SIZE);
+		if (status == PSA_SUCCESS) {
+			key_cache.uid = uid;
+			key_cache.valid = true;
+			/* The lifetime is counted from the derivation, not from the last use. */
+			k_work_reschedule(&key_cache_work,
+					  K_MSEC(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE_TIMEOUT_MS));
+		}
+	}
+
+	if (status == PSA_SUCCESS) {
+		memcpy(key_buf, key_cache.key, AEAD_KEY_SIZE);
+	}
+
+	k_mutex_unlock(&key_cache_lock);
+
+	return status;
+#else
+	return trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+#endif
+}
+
+#ifdef CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED
+static size_t segment_count(size_t data_size)
+{
+	return DIV_ROUND_UP(data_size, SEGMENT_SIZE);
+}
+
+static size_t segmented_object_size(size_t data_size)
+{
+	return offsetof(segmented_object, segments) +
+	       segment_count(data_size) * SEGMENT_OVERHEAD + data_size;
+}
+
+static uint8_t *segment_get(segmented_object *object, size_t index, size_t *data_len)
+{
+	*data_len = MIN(SEGMENT_SIZE, object->header.header.data_size - index * SEGMENT_SIZE);
+
+	return object->segments + index * (SEGMENT_OVERHEAD + SEGMENT_SIZE);
+}
+
+/* Additional data for a segment is the object header followed by the segment index. */
+static void segment_add_get(const segmented_object *object, uint32_t index, uint8_t *add)
+{
+	memcpy(add, &object->header, sizeof(segmented_object_header));
+	memcpy(add + sizeof(segmented_object_header), &index, sizeof(index));
+}
+
+static psa_status_t segment_encrypt(const uint8_t *key_buf, segmented_object *object,
+				    size_t index, const void *p_data)
+{
+	psa_status_t status;
+	uint8_t add[SEGMENT_ADD_SIZE];
+	size_t data_len;
+	size_t out_length;
+	uint8_t *segment = segment_get(object, index, &data_len);
+
+	segment_add_get(object, index, add);
+
+	/* Get new nonce for each encrypted segment */
+	status = trusted_storage_get_nonce(segment, AEAD_NONCE_SIZE);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	return trusted_storage_aead_encrypt(key_buf, AEAD_KEY_SIZE, segment, AEAD_NONCE_SIZE,
+					    add, sizeof(add), p_data, data_len,
+					    segment + AEAD_NONCE_SIZE, data_len + AEAD_TAG_SIZE,
+					    &out_length);
+}
+
+static psa_status_t segment_decrypt(const uint8_t *key_buf, segmented_object *object,
+				    size_t index, uint8_t *p_data)
+{
+	uint8_t add[SEGMENT_ADD_SIZE];
+	size_t data_len;
+	size_t out_length;
+	uint8_t *segment = segment_get(object, index, &data_len);
+
+	segment_add_get(object, index, add);
+
+	return trusted_storage_aead_decrypt(key_buf, AEAD_KEY_SIZE, segment, AEAD_NONCE_SIZE,
+					    add, sizeof(add), segment + AEAD_NONCE_SIZE,
+					    data_len + AEAD_TAG_SIZE, p_data, SEGMENT_SIZE,
+					    &out_length);
+}
+
+/* Compute or verify the object tag over the header and all segment tags. */
+static psa_status_t object_tag_crypt(const uint8_t *key_buf, segmented_object *object,
+				     bool verify)
+{
+	psa_status_t status;
+	uint8_t add[sizeof(segmented_object_header) + SEGMENT_MAX_COUNT * AEAD_TAG_SIZE];
+	size_t add_len = sizeof(segmented_object_header);
+	size_t count = segment_count(object->header.header.data_size);
+	size_t out_length;
+
+	memcpy(add, &object->header, sizeof(segmented_object_header));
+
+	for (size_t i = 0; i < count; i++) {
+		size_t data_len;
+		uint8_t *segment = segment_get(object, i, &data_len);
+
+		memcpy(add + add_len, segment + AEAD_NONCE_SIZE + data_len, AEAD_TAG_SIZE);
+		add_len += AEAD_TAG_SIZE;
+	}
+
+	if (verify) {
+		return trusted_storage_aead_decrypt(key_buf, AEAD_KEY_SIZE, object->nonce,
+						    AEAD_NONCE_SIZE, add, add_len, object->tag,
+						    AEAD_TAG_SIZE, add, 0, &out_length);
+	}
+
+	status = trusted_storage_get_nonce(object->nonce, AEAD_NONCE_SIZE);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	return trusted_storage_aead_encrypt(key_buf, AEAD_KEY_SIZE, object->nonce,
+					    AEAD_NONCE_SIZE, add, add_len, add, 0, object->tag,
+					    AEAD_TAG_SIZE, &out_length);
+}
+
+/* Retrieve a segmented object and verify its structure and object tag. */
+static psa_status_t segmented_object_get(const psa_storage_uid_t uid, const char *prefix,
+					 const uint8_t *key_buf, segmented_object *object)
+{
+	psa_status_t status;
+	size_t out_length;
+
+	status = storage_get_object(uid, prefix, (void *)object, sizeof(*object), &out_length);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	if ((object->header.header.create_flags & OBJECT_FLAG_SEGMENTED) == 0) {
+		return PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	if (object->header.segment_size != SEGMENT_SIZE ||
+	    object->header.header.data_size > STORAGE_MAX_ASSET_SIZE ||
+	    out_length != segmented_object_size(object->header.header.data_size)) {
+		return PSA_ERROR_DATA_CORRUPT;
+	}
+
+	return object_tag_crypt(key_buf, object, true);
+}
+
+static psa_status_t segmented_get(const psa_storage_uid_t uid, const char *prefix,
+				  size_t data_offset, size_t data_length, void *p_data,
+				  size_t *p_data_length)
+{
+	psa_status_t status;
+	uint8_t key_buf[AEAD_KEY_SIZE + 1];
+	uint8_t segment_data[SEGMENT_SIZE];
+	segmented_object object_data;
+	size_t data_size;
+	size_t copied = 0;
+
+	/* Get AEAD key */
+	status = get_key(uid, key_buf);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = segmented_object_get(uid, prefix, key_buf, &object_data);
+	if (status != PSA_SUCCESS) {
+		goto clean_up;
+	}
+
+	data_size = object_data.header.header.data_size;
+
+	if (data_offset > data_size) {
+		*p_data_length = 0;
+		status = PSA_ERROR_INVALID_ARGUMENT;
+		goto clean_up;
+	}
+
+	data_length = MIN(data_length, data_size - data_offset);
+
+	/* Only decrypt the segments covering the requested range */
+	while (copied < data_length) {
+		size_t offset = data_offset + copied;
+		size_t index = offset / SEGMENT_SIZE;
+		size_t segment_offset = offset % SEGMENT_SIZE;
+		size_t len = MIN(SEGMENT_SIZE - segment_offset, data_length - copied);
+
+		status = segment_decrypt(key_buf, &object_data, index, segment_data);
+		if (status != PSA_SUCCESS) {
+			goto clean_up;
+		}
+
+		memcpy((uint8_t *)p_data + copied, segment_data + segment_offset, len);
+		copied += len;
+	}
+
+	*p_data_length = copied;
+
+clean_up:
+	/* Clean up */
+	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
+	mbedtls_platform_zeroize(segment_data, sizeof(segment_data));
+	mbedtls_platform_zeroize(&object_data, sizeof(object_data));
+
+	return status;
+}
+
+static psa_status_t segmented_set(const psa_storage_uid_t uid, const char *prefix,
+				  size_t data_length, const void *p_data,
+				  psa_storage_create_flags_t create_flags)
+{
+	psa_status_t status;
+	uint8_t key_buf[AEAD_KEY_SIZE + 1];
+	segmented_object object_data;
+
+	/* Get AEAD key */
+	status = get_key(uid, key_buf);
+	if (status != PSA_SUCCESS) {
+		goto cleanup_objects;
+	}
+
+	memset(&object_data.header, 0, sizeof(object_data.header));
+	object_data.header.header.create_flags = create_flags | OBJECT_FLAG_SEGMENTED;
+	object_data.header.header.data_size = data_length;
+	object_data.header.segment_size = SEGMENT_SIZE;
+
+	for (size_t i = 0; i < segment_count(data_length); i++) {
+		status = segment_encrypt(key_buf, &object_data, i,
+					 (const uint8_t *)p_data + i * SEGMENT_SIZE);
+		if (status != PSA_SUCCESS) {
+			break;
+		}
+	}
+
+	if (status == PSA_SUCCESS) {
+		status = object_tag_crypt(key_buf, &object_data, false);
+	}
+
+	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
+
+	if (status != PSA_SUCCESS) {
+		goto cleanup;
+	}
+
+	/* Write data */
+	status = storage_set_object(uid, prefix, &object_data,
+				    segmented_object_size(data_length));
+	if (status != PSA_SUCCESS) {
+		goto cleanup_objects;
+	}
+
+	goto cleanup;
+
+cleanup_objects:
+	/* Remove object if an error occurs */
+	LOG_DBG("trusted_set cleanup. status %d", status);
+	storage_remove_object(uid, prefix);
+
+cleanup:
+	mbedtls_platform_zeroize(&object_data, sizeof(object_data));
+
+	return status;
+}
+#endif /* CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED */
+
 psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 			      struct psa_storage_info_t *p_info)
 {
@@ -66,34 +400,26 @@ psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 
 	p_info->capacity = header.data_size;
 	p_info->size = header.data_size;
+#ifdef CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED
+	p_info->flags = header.create_flags & ~OBJECT_FLAG_SEGMENTED;
+#else
 	p_info->flags = header.create_flags;
+#endif
 
 	return PSA_SUCCESS;
 }
 
-psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t data_offset,
-			 size_t data_length, void *p_data, size_t *p_data_length)
+static psa_status_t aead_get(const psa_storage_uid_t uid, const char *prefix,
+			     size_t data_offset, size_t data_length, void *p_data,
+			     size_t *p_data_length)
 {
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 	uint8_t key_buf[AEAD_KEY_SIZE + 1];
 	size_t out_length;
 	stored_object object_data;
 
-	if ((p_data == NULL && data_length != 0) || p_data_length == NULL || uid == INVALID_UID) {
-		return PSA_ERROR_INVALID_ARGUMENT;
-	}
-
-	if (data_length == 0) {
-		*p_data_length = 0;
-		return PSA_SUCCESS;
-	}
-
-	if ((data_offset + data_length) > STORAGE_MAX_ASSET_SIZE) {
-		return PSA_ERROR_INVALID_ARGUMENT;
-	}
-
 	/* Get AEAD key */
-	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+	status = get_key(uid, key_buf);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
@@ -102,7 +428,7 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 	status = storage_get_object(uid, prefix, (void *)&object_data, sizeof(object_data),
 				    &out_length);
 	if (status != PSA_SUCCESS) {
-		return status;
+		goto clean_up;
 	}
 
 	status = trusted_storage_aead_decrypt(
@@ -138,42 +464,54 @@ clean_up:
 	return status;
 }
 
-psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t data_length,
-			 const void *p_data, psa_storage_create_flags_t create_flags)
+psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t data_offset,
+			 size_t data_length, void *p_data, size_t *p_data_length)
 {
-	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-	uint8_t key_buf[AEAD_KEY_SIZE + 1];
-	size_t out_length = 0;
-	stored_object object_data;
-
-	if (uid == INVALID_UID || (p_data == NULL && data_length != 0)) {
+	if ((p_data == NULL && data_length != 0) || p_data_length == NULL || uid == INVALID_UID) {
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
-	if (create_flags != PSA_STORAGE_FLAG_NONE && create_flags != PSA_STORAGE_FLAG_WRITE_ONCE) {
-		return PSA_ERROR_NOT_SUPPORTED;
+	if (data_length == 0) {
+		*p_data_length = 0;
+		return PSA_SUCCESS;
 	}
 
-	if (data_length > STORAGE_MAX_ASSET_SIZE) {
+	if ((data_offset + data_length) > STORAGE_MAX_ASSET_SIZE) {
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
-	/* Get flags */
-	status = storage_get_object(uid, prefix, (void *)&object_data.header,
-				    sizeof(object_data.header), &out_length);
+#ifdef CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED
+	psa_status_t status;
+	size_t out_length;
+	stored_object_header header;
 
-	if (status != PSA_SUCCESS && status != PSA_ERROR_DOES_NOT_EXIST) {
+	/* Get flags to find the object format */
+	status = storage_get_object(uid, prefix, (void *)&header, sizeof(header), &out_length);
+	if (status != PSA_SUCCESS) {
 		return status;
 	}
 
-	/* Do not allow to write new values if WRITE_ONCE flag is set */
-	if (status == PSA_SUCCESS &&
-	    (object_data.header.create_flags & PSA_STORAGE_FLAG_WRITE_ONCE) != 0) {
-		return PSA_ERROR_NOT_PERMITTED;
+	if ((header.create_flags & OBJECT_FLAG_SEGMENTED) != 0) {
+		return segmented_get(uid, prefix, data_offset, data_length, p_data,
+				     p_data_length);
 	}
+#endif
+
+	return aead_get(uid, prefix, data_offset, data_length, p_data, p_data_length);
+}
+
+#ifndef CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED
+static psa_status_t aead_set(const psa_storage_uid_t uid, const char *prefix,
+			     size_t data_length, const void *p_data,
+			     psa_storage_create_flags_t create_flags)
+{
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	uint8_t key_buf[AEAD_KEY_SIZE + 1];
+	size_t out_length = 0;
+	stored_object object_data;
 
 	/* Get AEAD key */
-	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+	status = get_key(uid, key_buf);
 	if (status != PSA_SUCCESS) {
 		goto cleanup_objects;
 	}
@@ -217,6 +555,45 @@ cleanup:
 
 	return status;
 }
+#endif
+
+psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t data_length,
+			 const void *p_data, psa_storage_create_flags_t create_flags)
+{
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	size_t out_length = 0;
+	stored_object_header header;
+
+	if (uid == INVALID_UID || (p_data == NULL && data_length != 0)) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	if (create_flags != PSA_STORAGE_FLAG_NONE && create_flags != PSA_STORAGE_FLAG_WRITE_ONCE) {
+		return PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	if (data_length > STORAGE_MAX_ASSET_SIZE) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	/* Get flags */
+	status = storage_get_object(uid, prefix, (void *)&header, sizeof(header), &out_length);
+
+	if (status != PSA_SUCCESS && status != PSA_ERROR_DOES_NOT_EXIST) {
+		return status;
+	}
+
+	/* Do not allow to write new values if WRITE_ONCE flag is set */
+	if (status == PSA_SUCCESS && (header.create_flags & PSA_STORAGE_FLAG_WRITE_ONCE) != 0) {
+		return PSA_ERROR_NOT_PERMITTED;
+	}
+
+#ifdef CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED
+	return segmented_set(uid, prefix, data_length, p_data, create_flags);
+#else
+	return aead_set(uid, prefix, data_length, p_data, create_flags);
+#endif
+}
 
 psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 {
@@ -243,6 +620,10 @@ psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 
 uint32_t trusted_get_support(void)
 {
+	/* PSA_STORAGE_SUPPORT_SET_EXTENDED also requires psa_ps_create(), which is not
+	 * supported. trusted_set_extended() is an unadvertised extension for objects
+	 * stored in the segmented format.
+	 */
 	return 0;
 }
 
@@ -256,12 +637,92 @@ psa_status_t trusted_create(const psa_storage_uid_t uid, size_t capacity,
 	return PSA_ERROR_NOT_SUPPORTED;
 }
 
-psa_status_t trusted_set_extended(const psa_storage_uid_t uid, size_t data_offset,
-				  size_t data_length, const void *p_data)
+psa_status_t trusted_set_extended(const psa_storage_uid_t uid, const char *prefix,
+				  size_t data_offset, size_t data_length, const void *p_data)
 {
+#ifdef CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENTED
+	psa_status_t status;
+	uint8_t key_buf[AEAD_KEY_SIZE + 1];
+	uint8_t segment_data[SEGMENT_SIZE];
+	segmented_object object_data;
+	size_t data_size;
+	size_t written = 0;
+
+	if (uid == INVALID_UID || (p_data == NULL && data_length != 0)) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	/* Get AEAD key */
+	status = get_key(uid, key_buf);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = segmented_object_get(uid, prefix, key_buf, &object_data);
+	if (status != PSA_SUCCESS) {
+		goto clean_up;
+	}
+
+	if ((object_data.header.header.create_flags & PSA_STORAGE_FLAG_WRITE_ONCE) != 0) {
+		status = PSA_ERROR_NOT_PERMITTED;
+		goto clean_up;
+	}
+
+	/* The capacity of an object is its size, see trusted_get_info() */
+	data_size = object_data.header.header.data_size;
+	if (data_offset > data_size || data_length > (data_size - data_offset)) {
+		status = PSA_ERROR_INVALID_ARGUMENT;
+		goto clean_up;
+	}
+
+	/* Only re-encrypt the segments covering the written range */
+	while (written < data_length) {
+		size_t offset = data_offset + written;
+		size_t index = offset / SEGMENT_SIZE;
+		size_t segment_offset = offset % SEGMENT_SIZE;
+		size_t segment_len;
+		size_t len = MIN(SEGMENT_SIZE - segment_offset, data_length - written);
+
+		(void)segment_get(&object_data, index, &segment_len);
+
+		if (len < segment_len) {
+			status = segment_decrypt(key_buf, &object_data, index, segment_data);
+			if (status != PSA_SUCCESS) {
+				goto clean_up;
+			}
+		}
+
+		memcpy(segment_data + segment_offset, (const uint8_t *)p_data + written, len);
+
+		status = segment_encrypt(key_buf, &object_data, index, segment_data);
+		if (status != PSA_SUCCESS) {
+			goto clean_up;
+		}
+
+		written += len;
+	}
+
+	status = object_tag_crypt(key_buf, &object_data, false);
+	if (status != PSA_SUCCESS) {
+		goto clean_up;
+	}
+
+	/* Write data. The previous object is kept if this fails. */
+	status = storage_set_object(uid, prefix, &object_data, segmented_object_size(data_size));
+
+clean_up:
+	/* Clean up */
+	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
+	mbedtls_platform_zeroize(segment_data, sizeof(segment_data));
+	mbedtls_platform_zeroize(&object_data, sizeof(object_data));
+
+	return status;
+#else
 	ARG_UNUSED(uid);
+	ARG_UNUSED(prefix);
 	ARG_UNUSED(data_offset);
 	ARG_UNUSED(data_length);
 	ARG_UNUSED(p_data);
 	return PSA_ERROR_NOT_SUPPORTED;
+#endif
 }
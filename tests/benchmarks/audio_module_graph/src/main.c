@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include "audio_module.h"
+#include "audio_module_template.h"
+#include "host_clock.h"
+
+/* A chain such as decode, mix, resample, process and output */
+#define BENCH_MODULES_NUM	    (5)
+#define BENCH_MSG_QUEUE_SIZE	    (4)
+#define BENCH_MOD_THREAD_STACK_SIZE (2048)
+#define BENCH_MOD_THREAD_PRIORITY   (4)
+#define BENCH_MSG_SIZE		    (sizeof(struct audio_module_message))
+
+/* 10 ms of 48 kHz, 16 bit, stereo audio */
+#define BENCH_FRAME_SIZE (1920)
+#define BENCH_FRAMES_NUM (200)
+
+#if defined(CONFIG_ARCH_POSIX)
+/* Simulated time does not advance while code runs, so measure on the host clock. */
+#define CLOCK_NS() bench_host_clock_ns()
+#else
+#define CLOCK_NS() k_ticks_to_ns_floor64(k_uptime_ticks())
+#endif /* defined(CONFIG_ARCH_POSIX) */
+
+K_THREAD_STACK_ARRAY_DEFINE(mod_stack, BENCH_MODULES_NUM, BENCH_MOD_THREAD_STACK_SIZE);
+K_THREAD_STACK_DEFINE(graph_stack, BENCH_MOD_THREAD_STACK_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx0, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx1, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx2, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx3, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx4, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_tx4, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+K_MEM_SLAB_DEFINE(mod_data_slab, BENCH_FRAME_SIZE, BENCH_MODULES_NUM * BENCH_MSG_QUEUE_SIZE, 4);
+
+static struct data_fifo *msg_fifo_rx_array[BENCH_MODULES_NUM] = {
+	&msg_fifo_rx0, &msg_fifo_rx1, &msg_fifo_rx2, &msg_fifo_rx3, &msg_fifo_rx4};
+
+static struct audio_module_handle handles[BENCH_MODULES_NUM];
+static struct audio_module_template_context contexts[BENCH_MODULES_NUM];
+static struct audio_module_graph graph;
+
+static uint8_t frame_in[BENCH_FRAME_SIZE];
+static uint8_t frame_out[BENCH_FRAME_SIZE];
+
+struct bench_result {
+	uint64_t cpu_cycles_per_frame;
+	uint32_t latency_avg_us;
+	uint32_t latency_max_us;
+};
+
+static void chain_modules_open(bool graph_mode)
+{
+	int ret;
+	char name[CONFIG_AUDIO_MODULE_NAME_SIZE];
+	struct audio_module_parameters mod_parameters = {0};
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Benchmark"};
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		mod_parameters.description = audio_module_template_description;
+		mod_parameters.thread.priority = BENCH_MOD_THREAD_PRIORITY;
+		mod_parameters.thread.data_slab = &mod_data_slab;
+		mod_parameters.thread.data_size = BENCH_FRAME_SIZE;
+		mod_parameters.thread.msg_tx = (i == BENCH_MODULES_NUM - 1) ? &msg_fifo_tx4 : NULL;
+
+		if (graph_mode) {
+			/* Only the head of the graph receives audio data on a FIFO. */
+			mod_parameters.thread.stack = NULL;
+			mod_parameters.thread.stack_size = 0;
+			mod_parameters.thread.msg_rx = (i == 0) ? msg_fifo_rx_array[i] : NULL;
+		} else {
+			mod_parameters.thread.stack = mod_stack[i];
+			mod_parameters.thread.stack_size = BENCH_MOD_THREAD_STACK_SIZE;
+			mod_parameters.thread.msg_rx = msg_fifo_rx_array[i];
+		}
+
+		snprintf(name, sizeof(name), "Stage %d", i);
+
+		memset(&handles[i], 0, sizeof(handles[i]));
+
+		ret = audio_module_open(
+			&mod_parameters,
+			(struct audio_module_configuration const *const)&configuration, name,
+			(struct audio_module_context *)&contexts[i], &handles[i]);
+		zassert_equal(ret, 0, "Failed to open module %d, ret %d", i, ret);
+	}
+
+	for (int i = 0; i < BENCH_MODULES_NUM - 1; i++) {
+		ret = audio_module_connect(&handles[i], &handles[i + 1], false);
+		zassert_equal(ret, 0, "Failed to connect module %d, ret %d", i, ret);
+	}
+
+	ret = audio_module_connect(&handles[BENCH_MODULES_NUM - 1], NULL, true);
+	zassert_equal(ret, 0, "Failed to connect the TX FIFO, ret %d", ret);
+}
+
+static void chain_modules_close(void)
+{
+	int ret;
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		ret = audio_module_close(&handles[i]);
+		zassert_equal(ret, 0, "Failed to close module %d, ret %d", i, ret);
+	}
+}
+
+static void chain_open(bool graph_mode)
+{
+	int ret;
+
+	chain_modules_open(graph_mode);
+
+	if (graph_mode) {
+		ret = audio_module_graph_create(&graph, &handles[0], graph_stack,
+						K_THREAD_STACK_SIZEOF(graph_stack),
+						BENCH_MOD_THREAD_PRIORITY);
+		zassert_equal(ret, 0, "Failed to create graph, ret %d", ret);
+		zassert_equal(graph.modules_num, BENCH_MODULES_NUM,
+			      "Graph has %d modules, expected %d", graph.modules_num,
+			      BENCH_MODULES_NUM);
+	}
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		ret = audio_module_start(&handles[i]);
+		zassert_equal(ret, 0, "Failed to start module %d, ret %d", i, ret);
+	}
+}
+
+static void chain_close(bool graph_mode)
+{
+	int ret;
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		ret = audio_module_stop(&handles[i]);
+		zassert_equal(ret, 0, "Failed to stop module %d, ret %d", i, ret);
+	}
+
+	if (graph_mode) {
+		ret = audio_module_graph_destroy(&graph);
+		zassert_equal(ret, 0, "Failed to destroy graph, ret %d", ret);
+	}
+
+	chain_modules_close();
+}
+
+static void chain_run(struct bench_result *result)
+{
+	int ret;
+	uint64_t start;
+	uint32_t latency_us;
+	uint64_t latency_sum_us = 0;
+	k_thread_runtime_stats_t stats_start;
+	k_thread_runtime_stats_t stats_end;
+	struct audio_data audio_data_tx = {
+		.data = frame_in,
+		.data_size = BENCH_FRAME_SIZE,
+	};
+	struct audio_data audio_data_rx;
+
+	memset(result, 0, sizeof(*result));
+
+	ret = k_thread_runtime_stats_all_get(&stats_start);
+	zassert_equal(ret, 0, "Failed to get runtime stats, ret %d", ret);
+
+	for (int i = 0; i < BENCH_FRAMES_NUM; i++) {
+		memset(frame_in, i, sizeof(frame_in));
+		audio_data_rx.data = frame_out;
+		audio_data_rx.data_size = sizeof(frame_out);
+
+		start = CLOCK_NS();
+
+		ret = audio_module_data_tx(&handles[0], &audio_data_tx, NULL);
+		zassert_equal(ret, 0, "Failed to send frame %d, ret %d", i, ret);
+
+		ret = audio_module_data_rx(&handles[BENCH_MODULES_NUM - 1], &audio_data_rx,
+					   K_FOREVER);
+		zassert_equal(ret, 0, "Failed to receive frame %d, ret %d", i, ret);
+
+		latency_us = (CLOCK_NS() - start) / NSEC_PER_USEC;
+		latency_sum_us += latency_us;
+		result->latency_max_us = MAX(result->latency_max_us, latency_us);
+
+		zassert_mem_equal(frame_in, frame_out, BENCH_FRAME_SIZE,
+				  "Frame %d corrupted in the chain", i);
+	}
+
+	ret = k_thread_runtime_stats_all_get(&stats_end);
+	zassert_equal(ret, 0, "Failed to get runtime stats, ret %d", ret);
+
+	/* Cycles used by all threads except the idle thread */
+	result->cpu_cycles_per_frame =
+		(stats_end.total_cycles - stats_start.total_cycles) / BENCH_FRAMES_NUM;
+	result->latency_avg_us = latency_sum_us / BENCH_FRAMES_NUM;
+}
+
+static void result_print(const char *mode, struct bench_result const *const result)
+{
+	TC_PRINT("%s: %llu CPU cycles per frame, latency avg %u us, max %u us\n", mode,
+		 (unsigned long long)result->cpu_cycles_per_frame, result->latency_avg_us,
+		 result->latency_max_us);
+}
+
+ZTEST(suite_audio_module_graph, test_chain_threaded_vs_graph)
+{
+	struct bench_result threaded;
+	struct bench_result graph_result;
+
+	chain_open(false);
+	chain_run(&threaded);
+	chain_close(false);
+
+	chain_open(true);
+	chain_run(&graph_result);
+	chain_close(true);
+
+	result_print("Threaded", &threaded);
+	result_print("Graph", &graph_result);
+}
+
+ZTEST(suite_audio_module_graph, test_graph_rejects_invalid_topology)
+{
+	int ret;
+
+	chain_open(false);
+
+	/* Modules running in their own threads cannot be run by a graph. */
+	ret = audio_module_graph_create(&graph, &handles[0], graph_stack,
+					K_THREAD_STACK_SIZEOF(graph_stack),
+					BENCH_MOD_THREAD_PRIORITY);
+	zassert_equal(ret, -EBUSY, "Graph create should fail with %d, ret %d", -EBUSY, ret);
+
+	chain_close(false);
+
+	chain_open(true);
+
+	/* Connections cannot be changed while the graph exists. */
+	ret = audio_module_connect(&handles[0], &handles[2], false);
+	zassert_equal(ret, -EBUSY, "Connect should fail with %d, ret %d", -EBUSY, ret);
+
+	chain_close(true);
+
+	chain_modules_open(true);
+
+	/* A module fed by more than one module cannot be run by a graph. */
+	ret = audio_module_connect(&handles[0], &handles[2], false);
+	zassert_equal(ret, 0, "Failed to connect module 0 to module 2, ret %d", ret);
+
+	ret = audio_module_graph_create(&graph, &handles[0], graph_stack,
+					K_THREAD_STACK_SIZEOF(graph_stack),
+					BENCH_MOD_THREAD_PRIORITY);
+	zassert_equal(ret, -ENOTSUP, "Graph create should fail with %d, ret %d", -ENOTSUP, ret);
+
+	chain_modules_close();
+}
+
+ZTEST_SUITE(suite_audio_module_graph, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,495 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <ff.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include "audio_module.h"
+#include "audio_module_file.h"
+#include "host_clock.h"
+#include "stage.h"
+
+#define DISK_NAME   "RAM"
+#define MOUNT_POINT "/" DISK_NAME ":"
+#define CORPUS_PATH MOUNT_POINT "/corpus.wav"
+#define SINK_PATH   MOUNT_POINT "/sink.wav"
+
+/* One second of 48 kHz, 16 bit, mono audio in 10 ms frames */
+#define SAMPLE_RATE_HZ	       (48000)
+#define SAMPLE_RATE_LOW_HZ     (16000)
+#define FRAME_DURATION_US      (10000)
+#define FRAME_SAMPLES	       (SAMPLE_RATE_HZ / 1000 * FRAME_DURATION_US / 1000)
+#define MONO_FRAME_BYTES       (FRAME_SAMPLES * sizeof(int16_t))
+#define STEREO_FRAME_BYTES     (2 * MONO_FRAME_BYTES)
+#define CORPUS_FRAMES	       (100)
+#define CORPUS_SAMPLES	       (CORPUS_FRAMES * FRAME_SAMPLES)
+#define WAV_HEADER_SIZE	       (44)
+#define FRAME_RX_TIMEOUT       K_SECONDS(1)
+
+/* CRC-32 of the corpus PCM data, and of the corpus mixed into both channels of a stereo
+ * stream. These are computed off target from the same generator.
+ */
+#define CORPUS_CRC	  (0x777115bbUL)
+#define CORPUS_STEREO_CRC (0x2a8fde27UL)
+
+#define STAGES_MAX	      (3)
+#define MODULES_MAX	      (STAGES_MAX + 2)
+#define MSG_QUEUE_SIZE	      (4)
+#define MOD_THREAD_STACK_SIZE (4096)
+#define MOD_THREAD_PRIORITY   (4)
+#define MSG_SIZE	      (sizeof(struct audio_module_message))
+
+#if defined(CONFIG_ARCH_POSIX)
+/* Simulated time does not advance while code runs, so measure on the host clock. */
+#define CLOCK_NS() bench_host_clock_ns()
+#else
+#define CLOCK_NS() k_ticks_to_ns_floor64(k_uptime_ticks())
+#endif /* defined(CONFIG_ARCH_POSIX) */
+
+K_THREAD_STACK_ARRAY_DEFINE(mod_stack, MODULES_MAX, MOD_THREAD_STACK_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx0, MSG_QUEUE_SIZE, MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx1, MSG_QUEUE_SIZE, MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx2, MSG_QUEUE_SIZE, MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx3, MSG_QUEUE_SIZE, MSG_SIZE);
+/* The source holds a buffer while it waits for the next frame, and the buffer is not returned
+ * when the source is closed. Leave room for one such buffer for each pipeline run.
+ */
+K_MEM_SLAB_DEFINE(mod_data_slab, STEREO_FRAME_BYTES, MODULES_MAX * MSG_QUEUE_SIZE, 4);
+K_SEM_DEFINE(source_sem, 0, 1);
+K_SEM_DEFINE(sink_sem, 0, 1);
+
+static struct data_fifo *msg_fifo_rx_array[STAGES_MAX + 1] = {&msg_fifo_rx0, &msg_fifo_rx1,
+							       &msg_fifo_rx2, &msg_fifo_rx3};
+
+static FATFS fat_fs;
+static struct fs_mount_t mnt_pt = {
+	.type = FS_FATFS,
+	.fs_data = &fat_fs,
+	.mnt_point = MOUNT_POINT,
+};
+
+static struct audio_module_handle source_handle;
+static struct audio_module_handle sink_handle;
+static struct audio_module_handle stage_handles[STAGES_MAX];
+static struct audio_module_file_context source_ctx;
+static struct audio_module_file_context sink_ctx;
+static struct stage_context stage_contexts[STAGES_MAX];
+
+static struct stage_resample_state resample_down;
+static struct stage_resample_state resample_up;
+#if defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE)
+static struct stage_lc3_state lc3_state;
+#endif /* defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE) */
+
+static int16_t corpus[CORPUS_SAMPLES];
+static uint8_t ref_buf[2][STEREO_FRAME_BYTES];
+
+struct chain {
+	const char *name;
+	struct stage_configuration stages[STAGES_MAX];
+	uint8_t stages_num;
+
+	/* Expected CRC-32 of the sink output, 0 if the output is only compared with the
+	 * reference.
+	 */
+	uint32_t golden_crc;
+};
+
+struct bench_result {
+	uint32_t frames;
+	uint32_t bytes;
+	uint32_t crc;
+	uint64_t total_ns;
+	uint64_t frame_max_ns;
+};
+
+static const struct chain chains[] = {
+	{
+		.name = "passthrough",
+		.stages_num = 0,
+		.golden_crc = CORPUS_CRC,
+	},
+	{
+		.name = "mix",
+		.stages = {{.process = stage_mix_mono_to_stereo}},
+		.stages_num = 1,
+		.golden_crc = CORPUS_STEREO_CRC,
+	},
+	{
+		.name = "resample",
+		.stages = {{.process = stage_resample, .state = &resample_down},
+			   {.process = stage_resample, .state = &resample_up}},
+		.stages_num = 2,
+	},
+	{
+		.name = "resample+mix",
+		.stages = {{.process = stage_resample, .state = &resample_down},
+			   {.process = stage_resample, .state = &resample_up},
+			   {.process = stage_mix_mono_to_stereo}},
+		.stages_num = 3,
+	},
+#if defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE)
+	{
+		.name = "lc3+mix",
+		.stages = {{.process = stage_lc3_round_trip, .state = &lc3_state},
+			   {.process = stage_mix_mono_to_stereo}},
+		.stages_num = 2,
+	},
+#endif /* defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE) */
+};
+
+/* A 500 Hz triangle with noise from a linear congruential generator, to be reproducible off
+ * target.
+ */
+static void corpus_generate(void)
+{
+	uint32_t seed = 0x12345678;
+	int32_t noise;
+	int32_t triangle;
+	uint32_t t;
+
+	for (uint32_t n = 0; n < CORPUS_SAMPLES; n++) {
+		seed = seed * 1664525 + 1013904223;
+		noise = (int32_t)((seed >> 19) & 0x1FFF) - 4096;
+
+		t = n % 96;
+		triangle = (int32_t)((t < 48) ? t : (96 - t)) * 512 - 12288;
+
+		corpus[n] = (int16_t)(triangle + noise);
+	}
+}
+
+static void corpus_write(void)
+{
+	int ret;
+	struct fs_file_t file;
+	uint8_t hdr[WAV_HEADER_SIZE + 12];
+	uint32_t data_size = sizeof(corpus);
+
+	/* A WAV header with a LIST chunk between the fmt and data chunks, which the file
+	 * source must skip.
+	 */
+	memcpy(&hdr[0], "RIFF", 4);
+	sys_put_le32(sizeof(hdr) - 8 + data_size, &hdr[4]);
+	memcpy(&hdr[8], "WAVE", 4);
+	memcpy(&hdr[12], "fmt ", 4);
+	sys_put_le32(16, &hdr[16]);
+	sys_put_le16(1, &hdr[20]);
+	sys_put_le16(1, &hdr[22]);
+	sys_put_le32(SAMPLE_RATE_HZ, &hdr[24]);
+	sys_put_le32(SAMPLE_RATE_HZ * sizeof(int16_t), &hdr[28]);
+	sys_put_le16(sizeof(int16_t), &hdr[32]);
+	sys_put_le16(16, &hdr[34]);
+	memcpy(&hdr[36], "LIST", 4);
+	sys_put_le32(4, &hdr[40]);
+	memcpy(&hdr[44], "INFO", 4);
+	memcpy(&hdr[48], "data", 4);
+	sys_put_le32(data_size, &hdr[52]);
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, CORPUS_PATH, FS_O_CREATE | FS_O_WRITE);
+	zassert_equal(ret, 0, "Failed to create the corpus, ret %d", ret);
+
+	ret = fs_write(&file, hdr, sizeof(hdr));
+	zassert_equal(ret, sizeof(hdr), "Failed to write the corpus header, ret %d", ret);
+
+	ret = fs_write(&file, corpus, data_size);
+	zassert_equal(ret, data_size, "Failed to write the corpus, ret %d", ret);
+
+	ret = fs_close(&file);
+	zassert_equal(ret, 0, "Failed to close the corpus, ret %d", ret);
+}
+
+static void chain_reset(void)
+{
+	int ret;
+
+	ret = stage_resample_reset(&resample_down, SAMPLE_RATE_LOW_HZ);
+	zassert_equal(ret, 0, "Failed to reset the resampler, ret %d", ret);
+
+	ret = stage_resample_reset(&resample_up, SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "Failed to reset the resampler, ret %d", ret);
+
+#if defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE)
+	ret = stage_lc3_reset(SAMPLE_RATE_HZ, FRAME_DURATION_US);
+	zassert_equal(ret, 0, "Failed to reset the LC3 codec, ret %d", ret);
+#endif /* defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE) */
+}
+
+static void module_open(struct audio_module_handle *handle,
+			struct audio_module_description *description,
+			struct audio_module_configuration const *const configuration,
+			struct audio_module_context *context, uint8_t index,
+			struct data_fifo *msg_rx, size_t data_size)
+{
+	int ret;
+	char name[CONFIG_AUDIO_MODULE_NAME_SIZE];
+	struct audio_module_parameters mod_parameters = {
+		.description = description,
+		.thread.stack = mod_stack[index],
+		.thread.stack_size = MOD_THREAD_STACK_SIZE,
+		.thread.priority = MOD_THREAD_PRIORITY,
+		.thread.msg_rx = msg_rx,
+		.thread.data_slab = data_size ? &mod_data_slab : NULL,
+		.thread.data_size = data_size,
+	};
+
+	snprintf(name, sizeof(name), "Pipeline %d", index);
+
+	memset(handle, 0, sizeof(*handle));
+
+	ret = audio_module_open(&mod_parameters, configuration, name, context, handle);
+	zassert_equal(ret, 0, "Failed to open module %d, ret %d", index, ret);
+}
+
+static void pipeline_run(const struct chain *chain, struct bench_result *result)
+{
+	int ret;
+	uint64_t start;
+	uint64_t frame_ns;
+	struct audio_module_handle *prev = &source_handle;
+	struct audio_module_file_configuration source_config = {
+		.path = CORPUS_PATH,
+		.frame_duration_us = FRAME_DURATION_US,
+		.wav = true,
+		.frame_sem = &source_sem,
+	};
+	struct audio_module_file_configuration sink_config = {
+		.path = SINK_PATH,
+		.wav = true,
+		.frame_sem = &sink_sem,
+	};
+
+	memset(result, 0, sizeof(*result));
+	chain_reset();
+	k_sem_reset(&source_sem);
+	k_sem_reset(&sink_sem);
+
+	module_open(&source_handle, audio_module_file_source_description,
+		    (struct audio_module_configuration const *const)&source_config,
+		    (struct audio_module_context *)&source_ctx, 0, NULL, MONO_FRAME_BYTES);
+
+	for (int i = 0; i < chain->stages_num; i++) {
+		module_open(&stage_handles[i], stage_description,
+			    (struct audio_module_configuration const *const)&chain->stages[i],
+			    (struct audio_module_context *)&stage_contexts[i], i + 1,
+			    msg_fifo_rx_array[i], STEREO_FRAME_BYTES);
+
+		ret = audio_module_connect(prev, &stage_handles[i], false);
+		zassert_equal(ret, 0, "Failed to connect stage %d, ret %d", i, ret);
+
+		prev = &stage_handles[i];
+	}
+
+	module_open(&sink_handle, audio_module_file_sink_description,
+		    (struct audio_module_configuration const *const)&sink_config,
+		    (struct audio_module_context *)&sink_ctx, chain->stages_num + 1,
+		    msg_fifo_rx_array[chain->stages_num], 0);
+
+	ret = audio_module_connect(prev, &sink_handle, false);
+	zassert_equal(ret, 0, "Failed to connect the sink, ret %d", ret);
+
+	ret = audio_module_start(&source_handle);
+	zassert_equal(ret, 0, "Failed to start the source, ret %d", ret);
+
+	for (int i = 0; i < chain->stages_num; i++) {
+		ret = audio_module_start(&stage_handles[i]);
+		zassert_equal(ret, 0, "Failed to start stage %d, ret %d", i, ret);
+	}
+
+	ret = audio_module_start(&sink_handle);
+	zassert_equal(ret, 0, "Failed to start the sink, ret %d", ret);
+
+	/* Run one frame at a time through the pipeline to measure the time of each frame. */
+	for (int i = 0; i < CORPUS_FRAMES; i++) {
+		start = CLOCK_NS();
+
+		k_sem_give(&source_sem);
+
+		ret = k_sem_take(&sink_sem, FRAME_RX_TIMEOUT);
+		zassert_equal(ret, 0, "Frame %d did not reach the sink, ret %d", i, ret);
+
+		frame_ns = CLOCK_NS() - start;
+		result->total_ns += frame_ns;
+		result->frame_max_ns = MAX(result->frame_max_ns, frame_ns);
+	}
+
+	ret = audio_module_stop(&source_handle);
+	zassert_equal(ret, 0, "Failed to stop the source, ret %d", ret);
+
+	for (int i = 0; i < chain->stages_num; i++) {
+		ret = audio_module_stop(&stage_handles[i]);
+		zassert_equal(ret, 0, "Failed to stop stage %d, ret %d", i, ret);
+	}
+
+	ret = audio_module_stop(&sink_handle);
+	zassert_equal(ret, 0, "Failed to stop the sink, ret %d", ret);
+
+	/* Let the modules release the last frame before they are closed. */
+	k_msleep(10);
+
+	zassert_equal(source_ctx.crc, CORPUS_CRC, "Source read CRC 0x%08x, expected 0x%08x",
+		      source_ctx.crc, CORPUS_CRC);
+
+	result->frames = sink_ctx.frames;
+	result->bytes = sink_ctx.bytes;
+	result->crc = sink_ctx.crc;
+
+	ret = audio_module_close(&source_handle);
+	zassert_equal(ret, 0, "Failed to close the source, ret %d", ret);
+
+	for (int i = 0; i < chain->stages_num; i++) {
+		ret = audio_module_close(&stage_handles[i]);
+		zassert_equal(ret, 0, "Failed to close stage %d, ret %d", i, ret);
+	}
+
+	ret = audio_module_close(&sink_handle);
+	zassert_equal(ret, 0, "Failed to close the sink, ret %d", ret);
+}
+
+/* Run the stage functions directly on the corpus to get the reference output. */
+static uint32_t reference_crc_get(const struct chain *chain)
+{
+	int ret;
+	uint32_t crc = 0;
+	struct audio_data in;
+	struct audio_data out;
+	struct audio_metadata meta = {
+		.data_coding = PCM,
+		.data_len_us = FRAME_DURATION_US,
+		.sample_rate_hz = SAMPLE_RATE_HZ,
+		.bits_per_sample = 16,
+		.carried_bits_per_sample = 16,
+		.bytes_per_location = MONO_FRAME_BYTES,
+		.interleaved = true,
+		.locations = BIT(0),
+	};
+
+	chain_reset();
+
+	for (int i = 0; i < CORPUS_FRAMES; i++) {
+		in = (struct audio_data){
+			.data = &corpus[i * FRAME_SAMPLES],
+			.data_size = MONO_FRAME_BYTES,
+			.meta = meta,
+		};
+
+		for (int j = 0; j < chain->stages_num; j++) {
+			out.data = ref_buf[j % 2];
+			out.data_size = sizeof(ref_buf[0]);
+
+			ret = chain->stages[j].process(chain->stages[j].state, &in, &out);
+			zassert_equal(ret, 0, "Reference stage %d failed on frame %d, ret %d", j, i,
+				      ret);
+
+			in = out;
+		}
+
+		crc = crc32_ieee_update(crc, in.data, in.data_size);
+	}
+
+	return crc;
+}
+
+static void sink_wav_check(uint32_t data_size, uint16_t channels)
+{
+	int ret;
+	struct fs_file_t file;
+	uint8_t hdr[WAV_HEADER_SIZE];
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, SINK_PATH, FS_O_READ);
+	zassert_equal(ret, 0, "Failed to open the sink output, ret %d", ret);
+
+	ret = fs_read(&file, hdr, sizeof(hdr));
+	zassert_equal(ret, sizeof(hdr), "Failed to read the sink header, ret %d", ret);
+
+	fs_close(&file);
+
+	zassert_mem_equal(&hdr[0], "RIFF", 4, "Sink output is not a RIFF file");
+	zassert_mem_equal(&hdr[8], "WAVE", 4, "Sink output is not a WAV file");
+	zassert_equal(sys_get_le16(&hdr[22]), channels, "Sink output has %d channels",
+		      sys_get_le16(&hdr[22]));
+	zassert_equal(sys_get_le32(&hdr[24]), SAMPLE_RATE_HZ, "Sink output is %d Hz",
+		      sys_get_le32(&hdr[24]));
+	zassert_equal(sys_get_le32(&hdr[40]), data_size, "Sink output has %d bytes of data",
+		      sys_get_le32(&hdr[40]));
+}
+
+static void result_print(const char *name, struct bench_result const *const result)
+{
+	uint64_t audio_ns = (uint64_t)result->frames * FRAME_DURATION_US * NSEC_PER_USEC;
+
+	TC_PRINT("%s: %u frames, %llu frames/s, %llu x real time, frame time avg %llu us, "
+		 "worst %llu us, CRC 0x%08x\n",
+		 name, result->frames,
+		 (unsigned long long)(result->frames * NSEC_PER_SEC / MAX(result->total_ns, 1)),
+		 (unsigned long long)(audio_ns / MAX(result->total_ns, 1)),
+		 (unsigned long long)(result->total_ns / MAX(result->frames, 1) / NSEC_PER_USEC),
+		 (unsigned long long)(result->frame_max_ns / NSEC_PER_USEC), result->crc);
+}
+
+ZTEST(suite_audio_pipeline, test_chains)
+{
+	uint32_t ref_crc;
+	struct bench_result result;
+
+	for (size_t i = 0; i < ARRAY_SIZE(chains); i++) {
+		pipeline_run(&chains[i], &result);
+		result_print(chains[i].name, &result);
+
+		zassert_equal(result.frames, CORPUS_FRAMES, "%s: %d frames reached the sink",
+			      chains[i].name, result.frames);
+
+		ref_crc = reference_crc_get(&chains[i]);
+		zassert_equal(result.crc, ref_crc,
+			      "%s: output CRC 0x%08x does not match the reference 0x%08x",
+			      chains[i].name, result.crc, ref_crc);
+
+		if (chains[i].golden_crc != 0) {
+			zassert_equal(result.crc, chains[i].golden_crc,
+				      "%s: output CRC 0x%08x, expected 0x%08x", chains[i].name,
+				      result.crc, chains[i].golden_crc);
+		}
+	}
+}
+
+ZTEST(suite_audio_pipeline, test_sink_wav)
+{
+	struct bench_result result;
+
+	pipeline_run(&chains[0], &result);
+	sink_wav_check(sizeof(corpus), 1);
+
+	pipeline_run(&chains[1], &result);
+	sink_wav_check(2 * sizeof(corpus), 2);
+}
+
+static void *suite_setup(void)
+{
+	int ret;
+
+	ret = fs_mkfs(FS_FATFS, (uintptr_t)DISK_NAME ":", NULL, 0);
+	zassert_equal(ret, 0, "Failed to format the RAM disk, ret %d", ret);
+
+	ret = fs_mount(&mnt_pt);
+	zassert_equal(ret, 0, "Failed to mount the RAM disk, ret %d", ret);
+
+	corpus_generate();
+	corpus_write();
+
+	return NULL;
+}
+
+ZTEST_SUITE(suite_audio_pipeline, NULL, suite_setup, NULL, NULL, NULL);
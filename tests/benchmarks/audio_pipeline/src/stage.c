@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "stage.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <pcm_mix.h>
+#if defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE)
+#include <sw_codec_lc3.h>
+#endif /* defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE) */
+
+#if defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE)
+#define STAGE_LC3_BITRATE (96000)
+#define STAGE_LC3_CH	  (0)
+
+static bool lc3_initialized;
+#endif /* defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE) */
+
+static uint8_t channels_get(struct audio_data const *const audio_data)
+{
+	if (audio_data->meta.bytes_per_location == 0) {
+		return 1;
+	}
+
+	return audio_data->data_size / audio_data->meta.bytes_per_location;
+}
+
+int stage_mix_mono_to_stereo(void *state, struct audio_data const *const in,
+			     struct audio_data *out)
+{
+	int ret;
+	size_t size = in->data_size * 2;
+
+	ARG_UNUSED(state);
+
+	if (channels_get(in) != 1 || out->data_size < size) {
+		return -EINVAL;
+	}
+
+	/* Mixing into silence gives the mono input on both channels. */
+	memset(out->data, 0, size);
+
+	ret = pcm_mix(out->data, size, in->data, in->data_size, B_MONO_INTO_A_STEREO_LR);
+	if (ret) {
+		return ret;
+	}
+
+	out->meta = in->meta;
+	out->meta.bytes_per_location = in->data_size;
+	out->meta.locations = BIT_MASK(2);
+	out->data_size = size;
+
+	return 0;
+}
+
+int stage_resample_reset(struct stage_resample_state *state, uint32_t sample_rate_hz)
+{
+	state->sample_rate_hz = sample_rate_hz;
+
+	return sample_rate_converter_open(&state->ctx);
+}
+
+int stage_resample(void *state, struct audio_data const *const in, struct audio_data *out)
+{
+	int ret;
+	size_t written;
+	struct stage_resample_state *resample = state;
+
+	if (channels_get(in) != 1) {
+		return -EINVAL;
+	}
+
+	ret = sample_rate_converter_process(&resample->ctx, SAMPLE_RATE_FILTER_SIMPLE, in->data,
+					    in->data_size, in->meta.sample_rate_hz, out->data,
+					    out->data_size, &written, resample->sample_rate_hz);
+	if (ret) {
+		return ret;
+	}
+
+	out->meta = in->meta;
+	out->meta.sample_rate_hz = resample->sample_rate_hz;
+	out->meta.bytes_per_location = written;
+	out->data_size = written;
+
+	return 0;
+}
+
+#if defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE)
+int stage_lc3_reset(uint32_t sample_rate_hz, uint32_t frame_duration_us)
+{
+	int ret;
+	uint16_t pcm_bytes_req;
+
+	if (lc3_initialized) {
+		sw_codec_lc3_enc_uninit_all();
+		sw_codec_lc3_dec_uninit_all();
+		sw_codec_lc3_uninit();
+		lc3_initialized = false;
+	}
+
+	ret = sw_codec_lc3_single_rate_init(sample_rate_hz, sample_rate_hz, NULL, NULL,
+					    frame_duration_us);
+	if (ret) {
+		return ret;
+	}
+
+	ret = sw_codec_lc3_enc_init(sample_rate_hz, 16, frame_duration_us, STAGE_LC3_BITRATE, 1,
+				    &pcm_bytes_req);
+	if (ret) {
+		return ret;
+	}
+
+	ret = sw_codec_lc3_dec_init(sample_rate_hz, 16, frame_duration_us, 1);
+	if (ret) {
+		return ret;
+	}
+
+	lc3_initialized = true;
+
+	return 0;
+}
+
+int stage_lc3_round_trip(void *state, struct audio_data const *const in, struct audio_data *out)
+{
+	int ret;
+	uint16_t coded_size;
+	uint16_t written;
+	struct stage_lc3_state *lc3 = state;
+
+	if (channels_get(in) != 1) {
+		return -EINVAL;
+	}
+
+	ret = sw_codec_lc3_enc_run(in->data, in->data_size, LC3_USE_BITRATE_FROM_INIT,
+				   STAGE_LC3_CH, sizeof(lc3->coded), lc3->coded, &coded_size);
+	if (ret) {
+		return ret;
+	}
+
+	ret = sw_codec_lc3_dec_run(lc3->coded, coded_size, out->data_size, STAGE_LC3_CH,
+				   out->data, &written, false);
+	if (ret) {
+		return ret;
+	}
+
+	out->meta = in->meta;
+	out->meta.bytes_per_location = written;
+	out->data_size = written;
+
+	return 0;
+}
+#endif /* defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE) */
+
+static int stage_open(struct audio_module_handle_private *handle,
+		      struct audio_module_configuration const *const configuration)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct stage_context *ctx = (struct stage_context *)hdl->context;
+
+	ARG_UNUSED(configuration);
+
+	memset(ctx, 0, sizeof(struct stage_context));
+
+	return 0;
+}
+
+static int stage_configuration_set(struct audio_module_handle_private *handle,
+				   struct audio_module_configuration const *const configuration)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct stage_context *ctx = (struct stage_context *)hdl->context;
+	struct stage_configuration *config = (struct stage_configuration *)configuration;
+
+	if (config->process == NULL) {
+		return -EINVAL;
+	}
+
+	memcpy(&ctx->config, config, sizeof(struct stage_configuration));
+
+	return 0;
+}
+
+static int stage_configuration_get(struct audio_module_handle_private const *const handle,
+				   struct audio_module_configuration *configuration)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct stage_context *ctx = (struct stage_context *)hdl->context;
+
+	memcpy(configuration, &ctx->config, sizeof(struct stage_configuration));
+
+	return 0;
+}
+
+static int stage_data_process(struct audio_module_handle_private *handle,
+			      struct audio_data const *const audio_data_in,
+			      struct audio_data *audio_data_out)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct stage_context *ctx = (struct stage_context *)hdl->context;
+
+	return ctx->config.process(ctx->config.state, audio_data_in, audio_data_out);
+}
+
+static const struct audio_module_functions stage_functions = {
+	.open = stage_open,
+	.close = NULL,
+	.configuration_set = stage_configuration_set,
+	.configuration_get = stage_configuration_get,
+	.start = NULL,
+	.stop = NULL,
+	.data_process = stage_data_process,
+};
+
+static struct audio_module_description stage_dept = {
+	.name = "Stage",
+	.type = AUDIO_MODULE_TYPE_IN_OUT,
+	.functions = &stage_functions,
+};
+
+struct audio_module_description *stage_description = &stage_dept;
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _STAGE_H_
+#define _STAGE_H_
+
+#include <stdint.h>
+#include <sample_rate_converter.h>
+
+#include "audio_defines.h"
+#include "audio_module.h"
+
+/**
+ * @brief Process one frame of audio data in a pipeline stage.
+ *
+ * The same function is run inside the stage module and directly by the test to compute
+ * the reference output.
+ *
+ * @param state  [in/out]  The state of the stage, can be NULL.
+ * @param in     [in]      The input audio data.
+ * @param out    [in/out]  The output audio data, data_size is the size of the buffer on input.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+typedef int (*stage_process_t)(void *state, struct audio_data const *const in,
+			       struct audio_data *out);
+
+/**
+ * @brief Description of the stage modules.
+ */
+extern struct audio_module_description *stage_description;
+
+/**
+ * @brief The stage module configuration structure.
+ */
+struct stage_configuration {
+	/* The function to process the audio data with. */
+	stage_process_t process;
+
+	/* The state passed to the process function. */
+	void *state;
+};
+
+/**
+ * @brief The stage module context.
+ */
+struct stage_context {
+	struct stage_configuration config;
+};
+
+/**
+ * @brief State of a resampling stage.
+ */
+struct stage_resample_state {
+	struct sample_rate_converter_ctx ctx;
+
+	/* The sample rate to convert to. */
+	uint32_t sample_rate_hz;
+};
+
+/* Mix a mono frame into both channels of a stereo frame with pcm_mix. */
+int stage_mix_mono_to_stereo(void *state, struct audio_data const *const in,
+			     struct audio_data *out);
+
+/* Convert the sample rate of a frame with the sample rate converter. */
+int stage_resample(void *state, struct audio_data const *const in, struct audio_data *out);
+
+/* Reset a resampling stage before a new stream. */
+int stage_resample_reset(struct stage_resample_state *state, uint32_t sample_rate_hz);
+
+#if defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE)
+/* Largest LC3 frame for one channel. */
+#define STAGE_LC3_CODED_SIZE_MAX (400)
+
+/**
+ * @brief State of an LC3 encode and decode stage.
+ */
+struct stage_lc3_state {
+	uint8_t coded[STAGE_LC3_CODED_SIZE_MAX];
+};
+
+/* Encode a mono frame with LC3 and decode it again. */
+int stage_lc3_round_trip(void *state, struct audio_data const *const in, struct audio_data *out);
+
+/* Reset the LC3 codec before a new stream. */
+int stage_lc3_reset(uint32_t sample_rate_hz, uint32_t frame_duration_us);
+#endif /* defined(CONFIG_SW_CODEC_LC3_T2_SOFTWARE) */
+
+#endif /* _STAGE_H_ */
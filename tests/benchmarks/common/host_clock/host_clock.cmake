@@ -0,0 +1,13 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+# Provides bench_host_clock_ns() from host_clock.h for measuring execution times on native_sim.
+
+target_include_directories(app PRIVATE ${CMAKE_CURRENT_LIST_DIR})
+
+if(CONFIG_ARCH_POSIX)
+  target_sources(native_simulator INTERFACE ${CMAKE_CURRENT_LIST_DIR}/host_clock.c)
+endif()
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BENCH_HOST_CLOCK_H_
+#define BENCH_HOST_CLOCK_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Get the monotonic clock of the host, in nanoseconds.
+ *
+ * Only available on native_sim, where the simulated time does not advance while code runs, so
+ * it cannot measure execution times.
+ */
+uint64_t bench_host_clock_ns(void);
+
+#endif /* BENCH_HOST_CLOCK_H_ */
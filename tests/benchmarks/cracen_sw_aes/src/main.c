@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Throughput of the software-assisted AES modes of the CRACEN driver, and the number of AES-ECB
+ * jobs they submit to the engine per message. On native_sim the AES-ECB engine is emulated in
+ * software, so the job count is the figure that carries over to CRACEN.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <psa/crypto.h>
+#include <cracen_psa_primitives.h>
+#include <cracen_sw_common.h>
+#include <cracen_sw_aes_ctr.h>
+#include <cracen_sw_aes_ccm.h>
+#include <cracen_sw_aes_gcm.h>
+
+#include "cracen_stub.h"
+#include "host_clock.h"
+
+#define BENCH_MSG_SIZE_MAX (4096)
+#define BENCH_BYTES_NUM	   (256 * 1024)
+#define BENCH_AD_SIZE	   (13)
+#define BENCH_TAG_SIZE	   (16)
+
+#if defined(CONFIG_ARCH_POSIX)
+/* Simulated time does not advance while code runs, so measure on the host clock. */
+#define CLOCK_NS() bench_host_clock_ns()
+#else
+#define CLOCK_NS() k_ticks_to_ns_floor64(k_uptime_ticks())
+#endif /* defined(CONFIG_ARCH_POSIX) */
+
+typedef psa_status_t (*bench_fn)(size_t msg_size);
+
+static const size_t msg_sizes[] = {16, 64, 256, 1024, BENCH_MSG_SIZE_MAX};
+
+static const uint8_t key[16] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+				0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+static const uint8_t nonce[16] = {0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+				  0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff};
+static const uint8_t ad[BENCH_AD_SIZE];
+static uint8_t msg_in[BENCH_MSG_SIZE_MAX];
+static uint8_t msg_out[BENCH_MSG_SIZE_MAX + BENCH_TAG_SIZE];
+static psa_key_attributes_t attributes;
+
+static psa_status_t ctr_run(size_t msg_size)
+{
+	size_t out_len;
+
+	return cracen_sw_aes_ctr_crypt(&attributes, key, sizeof(key), nonce, sizeof(nonce), msg_in,
+				       msg_size, msg_out, sizeof(msg_out), &out_len);
+}
+
+static psa_status_t gcm_run(size_t msg_size)
+{
+	cracen_aead_operation_t operation = {0};
+	uint8_t tag[BENCH_TAG_SIZE];
+	psa_status_t status;
+	size_t out_len;
+	size_t tag_len;
+
+	status = cracen_sw_aes_gcm_encrypt_setup(&operation, &attributes, key, sizeof(key),
+						 PSA_ALG_GCM);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = cracen_sw_aes_gcm_set_nonce(&operation, nonce, 12);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = cracen_sw_aes_gcm_update_ad(&operation, ad, sizeof(ad));
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = cracen_sw_aes_gcm_update(&operation, msg_in, msg_size, msg_out, sizeof(msg_out),
+					  &out_len);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	return cracen_sw_aes_gcm_finish(&operation, NULL, 0, &out_len, tag, sizeof(tag),
+					&tag_len);
+}
+
+static psa_status_t ccm_run(size_t msg_size)
+{
+	size_t out_len;
+
+	return cracen_sw_aes_ccm_encrypt(&attributes, key, sizeof(key), PSA_ALG_CCM, nonce, 13, ad,
+					 sizeof(ad), msg_in, msg_size, msg_out, sizeof(msg_out),
+					 &out_len);
+}
+
+static void bench_run(const char *mode, bench_fn fn)
+{
+	uint32_t jobs_per_msg;
+	uint32_t iterations;
+	uint64_t start;
+	uint64_t elapsed_ns;
+	uint64_t kib_per_s;
+
+	for (size_t i = 0; i < ARRAY_SIZE(msg_sizes); i++) {
+		iterations = BENCH_BYTES_NUM / msg_sizes[i];
+
+		cracen_stub_counters_reset();
+		zassert_equal(fn(msg_sizes[i]), PSA_SUCCESS, "%s failed", mode);
+		jobs_per_msg = cracen_stub_job_count_get();
+
+		start = CLOCK_NS();
+
+		for (uint32_t j = 0; j < iterations; j++) {
+			zassert_equal(fn(msg_sizes[i]), PSA_SUCCESS, "%s failed", mode);
+		}
+
+		elapsed_ns = MAX(CLOCK_NS() - start, 1);
+		kib_per_s = ((uint64_t)BENCH_BYTES_NUM * NSEC_PER_SEC) / (elapsed_ns * 1024);
+
+		TC_PRINT("%s %4zu B: %llu KiB/s, %u AES-ECB jobs per message\n", mode, msg_sizes[i],
+			 (unsigned long long)kib_per_s, jobs_per_msg);
+	}
+}
+
+ZTEST(suite_cracen_sw_aes, test_ctr)
+{
+	bench_run("CTR", ctr_run);
+}
+
+ZTEST(suite_cracen_sw_aes, test_gcm)
+{
+	bench_run("GCM", gcm_run);
+}
+
+ZTEST(suite_cracen_sw_aes, test_ccm)
+{
+	bench_run("CCM", ccm_run);
+}
+
+static void *cracen_sw_aes_setup(void)
+{
+	TC_PRINT("%d counter blocks per AES-ECB job\n", CRACEN_SW_CTR_BATCH_MAX_BLOCKS);
+
+	attributes = psa_key_attributes_init();
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attributes, PSA_BYTES_TO_BITS(sizeof(key)));
+
+	for (size_t i = 0; i < sizeof(msg_in); i++) {
+		msg_in[i] = (uint8_t)i;
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(suite_cracen_sw_aes, NULL, cracen_sw_aes_setup, NULL, NULL, NULL);
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+#include <pcm_stream_channel_modifier.h>
+#include <sample_rate_converter.h>
+
+#include "host_clock.h"
+
+#define OUTPUT_SAMPLE_RATE_HZ (48000)
+#define FRAME_DURATION_US     (10000)
+#define FRAME_SAMPLES_MAX     (OUTPUT_SAMPLE_RATE_HZ / 1000 * FRAME_DURATION_US / 1000)
+#define CHANNELS_MAX	      (4)
+#define FRAMES_NUM	      (1000)
+
+#if defined(CONFIG_ARCH_POSIX)
+/* Simulated time does not advance while code runs, so measure on the host clock. */
+#define CLOCK_NS() bench_host_clock_ns()
+#else
+#define CLOCK_NS() k_cyc_to_ns_floor64(k_cycle_get_32())
+#endif /* defined(CONFIG_ARCH_POSIX) */
+
+static struct sample_rate_converter_ctx separate_ctx[CHANNELS_MAX];
+static struct sample_rate_converter_ctx interleaved_ctx[CHANNELS_MAX];
+
+static int16_t input[CHANNELS_MAX][FRAME_SAMPLES_MAX];
+static int16_t mono_buf[FRAME_SAMPLES_MAX] __aligned(4);
+static int16_t separate_output[CHANNELS_MAX * FRAME_SAMPLES_MAX] __aligned(4);
+static int16_t interleaved_output[CHANNELS_MAX * FRAME_SAMPLES_MAX] __aligned(4);
+
+static void input_generate(int frame, uint8_t channels, size_t samples)
+{
+	for (uint8_t chan = 0; chan < channels; chan++) {
+		for (size_t i = 0; i < samples; i++) {
+			input[chan][i] = (int16_t)(((frame * samples + i) * (chan + 1) * 97) % 16384) -
+					 8192;
+		}
+	}
+}
+
+static void benchmark_run(uint32_t input_sample_rate, uint8_t channels)
+{
+	int ret;
+	size_t written;
+	uint64_t start;
+	uint64_t separate_ns = 0;
+	uint64_t interleaved_ns = 0;
+	size_t input_samples = input_sample_rate / 1000 * FRAME_DURATION_US / 1000;
+	size_t output_size = channels * FRAME_SAMPLES_MAX * sizeof(int16_t);
+
+	for (uint8_t chan = 0; chan < channels; chan++) {
+		sample_rate_converter_open(&separate_ctx[chan]);
+		sample_rate_converter_open(&interleaved_ctx[chan]);
+	}
+
+	for (int frame = 0; frame < FRAMES_NUM; frame++) {
+		input_generate(frame, channels, input_samples);
+
+		/* Resample each channel into a mono buffer, then interleave it. */
+		start = CLOCK_NS();
+
+		for (uint8_t chan = 0; chan < channels; chan++) {
+			ret = sample_rate_converter_process(
+				&separate_ctx[chan], SAMPLE_RATE_FILTER_SIMPLE, input[chan],
+				input_samples * sizeof(int16_t), input_sample_rate, mono_buf,
+				sizeof(mono_buf), &written, OUTPUT_SAMPLE_RATE_HZ);
+			zassert_equal(ret, 0, "Sample rate conversion failed, ret %d", ret);
+
+			ret = pscm_interleave(mono_buf, written, chan, 16, separate_output,
+					      output_size, channels);
+			zassert_equal(ret, 0, "Interleave failed, ret %d", ret);
+		}
+
+		separate_ns += CLOCK_NS() - start;
+
+		/* Resample each channel straight into the interleaved output. */
+		start = CLOCK_NS();
+
+		for (uint8_t chan = 0; chan < channels; chan++) {
+			ret = sample_rate_converter_process_interleaved(
+				&interleaved_ctx[chan], SAMPLE_RATE_FILTER_SIMPLE, input[chan],
+				input_samples * sizeof(int16_t), input_sample_rate,
+				interleaved_output, output_size, &written, OUTPUT_SAMPLE_RATE_HZ,
+				chan, channels);
+			zassert_equal(ret, 0, "Interleaved sample rate conversion failed, ret %d",
+				      ret);
+		}
+
+		interleaved_ns += CLOCK_NS() - start;
+
+		zassert_mem_equal(separate_output, interleaved_output, output_size,
+				  "Frame %d differs between the two paths", frame);
+	}
+
+	TC_PRINT("%d Hz to %d Hz, %d channel(s): separate %llu ns per frame, interleaved %llu "
+		 "ns per frame\n",
+		 input_sample_rate, OUTPUT_SAMPLE_RATE_HZ, channels,
+		 (unsigned long long)(separate_ns / FRAMES_NUM),
+		 (unsigned long long)(interleaved_ns / FRAMES_NUM));
+}
+
+ZTEST(suite_sample_rate_converter_interleaved, test_16khz_stereo)
+{
+	benchmark_run(16000, 2);
+}
+
+ZTEST(suite_sample_rate_converter_interleaved, test_24khz_stereo)
+{
+	benchmark_run(24000, 2);
+}
+
+ZTEST(suite_sample_rate_converter_interleaved, test_16khz_four_channels)
+{
+	benchmark_run(16000, 4);
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_interleaved, NULL, NULL, NULL, NULL, NULL);
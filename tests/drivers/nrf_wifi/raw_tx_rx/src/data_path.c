@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Throughput of the driver conversions between network packets and driver
+ * buffers, for comparing the copy and the zero copy data paths.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/ztest.h>
+
+#include "host_clock.h"
+#include "osal_api.h"
+#include "shim.h"
+
+#define HDR_LEN		 54 /* Ethernet, IPv4 and TCP headers */
+#define PAYLOAD_LEN	 1460
+#define FRAME_LEN	 (HDR_LEN + PAYLOAD_LEN)
+#define RX_BUF_SIZE	 (FRAME_LEN + 100)
+#define FRAME_COUNT	 200
+
+#if defined(CONFIG_ARCH_POSIX)
+/* Simulated time does not advance while code runs, so measure on the host clock. */
+#define CLOCK_NS() bench_host_clock_ns()
+#else
+#define CLOCK_NS() k_cyc_to_ns_floor64(k_cycle_get_64())
+#endif /* defined(CONFIG_ARCH_POSIX) */
+
+extern const struct nrf_wifi_osal_ops nrf_wifi_os_zep_ops;
+
+/* Header and payload in separate buffers, as built by the TCP stack. */
+NET_BUF_POOL_DEFINE(test_frag_pool, 4, FRAME_LEN, 0, NULL);
+
+static uint8_t frame[FRAME_LEN];
+static uint8_t out[FRAME_LEN];
+
+static void print_throughput(const char *name, uint64_t ns)
+{
+	uint64_t us = DIV_ROUND_UP(ns, NSEC_PER_USEC);
+	uint64_t bits = (uint64_t)FRAME_COUNT * FRAME_LEN * 8;
+
+	TC_PRINT("%s: %u frames of %u bytes in %llu us, %llu Mbit/s\n", name, FRAME_COUNT,
+		 FRAME_LEN, us, us ? (bits / us) : 0);
+}
+
+/* There is no Wi-Fi interface on native_sim, the packets only need an interface to be
+ * allocated on.
+ */
+static struct net_if *test_iface_get(void)
+{
+#if defined(CONFIG_ARCH_POSIX)
+	return net_if_get_default();
+#else
+	return net_if_get_first_wifi();
+#endif /* defined(CONFIG_ARCH_POSIX) */
+}
+
+static struct net_pkt *tx_pkt_create(struct net_if *iface)
+{
+	struct net_buf *hdr;
+	struct net_buf *payload;
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_on_iface(iface, K_NO_WAIT);
+	zassert_not_null(pkt, "Failed to allocate packet");
+
+	hdr = net_buf_alloc(&test_frag_pool, K_NO_WAIT);
+	payload = net_buf_alloc(&test_frag_pool, K_NO_WAIT);
+	zassert_not_null(hdr, "Failed to allocate buffer");
+	zassert_not_null(payload, "Failed to allocate buffer");
+
+	net_buf_add_mem(hdr, frame, HDR_LEN);
+	net_buf_add_mem(payload, &frame[HDR_LEN], PAYLOAD_LEN);
+	net_buf_frag_add(hdr, payload);
+	net_pkt_append_buffer(pkt, hdr);
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+
+ZTEST(nrf_wifi_data_path, test_tx_throughput)
+{
+	struct net_if *iface = test_iface_get();
+	uint64_t ns = 0;
+	struct net_pkt *pkt;
+	void *nbuf;
+	uint64_t start;
+
+	zassert_not_null(iface, "No network interface");
+
+	for (int i = 0; i < FRAME_COUNT; i++) {
+		pkt = tx_pkt_create(iface);
+
+		start = CLOCK_NS();
+		nbuf = net_pkt_to_nbuf(pkt);
+		ns += CLOCK_NS() - start;
+
+		zassert_not_null(nbuf, "Failed to convert packet");
+		zassert_equal(nrf_wifi_osal_nbuf_data_size(nbuf), FRAME_LEN, "Invalid length");
+		zassert_mem_equal(nrf_wifi_osal_nbuf_data_get(nbuf), frame, FRAME_LEN,
+				  "Invalid data");
+
+		nrf_wifi_osal_nbuf_free(nbuf);
+		net_pkt_unref(pkt);
+	}
+
+	print_throughput(IS_ENABLED(CONFIG_NRF_WIFI_ZERO_COPY_TX) ? "TX zero copy" : "TX copy",
+			 ns);
+}
+
+ZTEST(nrf_wifi_data_path, test_rx_throughput)
+{
+	struct net_if *iface = test_iface_get();
+	uint64_t ns = 0;
+	struct net_pkt *pkt;
+	void *nbuf;
+	uint64_t start;
+
+	zassert_not_null(iface, "No network interface");
+
+	for (int i = 0; i < FRAME_COUNT; i++) {
+		nbuf = nrf_wifi_osal_nbuf_alloc(RX_BUF_SIZE);
+		zassert_not_null(nbuf, "Failed to allocate driver buffer");
+		memcpy(nrf_wifi_osal_nbuf_data_put(nbuf, FRAME_LEN), frame, FRAME_LEN);
+
+		/* The stack releases the packet after processing, include it. */
+		start = CLOCK_NS();
+		pkt = net_pkt_from_nbuf(iface, nbuf);
+		zassert_not_null(pkt, "Failed to convert driver buffer");
+		zassert_ok(net_pkt_read(pkt, out, FRAME_LEN), "Failed to read packet");
+		net_pkt_unref(pkt);
+		ns += CLOCK_NS() - start;
+
+		zassert_mem_equal(out, frame, FRAME_LEN, "Invalid data");
+	}
+
+	print_throughput(IS_ENABLED(CONFIG_NRF_WIFI_ZERO_COPY_RX) ? "RX zero copy" : "RX copy",
+			 ns);
+}
+
+static void *data_path_setup(void)
+{
+#if defined(CONFIG_ARCH_POSIX)
+	/* The driver is not initialized on native_sim, only its OS layer is built. */
+	nrf_wifi_osal_init(&nrf_wifi_os_zep_ops);
+#endif /* defined(CONFIG_ARCH_POSIX) */
+
+	for (size_t i = 0; i < sizeof(frame); i++) {
+		frame[i] = i;
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(nrf_wifi_data_path, NULL, data_path_setup, NULL, NULL, NULL);
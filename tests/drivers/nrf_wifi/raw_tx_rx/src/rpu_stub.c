@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* RPU bus used by the OS layer of the driver on native_sim. The data path
+ * test does not exchange messages with the RPU, so nothing is sent or received.
+ */
+
+#include <errno.h>
+#include "ipc_if.h"
+
+static int rpu_stub_init(void)
+{
+	return -ENOTSUP;
+}
+
+static int rpu_stub_deinit(void)
+{
+	return 0;
+}
+
+static int rpu_stub_send(ipc_ctx_t ctx, const void *data, int len)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(data);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+}
+
+static int rpu_stub_recv(ipc_ctx_t ctx, void *data, int len)
+{
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(data);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+}
+
+static int rpu_stub_register_rx_cb(int (*rx_handler)(void *priv), void *data)
+{
+	ARG_UNUSED(rx_handler);
+	ARG_UNUSED(data);
+
+	return -ENOTSUP;
+}
+
+static struct rpu_dev rpu_stub = {
+	.init = rpu_stub_init,
+	.deinit = rpu_stub_deinit,
+	.send = rpu_stub_send,
+	.recv = rpu_stub_recv,
+	.register_rx_cb = rpu_stub_register_rx_cb,
+};
+
+struct rpu_dev *rpu_dev(void)
+{
+	return &rpu_stub;
+}
+
+int ipc_register_rx_cb(int (*rx_handler)(void *priv), void *data)
+{
+	return rpu_stub_register_rx_cb(rx_handler, data);
+}
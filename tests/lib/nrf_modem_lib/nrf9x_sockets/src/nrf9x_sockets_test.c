@@ -12,6 +12,7 @@
 #include <zephyr/net/socket.h>
 #include <nrf_socket.h>
 #include <nrf_gai_errors.h>
+#include <modem/nrf_modem_lib_socket.h>
 
 #include "cmock_nrf_socket.h"
 #include "cmock_nrf_modem_os.h"
@@ -1916,6 +1917,298 @@ void test_nrf9x_socket_offload_dtls_frag_ext(void)
 	TEST_ASSERT_EQUAL(ret, 0);
 }
 
+static int udp_socket_create(void)
+{
+	int fd;
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM, NRF_IPPROTO_UDP, NRF_FD);
+
+	fd = zsock_socket(NET_AF_INET, NET_SOCK_DGRAM, NET_IPPROTO_UDP);
+
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	return fd;
+}
+
+static void socket_close(int fd)
+{
+	int ret;
+
+	__cmock_nrf_close_ExpectAndReturn(NRF_FD, 0);
+
+	ret = zsock_close(fd);
+
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
+void test_nrf9x_socket_offload_sendmsg_dgram_not_fits_buf(void)
+{
+	int ret;
+	int fd;
+	int flags = ZSOCK_MSG_DONTWAIT;
+	struct net_msghdr msg = { 0 };
+	struct net_iovec chunks[3] = { 0 };
+	int chunk_1 = 42;
+	int chunk_2 = 43;
+	int chunk_3 = 44;
+
+	fd = udp_socket_create();
+
+	chunks[0].iov_base = &chunk_1;
+	chunks[0].iov_len = sizeof(int);
+	chunks[1].iov_base = &chunk_2;
+	chunks[1].iov_len = sizeof(int);
+	chunks[2].iov_base = &chunk_3;
+	chunks[2].iov_len = sizeof(int);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 3;
+
+	/* The datagram does not fit the intermediate buffer, but must still be sent at once */
+	__cmock_nrf_sendto_ExpectAndReturn(NRF_FD, NULL, 3 * sizeof(int),
+					   NRF_MSG_DONTWAIT,
+					   NULL, 0, 3 * sizeof(int));
+	__cmock_nrf_sendto_IgnoreArg_message();
+
+	ret = zsock_sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, 3 * sizeof(int));
+
+	socket_close(fd);
+}
+
+void test_nrf9x_socket_offload_sendmsg_single_iov_no_copy(void)
+{
+	int ret;
+	int fd;
+	int flags = ZSOCK_MSG_DONTWAIT;
+	struct net_msghdr msg = { 0 };
+	struct net_iovec chunks[2] = { 0 };
+	int data[3] = { 42, 43, 44 };
+
+	fd = udp_socket_create();
+
+	chunks[0].iov_base = NULL;
+	chunks[0].iov_len = 0;
+	chunks[1].iov_base = data;
+	chunks[1].iov_len = sizeof(data);
+	msg.msg_iov = chunks;
+	msg.msg_iovlen = 2;
+
+	/* The only non-empty buffer is sent directly */
+	__cmock_nrf_sendto_ExpectAndReturn(NRF_FD, data, sizeof(data),
+					   NRF_MSG_DONTWAIT,
+					   NULL, 0, sizeof(data));
+
+	ret = zsock_sendmsg(fd, &msg, flags);
+
+	TEST_ASSERT_EQUAL(ret, sizeof(data));
+
+	socket_close(fd);
+}
+
+void test_nrf9x_socket_offload_sendmmsg_ebadf(void)
+{
+	int ret;
+	struct nrf_modem_lib_mmsghdr msgvec[1] = { 0 };
+
+	ret = nrf_modem_lib_sendmmsg(-1, msgvec, ARRAY_SIZE(msgvec), 0);
+
+	TEST_ASSERT_EQUAL(ret, -1);
+	TEST_ASSERT_EQUAL(errno, EBADF);
+}
+
+void test_nrf9x_socket_offload_sendmmsg_success(void)
+{
+	int ret;
+	int fd;
+	int data_1 = 42;
+	int data_2[2] = { 43, 44 };
+	struct net_iovec iov[2] = {
+		{ .iov_base = &data_1, .iov_len = sizeof(data_1) },
+		{ .iov_base = data_2, .iov_len = sizeof(data_2) },
+	};
+	struct nrf_modem_lib_mmsghdr msgvec[2] = {
+		{ .msg_hdr = { .msg_iov = &iov[0], .msg_iovlen = 1 } },
+		{ .msg_hdr = { .msg_iov = &iov[1], .msg_iovlen = 1 } },
+	};
+
+	fd = udp_socket_create();
+
+	__cmock_nrf_sendto_ExpectAndReturn(NRF_FD, &data_1, sizeof(data_1), 0,
+					   NULL, 0, sizeof(data_1));
+	__cmock_nrf_sendto_ExpectAndReturn(NRF_FD, data_2, sizeof(data_2), 0,
+					   NULL, 0, sizeof(data_2));
+
+	ret = nrf_modem_lib_sendmmsg(fd, msgvec, ARRAY_SIZE(msgvec), 0);
+
+	TEST_ASSERT_EQUAL(ret, 2);
+	TEST_ASSERT_EQUAL(msgvec[0].msg_len, sizeof(data_1));
+	TEST_ASSERT_EQUAL(msgvec[1].msg_len, sizeof(data_2));
+
+	socket_close(fd);
+}
+
+void test_nrf9x_socket_offload_sendmmsg_partial(void)
+{
+	int ret;
+	int fd;
+	int data_1 = 42;
+	int data_2 = 43;
+	struct net_iovec iov[2] = {
+		{ .iov_base = &data_1, .iov_len = sizeof(data_1) },
+		{ .iov_base = &data_2, .iov_len = sizeof(data_2) },
+	};
+	struct nrf_modem_lib_mmsghdr msgvec[2] = {
+		{ .msg_hdr = { .msg_iov = &iov[0], .msg_iovlen = 1 } },
+		{ .msg_hdr = { .msg_iov = &iov[1], .msg_iovlen = 1 } },
+	};
+
+	fd = udp_socket_create();
+
+	__cmock_nrf_sendto_ExpectAndReturn(NRF_FD, &data_1, sizeof(data_1), 0,
+					   NULL, 0, sizeof(data_1));
+	__cmock_nrf_sendto_ExpectAndReturn(NRF_FD, &data_2, sizeof(data_2), 0,
+					   NULL, 0, -1);
+
+	/* The messages sent before the failure are reported */
+	ret = nrf_modem_lib_sendmmsg(fd, msgvec, ARRAY_SIZE(msgvec), 0);
+
+	TEST_ASSERT_EQUAL(ret, 1);
+	TEST_ASSERT_EQUAL(msgvec[0].msg_len, sizeof(data_1));
+
+	socket_close(fd);
+}
+
+static ssize_t nrf_recvfrom_batch_stub(int fd, void *buffer, size_t length,
+				       int flags, struct nrf_sockaddr *address,
+				       nrf_socklen_t *address_len,
+				       int cmock_num_calls)
+{
+	/* Only the first message may block */
+	TEST_ASSERT_EQUAL(cmock_num_calls == 0 ? 0 : NRF_MSG_DONTWAIT, flags);
+
+	/* Two messages are available */
+	if (cmock_num_calls >= 2) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	memset(buffer, cmock_num_calls + 1, length);
+
+	return length;
+}
+
+void test_nrf9x_socket_offload_recvmmsg_until_eagain(void)
+{
+	int ret;
+	int fd;
+	uint8_t data[3][4];
+	uint8_t part_1[2];
+	uint8_t part_2[2];
+	struct net_iovec iov[4] = {
+		{ .iov_base = data[0], .iov_len = sizeof(data[0]) },
+		{ .iov_base = part_1, .iov_len = sizeof(part_1) },
+		{ .iov_base = part_2, .iov_len = sizeof(part_2) },
+		{ .iov_base = data[2], .iov_len = sizeof(data[2]) },
+	};
+	struct nrf_modem_lib_mmsghdr msgvec[3] = {
+		{ .msg_hdr = { .msg_iov = &iov[0], .msg_iovlen = 1 } },
+		{ .msg_hdr = { .msg_iov = &iov[1], .msg_iovlen = 2 } },
+		{ .msg_hdr = { .msg_iov = &iov[3], .msg_iovlen = 1 } },
+	};
+
+	fd = udp_socket_create();
+
+	__cmock_nrf_recvfrom_Stub(nrf_recvfrom_batch_stub);
+
+	ret = nrf_modem_lib_recvmmsg(fd, msgvec, ARRAY_SIZE(msgvec), 0);
+
+	TEST_ASSERT_EQUAL(ret, 2);
+	TEST_ASSERT_EQUAL(msgvec[0].msg_len, sizeof(data[0]));
+	TEST_ASSERT_EQUAL(msgvec[1].msg_len, sizeof(part_1) + sizeof(part_2));
+	TEST_ASSERT_EACH_EQUAL_UINT8(1, data[0], sizeof(data[0]));
+	/* The second message is scattered to both buffers */
+	TEST_ASSERT_EACH_EQUAL_UINT8(2, part_1, sizeof(part_1));
+	TEST_ASSERT_EACH_EQUAL_UINT8(2, part_2, sizeof(part_2));
+
+	__cmock_nrf_recvfrom_Stub(NULL);
+
+	socket_close(fd);
+}
+
+#define THROUGHPUT_MSG_COUNT 256
+#define THROUGHPUT_BATCH_SIZE 16
+
+static size_t throughput_sent;
+
+static ssize_t nrf_sendto_count_stub(int fd, const void *message, size_t length,
+				     int flags, const struct nrf_sockaddr *dest_addr,
+				     nrf_socklen_t dest_len, int cmock_num_calls)
+{
+	throughput_sent += length;
+
+	return length;
+}
+
+void test_nrf9x_socket_offload_sendmmsg_throughput(void)
+{
+	int ret;
+	int fd;
+	uint32_t start;
+	uint32_t cycles_single;
+	uint32_t cycles_batch;
+	uint8_t header[4] = { 0 };
+	uint8_t payload[32] = { 0 };
+	struct net_iovec iov[2] = {
+		{ .iov_base = header, .iov_len = sizeof(header) },
+		{ .iov_base = payload, .iov_len = sizeof(payload) },
+	};
+	struct nrf_modem_lib_mmsghdr msgvec[THROUGHPUT_BATCH_SIZE];
+
+	for (int i = 0; i < ARRAY_SIZE(msgvec); i++) {
+		msgvec[i] = (struct nrf_modem_lib_mmsghdr) {
+			.msg_hdr = { .msg_iov = iov, .msg_iovlen = ARRAY_SIZE(iov) },
+		};
+	}
+
+	fd = udp_socket_create();
+
+	__cmock_nrf_sendto_Stub(nrf_sendto_count_stub);
+
+	throughput_sent = 0;
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < THROUGHPUT_MSG_COUNT; i++) {
+		ret = zsock_sendmsg(fd, &msgvec[0].msg_hdr, 0);
+		TEST_ASSERT_EQUAL(ret, sizeof(header) + sizeof(payload));
+	}
+
+	cycles_single = k_cycle_get_32() - start;
+
+	TEST_ASSERT_EQUAL(throughput_sent,
+			  THROUGHPUT_MSG_COUNT * (sizeof(header) + sizeof(payload)));
+
+	throughput_sent = 0;
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < THROUGHPUT_MSG_COUNT / THROUGHPUT_BATCH_SIZE; i++) {
+		ret = nrf_modem_lib_sendmmsg(fd, msgvec, ARRAY_SIZE(msgvec), 0);
+		TEST_ASSERT_EQUAL(ret, THROUGHPUT_BATCH_SIZE);
+	}
+
+	cycles_batch = k_cycle_get_32() - start;
+
+	TEST_ASSERT_EQUAL(throughput_sent,
+			  THROUGHPUT_MSG_COUNT * (sizeof(header) + sizeof(payload)));
+
+	printk("sendmsg: %u cycles, sendmmsg: %u cycles for %d datagrams\n",
+	       cycles_single, cycles_batch, THROUGHPUT_MSG_COUNT);
+
+	__cmock_nrf_sendto_Stub(NULL);
+
+	socket_close(fd);
+}
+
 /* It is required to be added to each test. That is because unity's
  * main may return nonzero, while zephyr's main currently must
  * return 0 in all cases (other values are reserved).
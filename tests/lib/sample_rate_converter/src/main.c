@@ -8,6 +8,7 @@
 #include <zephyr/tc_util.h>
 #include <sample_rate_converter.h>
 #include <stdlib.h>
+#include <string.h>
 
 struct sample_rate_converter_ctx conv_ctx;
 
@@ -441,6 +442,104 @@ ZTEST(suite_sample_rate_converter, test_valid_process_input_two_samples_decimate
 
 	zassert_within(output_samples[0], input_samples[0] / 2, 1);
 }
+
+static void process_interleaved_compare(uint32_t input_sample_rate, uint32_t output_sample_rate)
+{
+	int ret;
+	struct sample_rate_converter_ctx mono_ctx[2];
+	struct sample_rate_converter_ctx interleaved_ctx[2];
+	enum sample_rate_converter_filter filter = SAMPLE_RATE_FILTER_SIMPLE;
+
+	/* Two channels of different signals, in several blocks to exercise the buffering */
+	uint16_t input_samples[2][48];
+	uint16_t mono_output[2][144];
+	uint16_t interleaved_output[2 * 144];
+	size_t mono_written;
+	size_t interleaved_written;
+
+	for (int i = 0; i < ARRAY_SIZE(input_samples[0]); i++) {
+		input_samples[0][i] = i * 300;
+		input_samples[1][i] = 20000 - (i * 200);
+	}
+
+	for (int chan = 0; chan < 2; chan++) {
+		sample_rate_converter_open(&mono_ctx[chan]);
+		sample_rate_converter_open(&interleaved_ctx[chan]);
+	}
+
+	for (int block = 0; block < 3; block++) {
+		memset(interleaved_output, 0, sizeof(interleaved_output));
+
+		for (int chan = 0; chan < 2; chan++) {
+			ret = sample_rate_converter_process(
+				&mono_ctx[chan], filter, input_samples[chan],
+				sizeof(input_samples[chan]), input_sample_rate, mono_output[chan],
+				sizeof(mono_output[chan]), &mono_written, output_sample_rate);
+			zassert_equal(ret, 0, "Sample rate conversion process failed");
+
+			ret = sample_rate_converter_process_interleaved(
+				&interleaved_ctx[chan], filter, input_samples[chan],
+				sizeof(input_samples[chan]), input_sample_rate, interleaved_output,
+				sizeof(interleaved_output), &interleaved_written,
+				output_sample_rate, chan, 2);
+			zassert_equal(ret, 0, "Interleaved sample rate conversion process failed");
+
+			zassert_equal(interleaved_written, mono_written,
+				      "Interleaved conversion wrote %d bytes, expected %d",
+				      interleaved_written, mono_written);
+		}
+
+		for (int i = 0; i < mono_written / sizeof(uint16_t); i++) {
+			zassert_equal(interleaved_output[2 * i], mono_output[0][i],
+				      "Left sample %d not as expected in block %d", i, block);
+			zassert_equal(interleaved_output[2 * i + 1], mono_output[1][i],
+				      "Right sample %d not as expected in block %d", i, block);
+		}
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_process_interleaved_decimate)
+{
+	process_interleaved_compare(48000, 24000);
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_process_interleaved_interpolate_buffered)
+{
+	process_interleaved_compare(16000, 48000);
+}
+
+ZTEST(suite_sample_rate_converter, test_invalid_process_interleaved_channel)
+{
+	int ret;
+
+	uint16_t input_samples[] = {1000, 2000};
+	uint16_t output_samples[8];
+	size_t output_written;
+
+	ret = sample_rate_converter_process_interleaved(
+		&conv_ctx, SAMPLE_RATE_FILTER_TEST, input_samples, sizeof(input_samples), 24000,
+		output_samples, sizeof(output_samples), &output_written, 48000, 2, 2);
+
+	zassert_equal(ret, -EINVAL,
+		      "Sample rate conversion did not fail when the channel is out of range");
+}
+
+ZTEST(suite_sample_rate_converter, test_invalid_process_interleaved_output_buf_too_small)
+{
+	int ret;
+
+	uint16_t input_samples[] = {1000, 2000};
+	/* Two channels of four output samples need eight samples */
+	uint16_t output_samples[7];
+	size_t output_written;
+
+	ret = sample_rate_converter_process_interleaved(
+		&conv_ctx, SAMPLE_RATE_FILTER_TEST, input_samples, sizeof(input_samples), 24000,
+		output_samples, sizeof(output_samples), &output_written, 48000, 0, 2);
+
+	zassert_equal(ret, -EINVAL,
+		      "Sample rate conversion did not fail when output buffer is too small");
+}
 #endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
 
 #if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
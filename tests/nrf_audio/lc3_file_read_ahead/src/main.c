@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/storage/disk_access.h>
+#include <ff.h>
+
+#include "lc3_file.h"
+
+#define DISK_NAME	  "SD"
+#define DISK_SECTOR_SIZE  512
+#define DISK_SECTOR_COUNT 1024
+/* Match the allocation unit of an SD card, so that reads are not split at cluster boundaries */
+#define DISK_CLUSTER_SIZE 4096
+
+#define TEST_FILE_NAME	   "test.lc3"
+#define TEST_FILE_PATH	   "/SD:/" TEST_FILE_NAME
+#define LC3_FILE_ID	   0xCC1C
+#define FRAME_DURATION_US  10000
+#define FRAME_SIZE	   120
+#define FRAMES_PER_SECOND  (USEC_PER_SEC / FRAME_DURATION_US)
+#define AUDIO_DURATION_SEC 5
+#define FRAMES_NUM	   (FRAMES_PER_SECOND * AUDIO_DURATION_SEC)
+#define FILE_SIZE                                                                                  \
+	(sizeof(struct lc3_file_header) + (FRAMES_NUM * (sizeof(uint16_t) + FRAME_SIZE)))
+
+/* Reads of the file system metadata, such as the FAT, on top of the reads of the file data */
+#define METADATA_READS_MAX 4
+
+static uint8_t disk_data[DISK_SECTOR_COUNT * DISK_SECTOR_SIZE];
+static uint32_t disk_read_count;
+static uint32_t disk_sector_read_count;
+
+static int ram_disk_init(struct disk_info *disk)
+{
+	ARG_UNUSED(disk);
+
+	return 0;
+}
+
+static int ram_disk_status(struct disk_info *disk)
+{
+	ARG_UNUSED(disk);
+
+	return DISK_STATUS_OK;
+}
+
+static int ram_disk_read(struct disk_info *disk, uint8_t *data_buf, uint32_t start_sector,
+			 uint32_t num_sector)
+{
+	ARG_UNUSED(disk);
+
+	if ((start_sector + num_sector) > DISK_SECTOR_COUNT) {
+		return -EIO;
+	}
+
+	memcpy(data_buf, &disk_data[start_sector * DISK_SECTOR_SIZE],
+	       num_sector * DISK_SECTOR_SIZE);
+
+	disk_read_count++;
+	disk_sector_read_count += num_sector;
+
+	return 0;
+}
+
+static int ram_disk_write(struct disk_info *disk, const uint8_t *data_buf,
+			  uint32_t start_sector, uint32_t num_sector)
+{
+	ARG_UNUSED(disk);
+
+	if ((start_sector + num_sector) > DISK_SECTOR_COUNT) {
+		return -EIO;
+	}
+
+	memcpy(&disk_data[start_sector * DISK_SECTOR_SIZE], data_buf,
+	       num_sector * DISK_SECTOR_SIZE);
+
+	return 0;
+}
+
+static int ram_disk_ioctl(struct disk_info *disk, uint8_t cmd, void *buff)
+{
+	ARG_UNUSED(disk);
+
+	switch (cmd) {
+	case DISK_IOCTL_CTRL_SYNC:
+	case DISK_IOCTL_CTRL_INIT:
+	case DISK_IOCTL_CTRL_DEINIT:
+		return 0;
+	case DISK_IOCTL_GET_SECTOR_COUNT:
+		*(uint32_t *)buff = DISK_SECTOR_COUNT;
+		return 0;
+	case DISK_IOCTL_GET_SECTOR_SIZE:
+		*(uint32_t *)buff = DISK_SECTOR_SIZE;
+		return 0;
+	case DISK_IOCTL_GET_ERASE_BLOCK_SZ:
+		*(uint32_t *)buff = 1;
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+static const struct disk_operations disk_ops = {
+	.init = ram_disk_init,
+	.status = ram_disk_status,
+	.read = ram_disk_read,
+	.write = ram_disk_write,
+	.ioctl = ram_disk_ioctl,
+};
+
+/* RAM disk counting the reads, standing in for the SD card */
+static struct disk_info disk = {
+	.name = DISK_NAME,
+	.ops = &disk_ops,
+};
+
+static uint8_t frame_byte_get(uint32_t frame, uint32_t i)
+{
+	return (uint8_t)((frame * 31) + (i * 7));
+}
+
+static void test_file_create(void)
+{
+	int ret;
+	struct fs_file_t file;
+	uint8_t frame[sizeof(uint16_t) + FRAME_SIZE];
+	struct lc3_file_header header = {
+		.file_id = LC3_FILE_ID,
+		.hdr_size = sizeof(struct lc3_file_header),
+		.sample_rate = 48000 / 100,
+		.bit_rate = (FRAME_SIZE * 8 * FRAMES_PER_SECOND) / 100,
+		.channels = 1,
+		.frame_duration = FRAME_DURATION_US / 10,
+		.signal_len_lsb = (FRAMES_NUM * 480) & UINT16_MAX,
+		.signal_len_msb = (FRAMES_NUM * 480) >> 16,
+	};
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, TEST_FILE_PATH, FS_O_CREATE | FS_O_WRITE);
+	zassert_equal(ret, 0, "Failed to create file: %d", ret);
+
+	ret = fs_write(&file, &header, sizeof(header));
+	zassert_equal(ret, sizeof(header), "Failed to write header: %d", ret);
+
+	for (uint32_t i = 0; i < FRAMES_NUM; i++) {
+		sys_put_le16(FRAME_SIZE, frame);
+
+		for (uint32_t j = 0; j < FRAME_SIZE; j++) {
+			frame[sizeof(uint16_t) + j] = frame_byte_get(i, j);
+		}
+
+		ret = fs_write(&file, frame, sizeof(frame));
+		zassert_equal(ret, sizeof(frame), "Failed to write frame %d: %d", i, ret);
+	}
+
+	ret = fs_close(&file);
+	zassert_equal(ret, 0, "Failed to close file: %d", ret);
+}
+
+static void *suite_setup(void)
+{
+	int ret;
+	MKFS_PARM mkfs_opt = {
+		.fmt = FM_ANY | FM_SFD,
+		.au_size = DISK_CLUSTER_SIZE,
+	};
+
+	ret = disk_access_register(&disk);
+	zassert_equal(ret, 0, "Failed to register disk: %d", ret);
+
+	ret = fs_mkfs(FS_FATFS, (uintptr_t)DISK_NAME ":", &mkfs_opt, 0);
+	zassert_equal(ret, 0, "Failed to format disk: %d", ret);
+
+	ret = lc3_file_init();
+	zassert_equal(ret, 0, "Failed to initialize LC3 file module: %d", ret);
+
+	test_file_create();
+
+	return NULL;
+}
+
+ZTEST(lc3_file_read_ahead, test_disk_reads_per_second)
+{
+	int ret;
+	uint32_t frames = 0;
+	uint32_t reads_per_second;
+	uint8_t frame[FRAME_SIZE];
+	struct lc3_file_ctx file;
+	struct lc3_file_header header;
+
+	disk_read_count = 0;
+	disk_sector_read_count = 0;
+
+	ret = lc3_file_open(&file, TEST_FILE_NAME);
+	zassert_equal(ret, 0, "Failed to open file: %d", ret);
+
+	ret = lc3_header_get(&file, &header);
+	zassert_equal(ret, 0, "Failed to get header: %d", ret);
+	zassert_equal(header.frame_duration * 10, FRAME_DURATION_US, "Wrong frame duration");
+
+	while (true) {
+		ret = lc3_file_frame_get(&file, frame, sizeof(frame));
+		if (ret == -ENODATA) {
+			break;
+		}
+
+		zassert_equal(ret, 0, "Failed to get frame %d: %d", frames, ret);
+
+		for (uint32_t i = 0; i < FRAME_SIZE; i++) {
+			zassert_equal(frame[i], frame_byte_get(frames, i), "Frame %d differs at %d",
+				      frames, i);
+		}
+
+		frames++;
+
+		/* Pace the reads like a stream, letting the read-ahead run in between */
+		k_usleep(FRAME_DURATION_US);
+	}
+
+	ret = lc3_file_close(&file);
+	zassert_equal(ret, 0, "Failed to close file: %d", ret);
+
+	zassert_equal(frames, FRAMES_NUM, "Expected %d frames, got %d", FRAMES_NUM, frames);
+
+	reads_per_second = DIV_ROUND_UP(disk_read_count, AUDIO_DURATION_SEC);
+
+	TC_PRINT("%d disk reads (%d sectors) for %d s of audio: %d reads per second\n",
+		 disk_read_count, disk_sector_read_count, AUDIO_DURATION_SEC, reads_per_second);
+
+#if defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD)
+	zassert_true(disk_read_count <=
+			     DIV_ROUND_UP(FILE_SIZE,
+					  CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD_BLOCK_SIZE) +
+				     METADATA_READS_MAX,
+		     "Expected one disk read per block, got %d reads", disk_read_count);
+#endif /* defined(CONFIG_NRF_AUDIO_SD_CARD_LC3_FILE_READ_AHEAD) */
+}
+
+ZTEST_SUITE(lc3_file_read_ahead, NULL, suite_setup, NULL, NULL, NULL);
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "spsc_ring.h"
+
+/* Same size as the default SD card playback ring buffer, not a power of two */
+#define RING_SIZE 960
+
+#define STRESS_TOTAL_BYTES    200000
+#define STRESS_CHUNK_SIZE_MAX 300
+#define STRESS_READ_SIZE      96
+#define STRESS_READ_PERIOD_US 100
+#define STRESS_TIMEOUT_MS     10000
+
+#define PRODUCER_STACK_SIZE 2048
+#define PRODUCER_PRIO	    5
+
+static uint8_t ring_buf[RING_SIZE];
+static struct spsc_ring ring;
+
+K_THREAD_STACK_DEFINE(producer_stack, PRODUCER_STACK_SIZE);
+static struct k_thread producer_thread;
+static K_SEM_DEFINE(space_sem, 0, 1);
+static K_SEM_DEFINE(done_sem, 0, 1);
+
+static uint32_t produced;
+static uint32_t consumed;
+static uint32_t producer_waits;
+static uint32_t underruns;
+static uint32_t mismatches;
+static uint32_t rand_state;
+
+static uint8_t pattern_byte_get(uint32_t n)
+{
+	return (uint8_t)((n * 7) + (n >> 8));
+}
+
+static uint32_t rand_get(void)
+{
+	/* Deterministic, so that a failing run can be reproduced */
+	rand_state = (rand_state * 1103515245) + 12345;
+
+	return rand_state >> 16;
+}
+
+static void consumer_timer_handler(struct k_timer *timer)
+{
+	uint8_t buf[STRESS_READ_SIZE];
+	size_t read_size;
+
+	read_size = spsc_ring_get(&ring, buf, sizeof(buf));
+	if (read_size != sizeof(buf)) {
+		underruns++;
+	}
+
+	for (size_t i = 0; i < read_size; i++) {
+		if (buf[i] != pattern_byte_get(consumed + i)) {
+			mismatches++;
+		}
+	}
+
+	consumed += read_size;
+
+	if (spsc_ring_space_get(&ring) >= STRESS_CHUNK_SIZE_MAX) {
+		k_sem_give(&space_sem);
+	}
+
+	if (consumed >= STRESS_TOTAL_BYTES) {
+		k_timer_stop(timer);
+		k_sem_give(&done_sem);
+	}
+}
+
+static K_TIMER_DEFINE(consumer_timer, consumer_timer_handler, NULL);
+
+static void producer(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t *claim_ptr;
+	size_t claimed;
+	size_t chunk;
+
+	while (produced < STRESS_TOTAL_BYTES) {
+		chunk = MIN(1 + (rand_get() % STRESS_CHUNK_SIZE_MAX), STRESS_TOTAL_BYTES - produced);
+
+		claimed = spsc_ring_put_claim(&ring, &claim_ptr, chunk);
+		if (claimed == 0) {
+			producer_waits++;
+			(void)k_sem_take(&space_sem, K_MSEC(20));
+			continue;
+		}
+
+		for (size_t i = 0; i < claimed; i++) {
+			claim_ptr[i] = pattern_byte_get(produced + i);
+		}
+
+		/* Let the consumer interrupt the producer between writing and publishing */
+		k_busy_wait(rand_get() % 50);
+
+		spsc_ring_put_finish(&ring, claimed);
+		produced += claimed;
+	}
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	spsc_ring_init(&ring, ring_buf, sizeof(ring_buf));
+}
+
+ZTEST(spsc_ring, test_put_get_wrap)
+{
+	static uint8_t in[RING_SIZE];
+	static uint8_t out[RING_SIZE];
+	size_t size;
+
+	for (size_t i = 0; i < sizeof(in); i++) {
+		in[i] = pattern_byte_get(i);
+	}
+
+	/* Move the indexes close to the end of the buffer */
+	size = spsc_ring_put(&ring, in, RING_SIZE - 10);
+	zassert_equal(size, RING_SIZE - 10);
+	size = spsc_ring_get(&ring, out, RING_SIZE - 10);
+	zassert_equal(size, RING_SIZE - 10);
+	zassert_mem_equal(in, out, RING_SIZE - 10);
+
+	/* Fill the whole ring, wrapping around the end of the buffer */
+	size = spsc_ring_put(&ring, in, sizeof(in));
+	zassert_equal(size, RING_SIZE, "Expected a full ring");
+	zassert_equal(spsc_ring_space_get(&ring), 0);
+	zassert_equal(spsc_ring_used_get(&ring), RING_SIZE);
+	zassert_equal(spsc_ring_put(&ring, in, 1), 0, "Expected no space left");
+
+	size = spsc_ring_get(&ring, out, sizeof(out));
+	zassert_equal(size, RING_SIZE);
+	zassert_mem_equal(in, out, RING_SIZE);
+	zassert_equal(spsc_ring_used_get(&ring), 0);
+}
+
+ZTEST(spsc_ring, test_put_claim_contiguous)
+{
+	uint8_t buf[100] = {0};
+	uint8_t *claim_ptr;
+	size_t claimed;
+
+	zassert_equal(spsc_ring_put(&ring, buf, 100), 100);
+	zassert_equal(spsc_ring_get(&ring, buf, 100), 100);
+
+	/* The free space wraps, so the claim stops at the end of the buffer */
+	claimed = spsc_ring_put_claim(&ring, &claim_ptr, RING_SIZE);
+	zassert_equal(claimed, RING_SIZE - 100);
+	zassert_equal_ptr(claim_ptr, &ring_buf[100]);
+
+	/* Nothing is readable before the claim is finished */
+	zassert_equal(spsc_ring_used_get(&ring), 0);
+
+	spsc_ring_put_finish(&ring, 10);
+	zassert_equal(spsc_ring_used_get(&ring), 10);
+
+	claimed = spsc_ring_put_claim(&ring, &claim_ptr, RING_SIZE);
+	zassert_equal(claimed, RING_SIZE - 110);
+	zassert_equal_ptr(claim_ptr, &ring_buf[110]);
+}
+
+ZTEST(spsc_ring, test_get_underrun)
+{
+	uint8_t buf[STRESS_READ_SIZE] = {0};
+
+	zassert_equal(spsc_ring_put(&ring, buf, STRESS_READ_SIZE / 2), STRESS_READ_SIZE / 2);
+	zassert_equal(spsc_ring_get(&ring, buf, sizeof(buf)), STRESS_READ_SIZE / 2,
+		      "Expected a short read");
+	zassert_equal(spsc_ring_get(&ring, buf, sizeof(buf)), 0, "Expected an empty ring");
+}
+
+ZTEST(spsc_ring, test_stress_thread_producer_isr_consumer)
+{
+	int ret;
+
+	produced = 0;
+	consumed = 0;
+	producer_waits = 0;
+	underruns = 0;
+	mismatches = 0;
+	rand_state = 1;
+	k_sem_reset(&space_sem);
+	k_sem_reset(&done_sem);
+
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer, NULL, NULL, NULL, K_PRIO_PREEMPT(PRODUCER_PRIO), 0, K_NO_WAIT);
+
+	k_timer_start(&consumer_timer, K_USEC(STRESS_READ_PERIOD_US),
+		      K_USEC(STRESS_READ_PERIOD_US));
+
+	ret = k_sem_take(&done_sem, K_MSEC(STRESS_TIMEOUT_MS));
+
+	k_timer_stop(&consumer_timer);
+	k_thread_abort(&producer_thread);
+
+	zassert_equal(ret, 0, "Stress test did not finish, consumed %d of %d bytes", consumed,
+		      STRESS_TOTAL_BYTES);
+
+	TC_PRINT("%d bytes: %d underruns, %d producer waits\n", consumed, underruns,
+		 producer_waits);
+
+	zassert_equal(consumed, STRESS_TOTAL_BYTES, "Consumed %d bytes", consumed);
+	zassert_equal(mismatches, 0, "%d bytes were corrupted", mismatches);
+	zassert_equal(spsc_ring_used_get(&ring), 0, "Expected an empty ring");
+}
+
+ZTEST_SUITE(spsc_ring, NULL, NULL, test_before, NULL, NULL);
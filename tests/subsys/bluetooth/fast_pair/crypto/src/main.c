@@ -453,6 +453,122 @@ ZTEST(suite_crypto, test_bloom_filter)
 			  "Invalid resulting filter.");
 }
 
+ZTEST(suite_crypto, test_bloom_filter_ctx)
+{
+	static const uint16_t salt = 0xC7C8;
+	static const uint8_t battery_info[] = {0b00110011, 0b01000000, 0b01000000, 0b01000000};
+
+	static const struct fp_account_key account_key_list[] = {
+		{ .key = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0x00, 0xAA, 0xBB,
+			  0xCC, 0xDD, 0xEE, 0xFF} },
+		{ .key = {0x11, 0x11, 0x22, 0x22, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66,
+			  0x77, 0x77, 0x88, 0x88} }
+		};
+
+	static const uint8_t first_bloom_filter[] = {0x02, 0x0C, 0x80, 0x2A};
+	static const uint8_t second_bloom_filter[] = {0x84, 0x4A, 0x62, 0x20, 0x8B};
+	static const uint8_t second_bloom_filter_with_battery_info[] = {0x46, 0x15, 0x24, 0xD0,
+									0x08};
+
+	static struct fp_crypto_account_key_filter_ctx ctx;
+	uint8_t result_buf[FP_CRYPTO_ACCOUNT_KEY_FILTER_LEN_MAX];
+
+	zassert_equal(fp_crypto_account_key_filter_ctx_keys_set(&ctx, account_key_list, 0),
+		      -EINVAL, "Expected error for empty Account Key List");
+
+	zassert_ok(fp_crypto_account_key_filter_ctx_keys_set(&ctx, account_key_list, 1));
+	zassert_ok(fp_crypto_account_key_filter_ctx_compute(&ctx, result_buf, salt, NULL));
+	zassert_mem_equal(result_buf, first_bloom_filter, sizeof(first_bloom_filter),
+			  "Invalid resulting filter.");
+
+	zassert_ok(fp_crypto_account_key_filter_ctx_keys_set(&ctx, account_key_list, 2));
+	zassert_ok(fp_crypto_account_key_filter_ctx_compute(&ctx, result_buf, salt, NULL));
+	zassert_mem_equal(result_buf, second_bloom_filter, sizeof(second_bloom_filter),
+			  "Invalid resulting filter.");
+
+	/* Unchanged inputs reuse the last computed filter. */
+	memset(result_buf, 0, sizeof(result_buf));
+	zassert_ok(fp_crypto_account_key_filter_ctx_keys_set(&ctx, account_key_list, 2));
+	zassert_ok(fp_crypto_account_key_filter_ctx_compute(&ctx, result_buf, salt, NULL));
+	zassert_mem_equal(result_buf, second_bloom_filter, sizeof(second_bloom_filter),
+			  "Invalid resulting filter.");
+
+	zassert_ok(fp_crypto_account_key_filter_ctx_compute(&ctx, result_buf, salt,
+							    battery_info));
+	zassert_mem_equal(result_buf, second_bloom_filter_with_battery_info,
+			  sizeof(second_bloom_filter_with_battery_info),
+			  "Invalid resulting filter.");
+
+	zassert_ok(fp_crypto_account_key_filter_ctx_compute(&ctx, result_buf, salt, NULL));
+	zassert_mem_equal(result_buf, second_bloom_filter, sizeof(second_bloom_filter),
+			  "Invalid resulting filter.");
+
+	fp_crypto_account_key_filter_ctx_clear(&ctx);
+	zassert_equal(fp_crypto_account_key_filter_ctx_compute(&ctx, result_buf, salt, NULL),
+		      -EINVAL, "Expected error for cleared context");
+}
+
+ZTEST(suite_crypto, test_bloom_filter_benchmark)
+{
+	static const size_t iterations = 20;
+	static const uint8_t battery_info[] = {0b00110011, 0b01000000, 0b01000000, 0b01000000};
+
+	static struct fp_crypto_account_key_filter_ctx ctx;
+	struct fp_account_key account_key_list[FP_CRYPTO_ACCOUNT_KEY_FILTER_KEY_CNT_MAX];
+	uint8_t expected_buf[FP_CRYPTO_ACCOUNT_KEY_FILTER_LEN_MAX];
+	uint8_t result_buf[FP_CRYPTO_ACCOUNT_KEY_FILTER_LEN_MAX];
+
+	for (size_t i = 0; i < ARRAY_SIZE(account_key_list); i++) {
+		memset(account_key_list[i].key, i + 1, sizeof(account_key_list[i].key));
+	}
+
+	for (size_t n = 1; n <= ARRAY_SIZE(account_key_list); n++) {
+		size_t s = fp_crypto_account_key_filter_size(n);
+		uint64_t full_cycles = 0;
+		uint64_t refresh_cycles = 0;
+		uint64_t unchanged_cycles = 0;
+		uint32_t start;
+
+		zassert_true(s <= sizeof(result_buf), "Invalid filter size");
+		zassert_ok(fp_crypto_account_key_filter_ctx_keys_set(&ctx, account_key_list, n));
+
+		for (size_t i = 0; i < iterations; i++) {
+			uint16_t salt = i;
+
+			start = k_cycle_get_32();
+			zassert_ok(fp_crypto_account_key_filter(expected_buf, account_key_list, n,
+								salt, battery_info));
+			full_cycles += k_cycle_get_32() - start;
+
+			/* New Salt with the same Account Key List. */
+			start = k_cycle_get_32();
+			zassert_ok(fp_crypto_account_key_filter_ctx_keys_set(&ctx,
+									     account_key_list,
+									     n));
+			zassert_ok(fp_crypto_account_key_filter_ctx_compute(&ctx, result_buf, salt,
+									    battery_info));
+			refresh_cycles += k_cycle_get_32() - start;
+			zassert_mem_equal(result_buf, expected_buf, s, "Invalid resulting filter.");
+
+			/* No input changed. */
+			start = k_cycle_get_32();
+			zassert_ok(fp_crypto_account_key_filter_ctx_keys_set(&ctx,
+									     account_key_list,
+									     n));
+			zassert_ok(fp_crypto_account_key_filter_ctx_compute(&ctx, result_buf, salt,
+									    battery_info));
+			unchanged_cycles += k_cycle_get_32() - start;
+			zassert_mem_equal(result_buf, expected_buf, s, "Invalid resulting filter.");
+		}
+
+		TC_PRINT("Account Key Filter, %zu keys: full %llu, new salt %llu, "
+			 "unchanged %llu cycles\n", n, full_cycles / iterations,
+			 refresh_cycles / iterations, unchanged_cycles / iterations);
+	}
+
+	fp_crypto_account_key_filter_ctx_clear(&ctx);
+}
+
 ZTEST(suite_crypto, test_additional_data_packet)
 {
 	static const uint8_t input_data[] = {0x53, 0x6F, 0x6D, 0x65, 0x6F, 0x6E, 0x65, 0x27, 0x73,
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+
+#include "fp_storage_ak.h"
+#include "fp_storage.h"
+#include "fp_storage_ak_priv.h"
+#include "fp_storage_manager_priv.h"
+#include "fp_common.h"
+
+#include "storage_mock.h"
+#include "common_utils.h"
+
+#define ACCOUNT_KEY_MAX_CNT	CONFIG_BT_FAST_PAIR_STORAGE_ACCOUNT_KEY_MAX
+#define WRITE_BACK_DELAY	K_MSEC(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_WRITE_BACK_DELAY + 10)
+#define LATENCY_ITERATIONS	100
+
+static const uint8_t first_seed;
+
+static void init(void)
+{
+	int err;
+
+	err = settings_load();
+	zassert_ok(err, "Failed to load settings");
+
+	err = fp_storage_init();
+	zassert_ok(err, "Failed to initialize module");
+}
+
+/* Simulate a reset: drop all RAM state, including the pending deferred write. */
+static void reset_and_reload(void)
+{
+	fp_storage_ak_ram_clear();
+	fp_storage_manager_ram_clear();
+	cu_account_keys_validate_uninitialized();
+	init();
+}
+
+static void before_fn(void *f)
+{
+	ARG_UNUSED(f);
+
+	cu_account_keys_validate_uninitialized();
+	init();
+}
+
+static void after_fn(void *f)
+{
+	ARG_UNUSED(f);
+
+	fp_storage_ak_ram_clear();
+	fp_storage_manager_ram_clear();
+	storage_mock_clear();
+	cu_account_keys_validate_uninitialized();
+}
+
+static bool account_key_find_cb(const struct fp_account_key *account_key, void *context)
+{
+	uint8_t *seed = context;
+
+	return cu_check_account_key_seed(*seed, account_key);
+}
+
+static void account_key_use(uint8_t seed)
+{
+	int err;
+
+	err = fp_storage_ak_find(NULL, account_key_find_cb, &seed);
+	zassert_ok(err, "Failed to find Account Key");
+}
+
+static bool account_key_is_stored(uint8_t seed)
+{
+	return (fp_storage_ak_find(NULL, account_key_find_cb, &seed) == 0);
+}
+
+/* Fill the Account Key List, mark the oldest key as used and add one more key. The least recently
+ * used key according to the order seen by the storage module is overwritten.
+ */
+static void full_list_prepare(void)
+{
+	cu_account_keys_generate_and_store(first_seed, ACCOUNT_KEY_MAX_CNT);
+	account_key_use(first_seed);
+}
+
+static void full_list_overflow_check(uint8_t expected_dropped_seed)
+{
+	uint8_t other_seed = (expected_dropped_seed == first_seed) ?
+			     (first_seed + 1) : first_seed;
+
+	cu_account_keys_generate_and_store(first_seed + ACCOUNT_KEY_MAX_CNT, 1);
+
+	zassert_false(account_key_is_stored(expected_dropped_seed), "Wrong Account Key dropped");
+	zassert_true(account_key_is_stored(other_seed), "Wrong Account Key dropped");
+}
+
+ZTEST(suite_fast_pair_storage_ak_order_write_back, test_reset_before_flush)
+{
+	full_list_prepare();
+
+	/* The usage order update is lost, but the stored data stays consistent. */
+	reset_and_reload();
+	cu_account_keys_validate_loaded(first_seed, ACCOUNT_KEY_MAX_CNT);
+	full_list_overflow_check(first_seed);
+}
+
+ZTEST(suite_fast_pair_storage_ak_order_write_back, test_explicit_flush)
+{
+	int err;
+
+	full_list_prepare();
+
+	err = fp_storage_ak_order_flush();
+	zassert_ok(err, "Failed to flush Account Key order");
+
+	reset_and_reload();
+	cu_account_keys_validate_loaded(first_seed, ACCOUNT_KEY_MAX_CNT);
+	full_list_overflow_check(first_seed + 1);
+}
+
+ZTEST(suite_fast_pair_storage_ak_order_write_back, test_delayed_flush)
+{
+	full_list_prepare();
+
+	k_sleep(WRITE_BACK_DELAY);
+
+	reset_and_reload();
+	cu_account_keys_validate_loaded(first_seed, ACCOUNT_KEY_MAX_CNT);
+	full_list_overflow_check(first_seed + 1);
+}
+
+ZTEST(suite_fast_pair_storage_ak_order_write_back, test_uninit_flush)
+{
+	int err;
+
+	full_list_prepare();
+
+	err = fp_storage_uninit();
+	zassert_ok(err, "Uninitialization failed");
+
+	reset_and_reload();
+	full_list_overflow_check(first_seed + 1);
+}
+
+ZTEST(suite_fast_pair_storage_ak_order_write_back, test_save_stores_pending_order)
+{
+	full_list_prepare();
+
+	/* Adding a key saves the pending usage order together with the new key. */
+	cu_account_keys_generate_and_store(first_seed + ACCOUNT_KEY_MAX_CNT, 1);
+
+	reset_and_reload();
+	zassert_true(account_key_is_stored(first_seed), "Wrong Account Key dropped");
+	zassert_false(account_key_is_stored(first_seed + 1), "Wrong Account Key dropped");
+
+	/* Settings are consistent after the reset and further operations are possible. */
+	cu_account_keys_generate_and_store(first_seed + ACCOUNT_KEY_MAX_CNT + 1, 1);
+	zassert_equal(fp_storage_ak_count(), ACCOUNT_KEY_MAX_CNT, "Invalid Account Key count");
+}
+
+ZTEST(suite_fast_pair_storage_ak_order_write_back, test_find_latency)
+{
+	uint64_t deferred_cycles = 0;
+	uint64_t sync_cycles = 0;
+	uint32_t start;
+	int err;
+
+	cu_account_keys_generate_and_store(first_seed, ACCOUNT_KEY_MAX_CNT);
+
+	for (size_t i = 0; i < LATENCY_ITERATIONS; i++) {
+		uint8_t seed = first_seed + (i % ACCOUNT_KEY_MAX_CNT);
+
+		/* Write-back mode: only the RAM order is updated on the critical path. */
+		start = k_cycle_get_32();
+		account_key_use(seed);
+		deferred_cycles += k_cycle_get_32() - start;
+
+		/* Immediate mode equivalent: the order is saved as part of the lookup. */
+		start = k_cycle_get_32();
+		account_key_use(seed);
+		err = fp_storage_ak_order_flush();
+		sync_cycles += k_cycle_get_32() - start;
+		zassert_ok(err, "Failed to flush Account Key order");
+	}
+
+	TC_PRINT("Account Key lookup with deferred order save: %llu cycles\n",
+		 deferred_cycles / LATENCY_ITERATIONS);
+	TC_PRINT("Account Key lookup with immediate order save: %llu cycles\n",
+		 sync_cycles / LATENCY_ITERATIONS);
+}
+
+ZTEST_SUITE(suite_fast_pair_storage_ak_order_write_back, NULL, NULL, before_fn, after_fn, NULL);
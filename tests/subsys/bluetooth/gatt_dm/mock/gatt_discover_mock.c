@@ -5,6 +5,7 @@
  */
 #include <stdbool.h>
 #include <inttypes.h>
+#include <zephyr/bluetooth/att.h>
 #include <zephyr/bluetooth/gatt.h>
 #include <zephyr/bluetooth/uuid.h>
 #include <zephyr/kernel.h>
@@ -19,15 +20,39 @@ static struct bt_discover_mock {
 	struct bt_conn *conn;
 	struct bt_gatt_discover_params *params;
 	struct k_work_delayable work;
+	uint32_t call_cnt;
 } discover_mock_data;
 
+/* Settings of the read mock */
+static struct bt_read_mock {
+	const void *data;
+	size_t len;
+	struct bt_conn *conn;
+	struct bt_gatt_read_params *params;
+	struct k_work_delayable work;
+} read_mock_data;
+
 static void bt_gatt_discover_work(struct k_work *work);
+static void bt_gatt_read_work(struct k_work *work);
 
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len)
 {
 	k_work_init_delayable(&discover_mock_data.work, bt_gatt_discover_work);
 	discover_mock_data.attr = attr;
 	discover_mock_data.len  = len;
+	discover_mock_data.call_cnt = 0;
+}
+
+uint32_t bt_gatt_discover_mock_call_count(void)
+{
+	return discover_mock_data.call_cnt;
+}
+
+void bt_gatt_read_mock_setup(const void *data, size_t len)
+{
+	k_work_init_delayable(&read_mock_data.work, bt_gatt_read_work);
+	read_mock_data.data = data;
+	read_mock_data.len  = len;
 }
 
 static bool bt_gatt_primary_check(const struct bt_gatt_attr *attr_cur,
@@ -128,7 +153,43 @@ int bt_gatt_discover(struct bt_conn *conn,
 	printk("Running %s mock\n", __func__);
 	discover_mock_data.conn = conn;
 	discover_mock_data.params = params;
+	discover_mock_data.call_cnt++;
 
 	k_work_schedule(&discover_mock_data.work, K_MSEC(5));
 	return 0;
 }
+
+static void bt_gatt_read_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_read_mock *mock_data =
+		CONTAINER_OF(dwork, struct bt_read_mock, work);
+	uint8_t ret;
+
+	if (!mock_data->data) {
+		(void)mock_data->params->func(mock_data->conn,
+					      BT_ATT_ERR_ATTRIBUTE_NOT_FOUND,
+					      mock_data->params, NULL, 0);
+		return;
+	}
+
+	ret = mock_data->params->func(mock_data->conn, 0, mock_data->params,
+				      mock_data->data, mock_data->len);
+	if (ret == BT_GATT_ITER_CONTINUE) {
+		/* Send NULL to mark processing end */
+		(void)mock_data->params->func(mock_data->conn, 0,
+					      mock_data->params, NULL, 0);
+	}
+}
+
+/* Mocked version of the bt_gatt_read */
+/* Call the bt_gatt_read_mock_setup function first */
+int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params)
+{
+	printk("Running %s mock\n", __func__);
+	read_mock_data.conn = conn;
+	read_mock_data.params = params;
+
+	k_work_schedule(&read_mock_data.work, K_MSEC(5));
+	return 0;
+}
@@ -90,5 +90,23 @@
  */
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len);
 
+/**
+ * @brief Get the number of @ref bt_gatt_discover calls
+ *
+ * @return The number of calls since the last @ref bt_gatt_discover_mock_setup call.
+ */
+uint32_t bt_gatt_discover_mock_call_count(void);
+
+/**
+ * @brief GATT read mock setup
+ *
+ * This function setups the mock for @ref bt_gatt_read function.
+ * The value is returned for every read, regardless of the read parameters.
+ *
+ * @param data The value returned by the read, NULL to fail the read.
+ * @param len  The length of the value.
+ */
+void bt_gatt_read_mock_setup(const void *data, size_t len);
+
 /** @} */
 #endif /* #define BT_GATT_DISCOVERY_MOCK_H_ */
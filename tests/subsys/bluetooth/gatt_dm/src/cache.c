@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <bluetooth/gatt_dm.h>
+#include "../mock/gatt_discover_mock.h"
+
+#define CACHE_SETTINGS_SUBTREE "bt/dm_cache"
+#define CACHE_HASH_LEN 16
+#define CACHE_RECORD_HDR_LEN 8
+
+/* Time for the discovery results to be written to the settings */
+#define CACHE_SAVE_TIMEOUT 100
+
+#define DIS_ATTR_CNT 5
+#define HRS_ATTR_CNT 3
+
+/* Layout of the cache entry stored in settings, see gatt_dm.c */
+struct cache_entry {
+	bt_addr_le_t addr;
+	uint8_t id;
+	uint8_t hash[CACHE_HASH_LEN];
+	uint16_t len;
+	uint8_t data[CONFIG_BT_GATT_DM_CACHE_PEER_SIZE];
+};
+
+/* Implemented in main.c */
+extern struct k_sem discovery_finished;
+struct bt_gatt_dm *run_dm(const struct bt_uuid *svc_uuid);
+
+static const struct bt_gatt_attr cache_sim[] = {
+	/* DIS */
+	BT_GATT_DISCOVER_MOCK_SERV(1, BT_UUID_DIS, 5),
+	BT_GATT_DISCOVER_MOCK_CHRC(2, BT_UUID_DIS_MODEL_NUMBER, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(3, BT_UUID_DIS_MODEL_NUMBER),
+
+	BT_GATT_DISCOVER_MOCK_CHRC(4, BT_UUID_DIS_MANUFACTURER_NAME, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(5, BT_UUID_DIS_MANUFACTURER_NAME),
+
+	/* HRS */
+	BT_GATT_DISCOVER_MOCK_SERV(6, BT_UUID_HRS, 8),
+	BT_GATT_DISCOVER_MOCK_CHRC(7, BT_UUID_HRS_MEASUREMENT, BT_GATT_CHRC_NOTIFY),
+	BT_GATT_DISCOVER_MOCK_DESC(8, BT_UUID_HRS_MEASUREMENT),
+};
+
+static const uint8_t hash_a[CACHE_HASH_LEN] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10
+};
+
+static const uint8_t hash_b[CACHE_HASH_LEN] = {
+	0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+	0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff, 0x00
+};
+
+static bt_addr_le_t peer_addr;
+static bool peer_bonded;
+static struct bt_gatt_dm_cache_stats stats_before;
+static struct cache_entry entry;
+
+/* The fake connection object is a connection to the peer set with peer_set(). */
+int __wrap_bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
+{
+	ARG_UNUSED(conn);
+
+	memset(info, 0, sizeof(*info));
+	info->type = BT_CONN_TYPE_LE;
+	info->id = BT_ID_DEFAULT;
+	info->le.dst = &peer_addr;
+
+	return 0;
+}
+
+bool __wrap_bt_le_bond_exists(uint8_t id, const bt_addr_le_t *addr)
+{
+	return peer_bonded && (id == BT_ID_DEFAULT) && bt_addr_le_eq(addr, &peer_addr);
+}
+
+static void peer_set(uint8_t peer)
+{
+	memset(&peer_addr, 0, sizeof(peer_addr));
+	peer_addr.type = BT_ADDR_LE_PUBLIC;
+	peer_addr.a.val[0] = peer;
+}
+
+static void cache_key_get(char *key, size_t key_size, size_t index)
+{
+	snprintf(key, key_size, CACHE_SETTINGS_SUBTREE "/%zu", index);
+}
+
+/* Drops the cached results held in RAM. The results stored in settings are kept. */
+static void cache_ram_clear(void)
+{
+	char key[sizeof(CACHE_SETTINGS_SUBTREE) + 4];
+	uint8_t dummy = 0;
+	int err;
+
+	for (size_t i = 0; i < CONFIG_BT_GATT_DM_CACHE_PEER_COUNT; i++) {
+		cache_key_get(key, sizeof(key), i);
+
+		/* An empty entry is not valid and frees the slot. */
+		err = settings_runtime_set(key, &dummy, 0);
+		zassert_equal(0, err, "Failed to clear cache slot %zu: %d", i, err);
+	}
+}
+
+static void cache_clear(void)
+{
+	char key[sizeof(CACHE_SETTINGS_SUBTREE) + 4];
+
+	cache_ram_clear();
+
+	for (size_t i = 0; i < CONFIG_BT_GATT_DM_CACHE_PEER_COUNT; i++) {
+		cache_key_get(key, sizeof(key), i);
+		(void)settings_delete(key);
+	}
+}
+
+/* Sets the cached results of the first slot, as if they were loaded from settings. */
+static void cache_entry_set(const void *data, size_t len)
+{
+	char key[sizeof(CACHE_SETTINGS_SUBTREE) + 4];
+	int err;
+
+	cache_key_get(key, sizeof(key), 0);
+
+	err = settings_runtime_set(key, data, len);
+	zassert_equal(0, err, "Failed to set cache entry: %d", err);
+}
+
+static void entry_init(struct net_buf_simple *buf, const uint8_t *hash)
+{
+	memset(&entry, 0, sizeof(entry));
+	bt_addr_le_copy(&entry.addr, &peer_addr);
+	entry.id = BT_ID_DEFAULT;
+	memcpy(entry.hash, hash, sizeof(entry.hash));
+
+	net_buf_simple_init_with_data(buf, entry.data, sizeof(entry.data));
+	net_buf_simple_reset(buf);
+}
+
+static void entry_set(struct net_buf_simple *buf)
+{
+	entry.len = buf->len;
+	cache_entry_set(&entry, offsetof(struct cache_entry, data) + entry.len);
+}
+
+static void uuid16_add(struct net_buf_simple *buf, uint16_t uuid)
+{
+	net_buf_simple_add_u8(buf, BT_UUID_SIZE_16);
+	net_buf_simple_add_le16(buf, uuid);
+}
+
+/* Adds the header of a record of the discovery of DIS, followed by the service attribute. */
+static uint8_t *dis_record_start(struct net_buf_simple *buf, uint16_t attr_cnt)
+{
+	uint8_t *hdr = net_buf_simple_add(buf, CACHE_RECORD_HDR_LEN);
+
+	sys_put_le16(1, &hdr[2]);
+	sys_put_le16(5, &hdr[4]);
+	sys_put_le16(attr_cnt, &hdr[6]);
+	uuid16_add(buf, BT_UUID_DIS_VAL);
+
+	net_buf_simple_add_le16(buf, 1);
+	net_buf_simple_add_u8(buf, 0);
+	uuid16_add(buf, BT_UUID_GATT_PRIMARY_VAL);
+	net_buf_simple_add_le16(buf, 5);
+	uuid16_add(buf, BT_UUID_DIS_VAL);
+
+	return hdr;
+}
+
+static void record_end(struct net_buf_simple *buf, uint8_t *hdr)
+{
+	sys_put_le16(net_buf_simple_tail(buf) - hdr, &hdr[0]);
+}
+
+static void desc_add(struct net_buf_simple *buf, uint16_t handle)
+{
+	net_buf_simple_add_le16(buf, handle);
+	net_buf_simple_add_u8(buf, 0);
+	uuid16_add(buf, BT_UUID_GATT_CUD_VAL);
+}
+
+static void attrs_verify(struct bt_gatt_dm *dm, const struct bt_gatt_attr *ref, size_t cnt)
+{
+	const struct bt_gatt_dm_attr *attr;
+
+	zassert_not_null(dm, "Service not found");
+	zassert_equal(cnt, bt_gatt_dm_attr_cnt(dm), "Expected %zu attributes, got %zu", cnt,
+		      bt_gatt_dm_attr_cnt(dm));
+
+	for (size_t i = 0; i < cnt; i++) {
+		attr = bt_gatt_dm_attr_by_handle(dm, ref[i].handle);
+		zassert_not_null(attr, "No attribute with handle %u", ref[i].handle);
+		zassert_false(bt_uuid_cmp(attr->uuid, ref[i].uuid), "Invalid UUID at handle %u",
+			      ref[i].handle);
+
+		if (!bt_uuid_cmp(ref[i].uuid, BT_UUID_GATT_PRIMARY)) {
+			const struct bt_gatt_service_val *ref_val = ref[i].user_data;
+			const struct bt_gatt_service_val *val = bt_gatt_dm_attr_service_val(attr);
+
+			zassert_not_null(val, "No service value at handle %u", ref[i].handle);
+			zassert_equal(ref_val->end_handle, val->end_handle, "Invalid end handle");
+			zassert_false(bt_uuid_cmp(ref_val->uuid, val->uuid), "Invalid service UUID");
+		} else if (!bt_uuid_cmp(ref[i].uuid, BT_UUID_GATT_CHRC)) {
+			const struct bt_gatt_chrc *ref_chrc = ref[i].user_data;
+			const struct bt_gatt_chrc *chrc = bt_gatt_dm_attr_chrc_val(attr);
+
+			zassert_not_null(chrc, "No characteristic value at handle %u",
+					 ref[i].handle);
+			zassert_equal(ref_chrc->properties, chrc->properties, "Invalid properties");
+			zassert_false(bt_uuid_cmp(ref_chrc->uuid, chrc->uuid),
+				      "Invalid characteristic UUID");
+		}
+	}
+}
+
+enum cache_result {
+	CACHE_HIT,
+	CACHE_MISS,
+	/* The discovery did not use the cache, as the peer is not bonded. */
+	CACHE_UNUSED,
+};
+
+/* Runs the discovery and checks whether it was served from the cache. */
+static void dm_verify(const struct bt_uuid *svc_uuid, enum cache_result result)
+{
+	struct bt_gatt_dm_cache_stats stats;
+	struct bt_gatt_dm *dm;
+	bool is_dis = !bt_uuid_cmp(svc_uuid, BT_UUID_DIS);
+
+	bt_gatt_discover_mock_setup(cache_sim, ARRAY_SIZE(cache_sim));
+	bt_gatt_dm_cache_stats_get(&stats_before);
+
+	dm = run_dm(svc_uuid);
+
+	if (is_dis) {
+		attrs_verify(dm, &cache_sim[0], DIS_ATTR_CNT);
+	} else {
+		attrs_verify(dm, &cache_sim[DIS_ATTR_CNT], HRS_ATTR_CNT);
+	}
+
+	bt_gatt_dm_data_release(dm);
+
+	bt_gatt_dm_cache_stats_get(&stats);
+
+	if (result == CACHE_HIT) {
+		zassert_equal(0, bt_gatt_discover_mock_call_count(),
+			      "Discovery done with the peer instead of the cache");
+	} else {
+		zassert_not_equal(0, bt_gatt_discover_mock_call_count(),
+				  "Discovery served from the cache");
+	}
+
+	zassert_equal(stats_before.hits + (result == CACHE_HIT), stats.hits,
+		      "Unexpected number of cache hits");
+	zassert_equal(stats_before.misses + (result == CACHE_MISS), stats.misses,
+		      "Unexpected number of cache misses");
+}
+
+static void *cache_setup(void)
+{
+	int err;
+
+	err = settings_subsys_init();
+	zassert_equal(0, err, "Failed to initialize settings: %d", err);
+
+	return NULL;
+}
+
+static void cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&discovery_finished);
+	bt_gatt_read_mock_setup(hash_a, sizeof(hash_a));
+	peer_set(1);
+	peer_bonded = true;
+
+	cache_clear();
+}
+
+static void cache_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	peer_bonded = false;
+}
+
+ZTEST_SUITE(gatt_dm_cache, NULL, cache_setup, cache_before, cache_after, NULL);
+
+/* Results are cached only for bonded peers. */
+ZTEST(gatt_dm_cache, test_cache_not_bonded)
+{
+	peer_bonded = false;
+
+	dm_verify(BT_UUID_DIS, CACHE_UNUSED);
+	dm_verify(BT_UUID_DIS, CACHE_UNUSED);
+}
+
+/* Results are stored in settings and restored from them. */
+ZTEST(gatt_dm_cache, test_cache_round_trip)
+{
+	int err;
+
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+	dm_verify(BT_UUID_HRS, CACHE_MISS);
+
+	/* Each discovery is a separate record. */
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+	dm_verify(BT_UUID_HRS, CACHE_HIT);
+
+	k_sleep(K_MSEC(CACHE_SAVE_TIMEOUT));
+
+	cache_ram_clear();
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+
+	cache_ram_clear();
+	err = settings_load_subtree(CACHE_SETTINGS_SUBTREE);
+	zassert_equal(0, err, "Failed to load the cache: %d", err);
+
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+	dm_verify(BT_UUID_HRS, CACHE_HIT);
+}
+
+/* A changed Database Hash makes the cached results stale. */
+ZTEST(gatt_dm_cache, test_cache_hash_mismatch)
+{
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+
+	bt_gatt_read_mock_setup(hash_b, sizeof(hash_b));
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+
+	/* Without the Database Hash, the results can neither be used nor cached. */
+	bt_gatt_read_mock_setup(NULL, 0);
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+
+	bt_gatt_read_mock_setup(hash_b, sizeof(hash_b));
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+
+	/* The hash is only valid with its full length. */
+	bt_gatt_read_mock_setup(hash_b, sizeof(hash_b) - 1);
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+}
+
+/* Entries that do not match the size they were stored with are ignored. */
+ZTEST(gatt_dm_cache, test_cache_truncated_entry)
+{
+	struct net_buf_simple buf;
+	struct bt_gatt_dm *dm;
+	uint8_t *hdr;
+
+	entry_init(&buf, hash_a);
+	hdr = dis_record_start(&buf, 1);
+	record_end(&buf, hdr);
+	entry.len = buf.len;
+
+	/* Shorter than the entry header */
+	cache_entry_set(&entry, offsetof(struct cache_entry, data) - 1);
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+
+	/* Shorter than the length of the records */
+	cache_clear();
+	cache_entry_set(&entry, offsetof(struct cache_entry, data) + entry.len - 1);
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+
+	/* The complete entry is used, it was not replaced by the corrupted ones. */
+	cache_clear();
+	cache_entry_set(&entry, offsetof(struct cache_entry, data) + entry.len);
+
+	bt_gatt_discover_mock_setup(cache_sim, ARRAY_SIZE(cache_sim));
+	dm = run_dm(BT_UUID_DIS);
+
+	attrs_verify(dm, &cache_sim[0], 1);
+	zassert_equal(0, bt_gatt_discover_mock_call_count(), "Cached record not used");
+	bt_gatt_dm_data_release(dm);
+}
+
+/* Corrupted records are dropped and the discovery is done with the peer. */
+ZTEST(gatt_dm_cache, test_cache_corrupted_record)
+{
+	struct net_buf_simple buf;
+	uint8_t *hdr;
+
+	/* Record longer than the entry */
+	entry_init(&buf, hash_a);
+	hdr = dis_record_start(&buf, 1);
+	sys_put_le16(buf.len + 1, &hdr[0]);
+	entry_set(&buf);
+
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+
+	/* Attribute with an invalid UUID length, after attributes that were loaded */
+	cache_clear();
+	entry_init(&buf, hash_a);
+	hdr = dis_record_start(&buf, 3);
+	desc_add(&buf, 2);
+	net_buf_simple_add_le16(&buf, 3);
+	net_buf_simple_add_u8(&buf, 0);
+	net_buf_simple_add_u8(&buf, 5);
+	net_buf_simple_add_mem(&buf, "\x01\x02\x03\x04\x05", 5);
+	record_end(&buf, hdr);
+	entry_set(&buf);
+
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+}
+
+/* A record that does not fit in the instance is loaded partially, the discovery is then done
+ * with the peer from an empty attribute list.
+ */
+ZTEST(gatt_dm_cache, test_cache_partial_load)
+{
+	struct net_buf_simple buf;
+	uint8_t *hdr;
+
+	entry_init(&buf, hash_a);
+	hdr = dis_record_start(&buf, CONFIG_BT_GATT_DM_MAX_ATTRS + 1);
+
+	for (uint16_t i = 0; i < CONFIG_BT_GATT_DM_MAX_ATTRS; i++) {
+		desc_add(&buf, 2 + i);
+	}
+
+	record_end(&buf, hdr);
+	entry_set(&buf);
+
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+}
+
+/* The least recently used peer is replaced when the cache is full. */
+ZTEST(gatt_dm_cache, test_cache_lru_eviction)
+{
+	BUILD_ASSERT(CONFIG_BT_GATT_DM_CACHE_PEER_COUNT == 2, "The test expects two peers");
+
+	peer_set(1);
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+
+	peer_set(2);
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+
+	/* Peer 1 becomes the most recently used one. */
+	peer_set(1);
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+
+	/* Peer 2 is replaced. */
+	peer_set(3);
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+
+	peer_set(1);
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+
+	peer_set(3);
+	dm_verify(BT_UUID_DIS, CACHE_HIT);
+
+	peer_set(2);
+	dm_verify(BT_UUID_DIS, CACHE_MISS);
+}
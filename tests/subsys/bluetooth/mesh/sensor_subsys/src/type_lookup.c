@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <bluetooth/mesh/properties.h>
+#include <bluetooth/mesh/sensor_types.h>
+#include <sensor.h> /* private header from the source folder */
+
+#define LOOKUP_ROUNDS 200
+
+static const struct bt_mesh_sensor_type *linear_type_get(uint16_t id)
+{
+	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+		if (type->id == id) {
+			return type;
+		}
+	}
+
+	return NULL;
+}
+
+static void status_add(struct net_buf_simple *buf, const struct bt_mesh_sensor_type *type,
+		       const int64_t *micro)
+{
+	struct bt_mesh_sensor_value values[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+
+	for (int i = 0; i < type->channel_count; i++) {
+		zassert_ok(bt_mesh_sensor_value_from_micro(type->channels[i].format, micro[i],
+							   &values[i]));
+	}
+
+	zassert_ok(sensor_status_id_encode(buf, sensor_value_len(type), type->id));
+	zassert_ok(sensor_value_encode(buf, type, values));
+}
+
+ZTEST(sensor_type_lookup_test, test_index_matches_section)
+{
+	STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+		zassert_equal(bt_mesh_sensor_type_get(type->id), linear_type_get(type->id),
+			      "Wrong type for 0x%04x", type->id);
+	}
+
+	zassert_is_null(bt_mesh_sensor_type_get(BT_MESH_PROP_ID_PROHIBITED));
+	zassert_is_null(bt_mesh_sensor_type_get(0xfffe));
+}
+
+ZTEST(sensor_type_lookup_test, test_lookup_throughput)
+{
+	uint64_t linear_cycles = 0;
+	uint64_t index_cycles = 0;
+	uint32_t lookups = 0;
+	uint32_t start;
+
+	for (int round = 0; round < LOOKUP_ROUNDS; round++) {
+		STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
+			start = k_cycle_get_32();
+			zassert_not_null(linear_type_get(type->id));
+			linear_cycles += k_cycle_get_32() - start;
+
+			start = k_cycle_get_32();
+			zassert_not_null(bt_mesh_sensor_type_get(type->id));
+			index_cycles += k_cycle_get_32() - start;
+
+			lookups++;
+		}
+	}
+
+	TC_PRINT("Sensor type lookups: %u\n", lookups);
+	TC_PRINT("Linear search: %llu cycles (%llu per lookup)\n", linear_cycles,
+		 linear_cycles / lookups);
+	TC_PRINT("bt_mesh_sensor_type_get(): %llu cycles (%llu per lookup)\n", index_cycles,
+		 index_cycles / lookups);
+}
+
+ZTEST(sensor_type_lookup_test, test_status_decode)
+{
+	struct bt_mesh_sensor_data sensors[3];
+	uint32_t count = ARRAY_SIZE(sensors);
+
+	NET_BUF_SIMPLE_DEFINE(buf, 64);
+
+	status_add(&buf, &bt_mesh_sensor_present_amb_temp, (int64_t[]){ 21500000 });
+	/* Sensor without data: */
+	zassert_ok(sensor_status_id_encode(&buf, 0, BT_MESH_PROP_ID_MOTION_SENSED));
+	status_add(&buf, &bt_mesh_sensor_people_count, (int64_t[]){ 42000000 });
+	/* Unknown sensor type: */
+	zassert_ok(sensor_status_id_encode(&buf, 2, 0xfffe));
+	net_buf_simple_add_le16(&buf, 0x1234);
+	status_add(&buf, &bt_mesh_sensor_rel_dev_runtime_in_a_generic_level_range,
+		   (int64_t[]){ 50000000, -100000000, 100000000 });
+
+	zassert_ok(bt_mesh_sensor_status_decode(&buf, sensors, &count));
+	zassert_equal(buf.len, 0);
+	zassert_equal(count, 3);
+	zassert_equal_ptr(sensors[0].type, &bt_mesh_sensor_present_amb_temp);
+	zassert_equal_ptr(sensors[1].type, &bt_mesh_sensor_people_count);
+	zassert_equal_ptr(sensors[2].type,
+			  &bt_mesh_sensor_rel_dev_runtime_in_a_generic_level_range);
+	zassert_equal_ptr(sensors[2].value[2].format, &bt_mesh_sensor_format_gen_lvl);
+}
+
+ZTEST(sensor_type_lookup_test, test_status_decode_truncated)
+{
+	struct bt_mesh_sensor_data sensors[1];
+	uint32_t count = ARRAY_SIZE(sensors);
+
+	NET_BUF_SIMPLE_DEFINE(buf, 64);
+
+	status_add(&buf, &bt_mesh_sensor_present_amb_temp, (int64_t[]){ 21500000 });
+	status_add(&buf, &bt_mesh_sensor_people_count, (int64_t[]){ 42000000 });
+
+	zassert_equal(bt_mesh_sensor_status_decode(&buf, sensors, &count), -ENOBUFS);
+	zassert_equal(count, 1);
+	zassert_equal_ptr(sensors[0].type, &bt_mesh_sensor_present_amb_temp);
+
+	/* Invalid length for a known type: */
+	count = ARRAY_SIZE(sensors);
+	net_buf_simple_reset(&buf);
+	zassert_ok(sensor_status_id_encode(&buf, 2, BT_MESH_PROP_ID_PRESENT_AMB_TEMP));
+	net_buf_simple_add_le16(&buf, 0);
+
+	zassert_equal(bt_mesh_sensor_status_decode(&buf, sensors, &count), -EMSGSIZE);
+}
+
+ZTEST_SUITE(sensor_type_lookup_test, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <mock_nrf_rpc_transport.h>
+#include <test_rpc_env.h>
+
+#include <bt_rpc_common.h>
+#include <bt_rpc_gatt_common.h>
+#include <bluetooth/bt_rpc.h>
+#include <nrf_rpc_cbor.h>
+
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+/* Index of the connection used by the tests, as encoded by the client. */
+#define CONN_INDEX 0x00
+
+/* Index of the notified attribute: the second attribute of the first service. */
+#define ATTR_INDEX 0x01
+
+#define NOTIFY_DATA 0x01, 0x02
+#define NOTIFY_LEN  2
+
+/* The host reuses the scratchpad for each notification of a batch. */
+#define NOTIFY_SCRATCHPAD_SIZE                                                                     \
+	(NRF_RPC_SCRATCHPAD_ALIGN(NOTIFY_LEN) + NRF_RPC_SCRATCHPAD_ALIGN(sizeof(struct bt_uuid_128)))
+
+/* Notification with no callback, user data or UUID, as encoded in a batch. */
+#define CBOR_NOTIFICATION                                                                          \
+	CONN_INDEX, ATTR_INDEX, NOTIFY_LEN, CBOR_BSTR(NOTIFY_LEN, NOTIFY_DATA), CBOR_NULL, 0x00,   \
+		CBOR_NULL
+
+static struct bt_gatt_attr test_attrs[] = {
+	{
+		.uuid = BT_UUID_GATT_PRIMARY,
+	},
+	{
+		.uuid = BT_UUID_GATT_CHRC,
+	},
+};
+
+static struct bt_gatt_service test_svc = BT_GATT_SERVICE(test_attrs);
+
+static struct bt_conn *test_conn;
+
+static void connected(struct bt_conn *conn, uint8_t err)
+{
+	zassert_ok(err);
+
+	test_conn = conn;
+}
+
+BT_CONN_CB_DEFINE(conn_callbacks) = {
+	.connected = connected,
+};
+
+static void nrf_rpc_err_handler(const struct nrf_rpc_err_report *report)
+{
+	zassert_ok(report->code);
+}
+
+static void *suite_setup(void)
+{
+	uint32_t svc_index;
+
+	/* Register the service on the client only, the host is not involved in the tests. */
+	zassert_ok(bt_rpc_gatt_add_service(&test_svc, &svc_index));
+	zassert_equal(svc_index, 0);
+
+	return NULL;
+}
+
+static void tc_setup(void *f)
+{
+	mock_nrf_rpc_tr_expect_add(RPC_INIT_REQ, RPC_INIT_RSP);
+	zassert_ok(nrf_rpc_init(nrf_rpc_err_handler));
+	mock_nrf_rpc_tr_expect_reset();
+
+	/* The connected callback forwarded by the host also clears the connection cache. */
+	test_conn = NULL;
+
+	mock_nrf_rpc_tr_expect_add(RPC_RSP(), NO_RSP);
+	mock_nrf_rpc_tr_receive(RPC_CMD(BT_CONN_CB_CONNECTED_CALL_RPC_CMD, CONN_INDEX, 0x00));
+	mock_nrf_rpc_tr_expect_done();
+
+	zassert_not_null(test_conn);
+}
+
+/* Test that the security level is cached until the security changed callback. */
+ZTEST(bt_rpc_client, test_conn_info_cache_invalidate)
+{
+	uint32_t hits;
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(BT_CONN_GET_SECURITY_RPC_CMD, CONN_INDEX),
+				   RPC_RSP(BT_SECURITY_L2));
+	zassert_equal(bt_conn_get_security(test_conn), BT_SECURITY_L2);
+	mock_nrf_rpc_tr_expect_done();
+
+	/* Served by the cache, without a command. */
+	hits = bt_rpc_conn_info_cache_hits();
+	zassert_equal(bt_conn_get_security(test_conn), BT_SECURITY_L2);
+	zassert_equal(bt_rpc_conn_info_cache_hits(), hits + 1);
+
+	mock_nrf_rpc_tr_expect_add(RPC_RSP(), NO_RSP);
+	mock_nrf_rpc_tr_receive(RPC_CMD(BT_CONN_CB_SECURITY_CHANGED_CALL_RPC_CMD, CONN_INDEX,
+					BT_SECURITY_L3, BT_SECURITY_ERR_SUCCESS));
+	mock_nrf_rpc_tr_expect_done();
+
+	/* The cache was invalidated, so the security level is requested from the host again. */
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(BT_CONN_GET_SECURITY_RPC_CMD, CONN_INDEX),
+				   RPC_RSP(BT_SECURITY_L3));
+	zassert_equal(bt_conn_get_security(test_conn), BT_SECURITY_L3);
+	mock_nrf_rpc_tr_expect_done();
+
+	zassert_equal(bt_rpc_conn_info_cache_hits(), hits + 1);
+}
+
+/* Test that the cache is invalidated when the connection is being terminated. */
+ZTEST(bt_rpc_client, test_conn_info_cache_disconnect)
+{
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(BT_CONN_ENC_KEY_SIZE_RPC_CMD, CONN_INDEX),
+				   RPC_RSP(0x10));
+	zassert_equal(bt_conn_enc_key_size(test_conn), 16);
+	mock_nrf_rpc_tr_expect_done();
+
+	mock_nrf_rpc_tr_expect_add(
+		RPC_CMD(BT_CONN_DISCONNECT_RPC_CMD, CONN_INDEX, BT_HCI_ERR_REMOTE_USER_TERM_CONN),
+		RPC_RSP(0x00));
+	zassert_ok(bt_conn_disconnect(test_conn, BT_HCI_ERR_REMOTE_USER_TERM_CONN));
+	mock_nrf_rpc_tr_expect_done();
+
+	/* The disconnection invalidated the cache, so the key size is requested again. */
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(BT_CONN_ENC_KEY_SIZE_RPC_CMD, CONN_INDEX),
+				   RPC_RSP(0x00));
+	zassert_equal(bt_conn_enc_key_size(test_conn), 0);
+	mock_nrf_rpc_tr_expect_done();
+}
+
+/* Test that queued notifications are sent in one command, holding a connection reference. */
+ZTEST(bt_rpc_client, test_notify_batch_flush)
+{
+	static const uint8_t data[] = {NOTIFY_DATA};
+	struct bt_gatt_notify_params params = {
+		.attr = &test_attrs[ATTR_INDEX],
+		.data = data,
+		.len = sizeof(data),
+	};
+	uint32_t notifications;
+	uint32_t batches;
+	uint32_t notifications_start;
+	uint32_t batches_start;
+
+	bt_rpc_gatt_notify_batch_stats(&notifications_start, &batches_start);
+
+	/* The first queued notification takes a reference to the connection on the host. */
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(BT_CONN_REMOTE_UPDATE_REF_RPC_CMD, CONN_INDEX, 0x01),
+				   RPC_RSP());
+	zassert_ok(bt_gatt_notify_cb(test_conn, &params));
+	zassert_ok(bt_gatt_notify_cb(test_conn, &params));
+	mock_nrf_rpc_tr_expect_done();
+
+	/* The connection is released once the batch has been sent. */
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(BT_GATT_NOTIFY_BATCH_RPC_CMD,
+					   CBOR_UINT8(NOTIFY_SCRATCHPAD_SIZE), 0x02,
+					   CBOR_NOTIFICATION, CBOR_NOTIFICATION),
+				   RPC_RSP(0x00));
+	mock_nrf_rpc_tr_expect_add(
+		RPC_CMD(BT_CONN_REMOTE_UPDATE_REF_RPC_CMD, CONN_INDEX, CBOR_INT(-1)), RPC_RSP());
+	zassert_ok(bt_rpc_gatt_notify_flush());
+	mock_nrf_rpc_tr_expect_done();
+
+	bt_rpc_gatt_notify_batch_stats(&notifications, &batches);
+	zassert_equal(notifications, notifications_start + 2);
+	zassert_equal(batches, batches_start + 1);
+
+	/* Nothing is sent when no notification is queued. */
+	zassert_ok(bt_rpc_gatt_notify_flush());
+	mock_nrf_rpc_tr_expect_done();
+
+	bt_rpc_gatt_notify_batch_stats(&notifications, &batches);
+	zassert_equal(batches, batches_start + 1);
+}
+
+ZTEST_SUITE(bt_rpc_client, NULL, suite_setup, tc_setup, NULL, NULL);
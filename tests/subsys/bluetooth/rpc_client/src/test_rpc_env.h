@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/sys/util_macro.h>
+
+/* Macros for constructing CBOR data items. */
+
+#define CBOR_NULL 0xf6
+
+/* for value bigger than 0x17 */
+#define CBOR_UINT8(value) 0x18, (value)
+/* for value between -0x18 and -1 */
+#define CBOR_INT(value)	  (0x20 | (-1 - (value)))
+#define CBOR_BSTR(len, ...) (0x40 | len) __VA_OPT__(,) __VA_ARGS__
+
+/* Macros for constructing nRF RPC packets for the Bluetooth command group. */
+
+#define RPC_PKT(bytes...)                                                                          \
+	(mock_nrf_rpc_pkt_t)                                                                       \
+	{                                                                                          \
+		.data = (uint8_t[]){bytes}, .len = sizeof((uint8_t[]){bytes}),                     \
+	}
+
+#define RPC_INIT_REQ                                                                               \
+	RPC_PKT(0x04, 0x00, 0xff, 0x00, 0xff, 0x00, 'b', 't', '_', 'r', 'p', 'c')
+#define RPC_INIT_RSP                                                                               \
+	RPC_PKT(0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 'b', 't', '_', 'r', 'p', 'c')
+#define RPC_CMD(cmd, ...) RPC_PKT(0x80, cmd, 0xff, 0x00, 0x00 __VA_OPT__(,) __VA_ARGS__, 0xf6)
+#define RPC_RSP(...)	  RPC_PKT(0x01, 0xff, 0x00, 0x00, 0x00 __VA_OPT__(,) __VA_ARGS__, 0xf6)
+#define NO_RSP		  RPC_PKT()
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <../subsys/bootloader/bl_validation/bl_validation_internal.h>
+
+#define NUM_MARKS 8
+#define MAX_BOOTS 4
+
+/* Simulated cache area, erased to 0xFF like flash. */
+static uint32_t area[(sizeof(struct bl_validation_cache_record) / sizeof(uint32_t)) + NUM_MARKS];
+static struct bl_validation_cache *const cache = (struct bl_validation_cache *)area;
+
+static struct bl_validation_cache_record expected;
+
+static void cache_erase(void)
+{
+	memset(area, 0xFF, sizeof(area));
+}
+
+static void cache_store(const struct bl_validation_cache_record *record)
+{
+	cache_erase();
+	cache->record = *record;
+	cache->record.committed = BL_VALIDATION_CACHE_COMMITTED;
+}
+
+static void boot_mark(void)
+{
+	cache->boot_marks[cache_boots_used(cache, NUM_MARKS)] = 0;
+}
+
+static enum bl_validation_cache_result check(bool tamper_detected)
+{
+	return cache_check(cache, NUM_MARKS, &expected, MAX_BOOTS, tamper_detected);
+}
+
+static void before_fn(void *f)
+{
+	ARG_UNUSED(f);
+
+	memset(&expected, 0, sizeof(expected));
+	expected.magic = BL_VALIDATION_CACHE_MAGIC;
+	expected.address = 0x8000;
+	expected.size = 0x20000;
+	expected.version = 3;
+	for (size_t i = 0; i < sizeof(expected.signature); i++) {
+		expected.signature[i] = i;
+	}
+
+	cache_erase();
+}
+
+ZTEST(bl_validation_cache_unittest, test_empty)
+{
+	zassert_false(cache_record_valid(&cache->record));
+	zassert_equal(cache_boots_used(cache, NUM_MARKS), 0);
+	zassert_equal(check(false), BL_VALIDATION_CACHE_MISS);
+}
+
+ZTEST(bl_validation_cache_unittest, test_hit)
+{
+	cache_store(&expected);
+
+	zassert_true(cache_record_valid(&cache->record));
+	zassert_equal(check(false), BL_VALIDATION_CACHE_HIT);
+}
+
+ZTEST(bl_validation_cache_unittest, test_torn_record)
+{
+	cache_store(&expected);
+	cache->record.committed = BL_VALIDATION_CACHE_ERASED;
+
+	zassert_equal(check(false), BL_VALIDATION_CACHE_MISS);
+}
+
+ZTEST(bl_validation_cache_unittest, test_mismatch)
+{
+	struct bl_validation_cache_record record;
+
+	record = expected;
+	record.version++;
+	cache_store(&record);
+	zassert_equal(check(false), BL_VALIDATION_CACHE_MISS, "Version not checked");
+
+	record = expected;
+	record.size--;
+	cache_store(&record);
+	zassert_equal(check(false), BL_VALIDATION_CACHE_MISS, "Size not checked");
+
+	record = expected;
+	record.address += 0x1000;
+	cache_store(&record);
+	zassert_equal(check(false), BL_VALIDATION_CACHE_MISS, "Address not checked");
+
+	record = expected;
+	record.signature[sizeof(record.signature) - 1] ^= 1;
+	cache_store(&record);
+	zassert_equal(check(false), BL_VALIDATION_CACHE_MISS, "Signature not checked");
+}
+
+ZTEST(bl_validation_cache_unittest, test_boot_limit)
+{
+	cache_store(&expected);
+
+	for (int i = 0; i < MAX_BOOTS; i++) {
+		zassert_equal(check(false), BL_VALIDATION_CACHE_HIT, "Boot %d", i);
+		boot_mark();
+	}
+
+	zassert_equal(cache_boots_used(cache, NUM_MARKS), MAX_BOOTS);
+	zassert_equal(check(false), BL_VALIDATION_CACHE_EXPIRED);
+
+	/* Storing the record after the full validation restarts the count. */
+	cache_store(&expected);
+	zassert_equal(check(false), BL_VALIDATION_CACHE_HIT);
+}
+
+ZTEST(bl_validation_cache_unittest, test_boot_marks_full)
+{
+	cache_store(&expected);
+
+	for (int i = 0; i < NUM_MARKS; i++) {
+		boot_mark();
+	}
+
+	zassert_equal(cache_boots_used(cache, NUM_MARKS), NUM_MARKS);
+	zassert_equal(cache_check(cache, NUM_MARKS, &expected, NUM_MARKS + 1, false),
+		      BL_VALIDATION_CACHE_EXPIRED, "Limit above the number of marks");
+}
+
+ZTEST(bl_validation_cache_unittest, test_tamper)
+{
+	cache_store(&expected);
+
+	zassert_equal(check(true), BL_VALIDATION_CACHE_EXPIRED);
+	zassert_equal(check(false), BL_VALIDATION_CACHE_HIT);
+}
+
+ZTEST_SUITE(bl_validation_cache_unittest, NULL, NULL, before_fn, NULL, NULL);
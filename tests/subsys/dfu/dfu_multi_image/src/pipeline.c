@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <dfu/dfu_multi_image.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+#define IMAGE_COUNT 3
+#define IMAGE_SIZE 4096
+#define CBOR_IMAGE_ENTRY_SIZE 13
+#define CBOR_HEADER_SIZE (6 + IMAGE_COUNT * CBOR_IMAGE_ENTRY_SIZE)
+#define HEADER_SIZE (sizeof(uint16_t) + CBOR_HEADER_SIZE)
+#define PACKAGE_SIZE (HEADER_SIZE + IMAGE_COUNT * IMAGE_SIZE)
+
+/* Simulated transport: time needed to receive a single chunk of the package. */
+#define CHUNK_SIZE 512
+#define CHUNK_RX_TIME_US 2000
+
+/* Simulated flash devices: programming time per byte differs between the targets. */
+static const uint32_t flash_write_time_ns[IMAGE_COUNT] = { 2000, 8000, 4000 };
+
+BUILD_ASSERT(IMAGE_COUNT <= CONFIG_DFU_MULTI_IMAGE_MAX_IMAGE_COUNT);
+
+struct sim_flash {
+	uint8_t data[IMAGE_SIZE];
+	size_t offset;
+	bool opened;
+	bool closed;
+	int fail_at_offset;
+};
+
+static struct sim_flash flash[IMAGE_COUNT];
+static struct sim_flash *cur_flash;
+static uint32_t cur_write_time_ns;
+static uint64_t flash_busy_us;
+
+static uint8_t package[PACKAGE_SIZE];
+
+static void package_build(void)
+{
+	uint8_t *p = package;
+
+	sys_put_le16(CBOR_HEADER_SIZE, p);
+	p += sizeof(uint16_t);
+
+	/* {"img": [{"id": i, "size": IMAGE_SIZE}, ...]} */
+	*p++ = 0xa1;
+	*p++ = 0x63;
+	memcpy(p, "img", 3);
+	p += 3;
+	*p++ = 0x80 | IMAGE_COUNT;
+
+	for (int i = 0; i < IMAGE_COUNT; i++) {
+		*p++ = 0xa2;
+		*p++ = 0x62;
+		memcpy(p, "id", 2);
+		p += 2;
+		*p++ = i;
+		*p++ = 0x64;
+		memcpy(p, "size", 4);
+		p += 4;
+		*p++ = 0x19;
+		sys_put_be16(IMAGE_SIZE, p);
+		p += sizeof(uint16_t);
+	}
+
+	zassert_equal(p - package, HEADER_SIZE, "Invalid header size");
+
+	for (size_t i = HEADER_SIZE; i < PACKAGE_SIZE; i++) {
+		package[i] = (uint8_t)(i * 7 + (i >> 8));
+	}
+}
+
+static int sim_flash_open(int image_id, size_t image_size)
+{
+	zassert_true(image_id >= 0 && image_id < IMAGE_COUNT, "Unexpected image id");
+	zassert_equal(image_size, IMAGE_SIZE, "Unexpected image size");
+
+	cur_flash = &flash[image_id];
+	cur_write_time_ns = flash_write_time_ns[image_id];
+	cur_flash->opened = true;
+
+	return 0;
+}
+
+static int sim_flash_write(const uint8_t *chunk, size_t chunk_size)
+{
+	uint32_t time_us = (uint32_t)((uint64_t)chunk_size * cur_write_time_ns / 1000);
+
+	if (cur_flash->fail_at_offset >= 0 &&
+	    cur_flash->offset + chunk_size > (size_t)cur_flash->fail_at_offset) {
+		return -EIO;
+	}
+
+	zassert_true(cur_flash->offset + chunk_size <= IMAGE_SIZE, "Too large image written");
+	memcpy(cur_flash->data + cur_flash->offset, chunk, chunk_size);
+	cur_flash->offset += chunk_size;
+
+	/* The flash is busy, but the CPU is free for the transport */
+	k_sleep(K_USEC(time_us));
+	flash_busy_us += time_us;
+
+	return 0;
+}
+
+static int sim_flash_close(int image_id, bool success)
+{
+	zassert_equal_ptr(cur_flash, &flash[image_id], "Image %d closed but not opened", image_id);
+	cur_flash->closed = success;
+
+	return 0;
+}
+
+#define SIM_FLASH_CLOSE_DEFINE(i, _)                                                               \
+	static int sim_flash_close_##i(bool success)                                               \
+	{                                                                                          \
+		return sim_flash_close(i, success);                                                \
+	}
+
+LISTIFY(IMAGE_COUNT, SIM_FLASH_CLOSE_DEFINE, ())
+
+#define SIM_FLASH_CLOSE_REF(i, _) sim_flash_close_##i
+
+/* Each image has its own close callback to verify which writer is closed */
+static int (*const sim_flash_close_cb[IMAGE_COUNT])(bool success) = {
+	LISTIFY(IMAGE_COUNT, SIM_FLASH_CLOSE_REF, (,))
+};
+
+#ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
+static int sim_flash_offset(size_t *offset)
+{
+	*offset = cur_flash->offset;
+
+	return 0;
+}
+#endif
+
+static void writers_register(void)
+{
+	static uint8_t buffer[64];
+
+	zassert_ok(dfu_multi_image_init(buffer, sizeof(buffer)), "DFU init failed");
+
+	for (int i = 0; i < IMAGE_COUNT; i++) {
+		struct dfu_image_writer writer = {
+			.image_id = i,
+			.open = sim_flash_open,
+			.write = sim_flash_write,
+			.close = sim_flash_close_cb[i],
+		};
+#ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
+		writer.offset = sim_flash_offset;
+#endif
+
+		zassert_ok(dfu_multi_image_register_writer(&writer), "Register failed");
+	}
+}
+
+/* Simulate receiving the package in chunks and passing them to the DFU Multi Image library. */
+static int package_download(size_t package_size)
+{
+	int err;
+
+	for (size_t offset = 0; offset < package_size; offset += CHUNK_SIZE) {
+		k_sleep(K_USEC(CHUNK_RX_TIME_US));
+
+		err = dfu_multi_image_write(offset, package + offset,
+					    MIN(CHUNK_SIZE, package_size - offset));
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(flash, 0, sizeof(flash));
+	for (int i = 0; i < IMAGE_COUNT; i++) {
+		flash[i].fail_at_offset = -1;
+	}
+	flash_busy_us = 0;
+	package_build();
+	writers_register();
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)dfu_multi_image_reset();
+}
+
+ZTEST(dfu_multi_image_pipeline_test, test_update_time)
+{
+	const uint64_t rx_time_us = DIV_ROUND_UP(PACKAGE_SIZE, CHUNK_SIZE) * CHUNK_RX_TIME_US;
+	int64_t start;
+	int64_t total_us;
+
+	start = k_uptime_ticks();
+	zassert_ok(package_download(PACKAGE_SIZE), "DFU write failed");
+	zassert_ok(dfu_multi_image_done(true), "DFU done failed");
+	total_us = k_ticks_to_us_ceil64(k_uptime_ticks() - start);
+
+	for (int i = 0; i < IMAGE_COUNT; i++) {
+		zassert_true(flash[i].closed, "Image %d not completed", i);
+		zassert_mem_equal(flash[i].data, package + HEADER_SIZE + i * IMAGE_SIZE,
+				  IMAGE_SIZE, "Invalid content of image %d", i);
+	}
+
+	TC_PRINT("Package: %zu bytes, %d images\n", PACKAGE_SIZE, IMAGE_COUNT);
+	TC_PRINT("Transport time: %llu us, flash write time: %llu us\n", rx_time_us,
+		 flash_busy_us);
+	TC_PRINT("Total update time: %lld us (sequential: %llu us)\n", total_us,
+		 rx_time_us + flash_busy_us);
+
+	/* Writing overlaps with receiving, so the update is shorter than the sum of both */
+	zassert_true(total_us < rx_time_us + flash_busy_us, "No overlap of transport and writes");
+}
+
+ZTEST(dfu_multi_image_pipeline_test, test_writer_error)
+{
+	int err;
+
+	flash[1].fail_at_offset = IMAGE_SIZE / 2;
+
+	err = package_download(PACKAGE_SIZE);
+	if (err == 0) {
+		/* The failure happened after the last chunk was queued */
+		err = dfu_multi_image_done(true);
+	} else {
+		zassert_equal(dfu_multi_image_done(false), err, "Writer error not reported");
+	}
+
+	zassert_equal(err, -EIO, "Writer error not reported");
+	zassert_true(flash[0].closed, "First image not completed");
+	zassert_false(flash[1].closed, "Failed image completed");
+	zassert_false(flash[2].opened, "Image after the failed one written");
+}
+
+ZTEST(dfu_multi_image_pipeline_test, test_writer_error_last_chunk)
+{
+	int err;
+
+	/* The failed write does not advance the writing to the next image */
+	flash[1].fail_at_offset = IMAGE_SIZE - 1;
+
+	err = package_download(PACKAGE_SIZE);
+	if (err == 0) {
+		err = dfu_multi_image_done(true);
+	} else {
+		zassert_equal(dfu_multi_image_done(false), err, "Writer error not reported");
+	}
+
+	zassert_equal(err, -EIO, "Writer error not reported");
+	zassert_true(flash[0].closed, "First image not completed");
+	zassert_false(flash[1].closed, "Failed image completed");
+	zassert_false(flash[2].opened, "Image after the failed one written");
+}
+
+ZTEST(dfu_multi_image_pipeline_test, test_offset)
+{
+	const size_t size = HEADER_SIZE + IMAGE_SIZE + CHUNK_SIZE;
+
+	zassert_ok(package_download(size), "DFU write failed");
+
+	/* The accepted offset is reported before the data reaches the flash */
+	zassert_equal(dfu_multi_image_offset(), size, "Invalid offset");
+
+	/* Reset waits for the buffered data */
+	zassert_ok(dfu_multi_image_reset(), "DFU reset failed");
+	zassert_true(flash[0].closed, "First image not completed");
+	zassert_equal(flash[1].offset, size - HEADER_SIZE - IMAGE_SIZE,
+		      "Buffered data not written");
+}
+
+ZTEST_SUITE(dfu_multi_image_pipeline_test, NULL, NULL, before, after, NULL);
@@ -5,6 +5,7 @@
  */
 #include <unity.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <zephyr/kernel.h>
 #include <string.h>
 #include <zephyr/init.h>
@@ -33,6 +34,10 @@
 #define TEST_PAYLOAD		"This is a test payload"
 #define TEST_PAYLOAD_LEN	(sizeof(TEST_PAYLOAD) - 1)
 
+#define TEST_TOPIC_3		"test/topic_3"
+
+#define TEST_CHUNKED_PAYLOAD_LEN	(2 * CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN + 10)
+
 /* Pull in variables and functions from the MQTT helper library. */
 extern struct mqtt_client mqtt_client;
 extern enum mqtt_state mqtt_state;
@@ -50,6 +55,7 @@ extern void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 extern void mqtt_helper_poll_loop(void);
 extern void on_publish(const struct mqtt_evt *mqtt_evt);
 extern char payload_buf[];
+extern bool mqtt_helper_queue_is_empty(void);
 
 /* Fake addrinfo entries returned from the mocked zsock_getaddrinfo(). */
 static struct net_sockaddr_in test_sockaddr_in = {
@@ -71,6 +77,16 @@ static K_SEM_DEFINE(suback_sem, 0, 1);
 static K_SEM_DEFINE(publish_sem, 0, 1);
 static K_SEM_DEFINE(error_msg_size_sem, 0, 1);
 
+/* Number of payload bytes delivered through the chunk callback. */
+static size_t chunked_payload_received;
+
+/* Messages published from the store-and-forward queue. */
+#define QUEUE_PUBLISHED_MAX 4
+static uint16_t queue_published_id[QUEUE_PUBLISHED_MAX];
+static char queue_published_topic[QUEUE_PUBLISHED_MAX][32];
+static char queue_published_payload[QUEUE_PUBLISHED_MAX][32];
+static size_t queue_published_count;
+
 void setUp(void)
 {
 	__cmock_mqtt_keepalive_time_left_IgnoreAndReturn(0);
@@ -96,6 +112,44 @@ static int mqtt_readall_publish_payload_stub(struct mqtt_client *client, uint8_t
 	return 0;
 }
 
+/* Fill the buffer with a pattern based on the offset of each byte within the payload. */
+static int mqtt_readall_publish_payload_chunk_stub(struct mqtt_client *client, uint8_t *buffer,
+						   size_t length, int num_calls)
+{
+	size_t offset = num_calls * CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN;
+
+	TEST_ASSERT_EQUAL(MIN(TEST_CHUNKED_PAYLOAD_LEN - offset,
+			      CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN), length);
+
+	for (size_t i = 0; i < length; i++) {
+		buffer[i] = (uint8_t)(offset + i);
+	}
+
+	return 0;
+}
+
+static int mqtt_publish_queue_stub(struct mqtt_client *client,
+				   const struct mqtt_publish_param *param, int num_calls)
+{
+	size_t i = queue_published_count;
+	const struct mqtt_utf8 *topic = &param->message.topic.topic;
+	const struct mqtt_binstr *payload = &param->message.payload;
+
+	TEST_ASSERT_LESS_THAN(QUEUE_PUBLISHED_MAX, i);
+	TEST_ASSERT_EQUAL(MQTT_QOS_1_AT_LEAST_ONCE, param->message.topic.qos);
+	TEST_ASSERT_NOT_EQUAL(0, param->message_id);
+
+	queue_published_id[i] = param->message_id;
+	snprintf(queue_published_topic[i], sizeof(queue_published_topic[i]), "%.*s",
+		 (int)topic->size, (const char *)topic->utf8);
+	snprintf(queue_published_payload[i], sizeof(queue_published_payload[i]), "%.*s",
+		 (int)payload->len, (const char *)payload->data);
+
+	queue_published_count++;
+
+	return 0;
+}
+
 static int poll_stub_pollin(struct zsock_pollfd *fds, int nfds, int timeout, int num_calls)
 {
 	fds[0].revents = fds[0].events & ZSOCK_POLLIN;
@@ -196,6 +250,26 @@ static void cb_on_publish(struct mqtt_helper_buf topic, struct mqtt_helper_buf p
 	k_sem_give(&publish_sem);
 }
 
+static void cb_on_publish_chunk(struct mqtt_helper_buf topic, struct mqtt_helper_buf chunk,
+				size_t offset, size_t total_len)
+{
+	TEST_ASSERT_EQUAL(TEST_TOPIC_1_LEN, topic.size);
+	TEST_ASSERT_EQUAL_MEMORY(TEST_TOPIC_1, topic.ptr, TEST_TOPIC_1_LEN);
+	TEST_ASSERT_EQUAL(TEST_CHUNKED_PAYLOAD_LEN, total_len);
+	TEST_ASSERT_EQUAL(chunked_payload_received, offset);
+	TEST_ASSERT_LESS_OR_EQUAL(CONFIG_MQTT_HELPER_PAYLOAD_BUFFER_LEN, chunk.size);
+
+	for (size_t i = 0; i < chunk.size; i++) {
+		TEST_ASSERT_EQUAL_UINT8((uint8_t)(offset + i), chunk.ptr[i]);
+	}
+
+	chunked_payload_received += chunk.size;
+
+	if (chunked_payload_received == total_len) {
+		k_sem_give(&publish_sem);
+	}
+}
+
 static void cb_on_connack(enum mqtt_conn_return_code return_code, bool session_present)
 {
 	switch (return_code) {
@@ -238,6 +312,60 @@ static void cb_on_error(enum mqtt_helper_error error)
 	}
 }
 
+static int queue_publish_with_id(const char *topic, const char *payload, uint16_t message_id)
+{
+	struct mqtt_publish_param pub_param = {
+		.message = {
+			.payload = {
+				.data = (uint8_t *)payload,
+				.len = strlen(payload),
+			},
+			.topic = {
+				.topic = {
+					.utf8 = (const uint8_t *)topic,
+					.size = strlen(topic),
+				},
+				.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+			},
+		},
+		.message_id = message_id,
+	};
+
+	return mqtt_helper_publish(&pub_param);
+}
+
+static int queue_publish(const char *topic, const char *payload)
+{
+	return queue_publish_with_id(topic, payload, mqtt_helper_msg_id_get());
+}
+
+static void queue_test_init(void)
+{
+	struct mqtt_helper_cfg cfg = {
+		.cb = {
+			.on_connack = cb_on_connack,
+			.on_disconnect = cb_on_disconnect,
+			.on_puback = cb_on_puback,
+			.on_error = cb_on_error,
+		},
+	};
+
+	__cmock_mqtt_client_init_Expect(&mqtt_client);
+	TEST_ASSERT_EQUAL(0, mqtt_helper_init(&cfg));
+
+	__cmock_mqtt_publish_Stub(mqtt_publish_queue_stub);
+	queue_published_count = 0;
+}
+
+static void queue_connack_send(void)
+{
+	mqtt_state = MQTT_STATE_CONNECTING;
+
+	send_mqtt_event(MQTT_EVT_CONNACK, MQTT_CONNECTION_ACCEPTED);
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&connack_success_sem, K_SECONDS(1)));
+}
+
 /* Tests */
 
 void test_mqtt_helper_init_when_unitialized(void)
@@ -300,6 +428,8 @@ void test_mqtt_helper_connect_when_disconnected(void)
 
 	TEST_ASSERT_EQUAL(0, mqtt_helper_connect(&conn_params));
 	TEST_ASSERT_EQUAL(MQTT_STATE_CONNECTING, mqtt_state_get());
+	TEST_ASSERT_EQUAL(ZSOCK_TLS_SESSION_CACHE_ENABLED,
+			  mqtt_client.transport.tls.config.session_cache);
 }
 
 void test_mqtt_helper_connect_when_disconnected_mqtt_api_error(void)
@@ -640,6 +770,209 @@ void test_mqtt_helper_msg_id_get_returns_valid_ids(void)
 	TEST_ASSERT_EQUAL(1, mqtt_helper_msg_id_get());
 }
 
+/* The test verifies that a payload larger than the payload buffer is delivered in order
+ * through the chunk callback, and that the message is acknowledged once.
+ */
+void test_on_publish_chunked(void)
+{
+	struct mqtt_helper_cfg cfg = {
+		.cb = {
+			.on_publish_chunk = cb_on_publish_chunk,
+			.on_error = cb_on_error,
+		},
+	};
+	struct mqtt_evt evt = {
+		.type = MQTT_EVT_PUBLISH,
+		.param.publish = {
+			.message_id = TEST_MESSAGE_ID,
+			.message = {
+				.topic = {
+					.topic = {
+						.utf8 = TEST_TOPIC_1,
+						.size = TEST_TOPIC_1_LEN,
+					},
+					.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+				},
+				.payload = {
+					.len = TEST_CHUNKED_PAYLOAD_LEN,
+				},
+			},
+		},
+	};
+
+	__cmock_mqtt_client_init_Expect(&mqtt_client);
+	TEST_ASSERT_EQUAL(0, mqtt_helper_init(&cfg));
+
+	__cmock_mqtt_readall_publish_payload_Stub(mqtt_readall_publish_payload_chunk_stub);
+	__cmock_mqtt_publish_qos1_ack_ExpectAnyArgsAndReturn(0);
+
+	chunked_payload_received = 0;
+	mqtt_state = MQTT_STATE_CONNECTED;
+
+	mqtt_evt_handler(&mqtt_client, &evt);
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&publish_sem, K_SECONDS(1)));
+	TEST_ASSERT_EQUAL(TEST_CHUNKED_PAYLOAD_LEN, chunked_payload_received);
+	TEST_ASSERT_NOT_EQUAL(0, k_sem_take(&error_msg_size_sem, K_NO_WAIT));
+}
+
+/* The test verifies that QoS 1 messages published while disconnected are queued and
+ * published after CONNACK with their message IDs, and that their PUBACKs are passed to the
+ * application.
+ */
+void test_queue_publish_when_disconnected(void)
+{
+	struct mqtt_helper_queue_stats before;
+	struct mqtt_helper_queue_stats after;
+
+	queue_test_init();
+	mqtt_helper_queue_stats_get(&before);
+	k_sem_reset(&puback_sem);
+
+	TEST_ASSERT_EQUAL(0, queue_publish_with_id(TEST_TOPIC_1, "first", TEST_MESSAGE_ID));
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_2, "second"));
+
+	mqtt_helper_queue_stats_get(&after);
+	TEST_ASSERT_EQUAL(2, after.depth);
+	TEST_ASSERT_EQUAL(before.queued + 2, after.queued);
+	TEST_ASSERT_EQUAL(0, queue_published_count);
+
+	queue_connack_send();
+
+	TEST_ASSERT_EQUAL(2, queue_published_count);
+	TEST_ASSERT_EQUAL_STRING(TEST_TOPIC_1, queue_published_topic[0]);
+	TEST_ASSERT_EQUAL_STRING("first", queue_published_payload[0]);
+	TEST_ASSERT_EQUAL_STRING(TEST_TOPIC_2, queue_published_topic[1]);
+	TEST_ASSERT_EQUAL_STRING("second", queue_published_payload[1]);
+	TEST_ASSERT_EQUAL(TEST_MESSAGE_ID, queue_published_id[0]);
+
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[0]);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&puback_sem, K_SECONDS(1)));
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[1]);
+
+	mqtt_helper_queue_stats_get(&after);
+	TEST_ASSERT_EQUAL(0, after.depth);
+	TEST_ASSERT_EQUAL(0, after.oldest_age_ms);
+	TEST_ASSERT_EQUAL(before.drained + 2, after.drained);
+	TEST_ASSERT_NOT_EQUAL(0, after.drain_rate);
+	TEST_ASSERT_EQUAL(2, queue_published_count);
+}
+
+/* The test verifies that a queued message is replaced by a newer message on the same topic. */
+void test_queue_coalesce(void)
+{
+	struct mqtt_helper_queue_stats before;
+	struct mqtt_helper_queue_stats after;
+
+	queue_test_init();
+	mqtt_helper_queue_stats_get(&before);
+
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_1, "old"));
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_1, "new"));
+
+	mqtt_helper_queue_stats_get(&after);
+	TEST_ASSERT_EQUAL(1, after.depth);
+	TEST_ASSERT_EQUAL(before.coalesced + 1, after.coalesced);
+
+	queue_connack_send();
+
+	TEST_ASSERT_EQUAL(1, queue_published_count);
+	TEST_ASSERT_EQUAL_STRING("new", queue_published_payload[0]);
+
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[0]);
+	TEST_ASSERT_TRUE(mqtt_helper_queue_is_empty());
+}
+
+/* The test verifies that messages are rejected when the queue is full, and that the queue is
+ * drained in bursts of CONFIG_MQTT_HELPER_QUEUE_DRAIN_BURST messages.
+ */
+void test_queue_full_and_burst_drain(void)
+{
+	struct mqtt_helper_queue_stats before;
+	struct mqtt_helper_queue_stats after;
+
+	queue_test_init();
+	mqtt_helper_queue_stats_get(&before);
+
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_1, "1"));
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_2, "2"));
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_3, "3"));
+	TEST_ASSERT_EQUAL(-ENOMEM, queue_publish("test/topic_4", "4"));
+
+	mqtt_helper_queue_stats_get(&after);
+	TEST_ASSERT_EQUAL(CONFIG_MQTT_HELPER_QUEUE_MAX_ENTRIES, after.depth);
+	TEST_ASSERT_EQUAL(before.dropped + 1, after.dropped);
+
+	queue_connack_send();
+	TEST_ASSERT_EQUAL(CONFIG_MQTT_HELPER_QUEUE_DRAIN_BURST, queue_published_count);
+
+	/* The next burst is published only when the whole burst is acknowledged. */
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[0]);
+	TEST_ASSERT_EQUAL(2, queue_published_count);
+
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[1]);
+	TEST_ASSERT_EQUAL(3, queue_published_count);
+	TEST_ASSERT_EQUAL_STRING(TEST_TOPIC_3, queue_published_topic[2]);
+
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[2]);
+	TEST_ASSERT_TRUE(mqtt_helper_queue_is_empty());
+}
+
+/* The test verifies that a message that is in flight when the connection is lost stays in the
+ * queue and is published again with the same message ID after reconnecting.
+ */
+void test_queue_in_flight_republished_after_reconnect(void)
+{
+	queue_test_init();
+
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_1, TEST_PAYLOAD));
+
+	queue_connack_send();
+	TEST_ASSERT_EQUAL(1, queue_published_count);
+
+	send_mqtt_event(MQTT_EVT_DISCONNECT, 0);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&disconnect_sem, K_SECONDS(1)));
+	TEST_ASSERT_FALSE(mqtt_helper_queue_is_empty());
+
+	queue_connack_send();
+	TEST_ASSERT_EQUAL(2, queue_published_count);
+	TEST_ASSERT_EQUAL_STRING(TEST_PAYLOAD, queue_published_payload[1]);
+	TEST_ASSERT_EQUAL(queue_published_id[0], queue_published_id[1]);
+
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[1]);
+	TEST_ASSERT_TRUE(mqtt_helper_queue_is_empty());
+}
+
+/* The test verifies that QoS 1 messages published while connected are queued when older
+ * messages are still in the queue, so that the order of the messages is kept.
+ */
+void test_queue_keeps_order_while_draining(void)
+{
+	queue_test_init();
+
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_1, "1"));
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_2, "2"));
+	TEST_ASSERT_EQUAL(0, queue_publish(TEST_TOPIC_3, "3"));
+
+	queue_connack_send();
+	TEST_ASSERT_EQUAL(2, queue_published_count);
+
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[0]);
+
+	/* Queued behind message "3", which has not been published yet. */
+	TEST_ASSERT_EQUAL(0, queue_publish("test/topic_4", "4"));
+	TEST_ASSERT_EQUAL(2, queue_published_count);
+
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[1]);
+	TEST_ASSERT_EQUAL(4, queue_published_count);
+	TEST_ASSERT_EQUAL_STRING("3", queue_published_payload[2]);
+	TEST_ASSERT_EQUAL_STRING("4", queue_published_payload[3]);
+
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[2]);
+	send_mqtt_event(MQTT_EVT_PUBACK, queue_published_id[3]);
+	TEST_ASSERT_TRUE(mqtt_helper_queue_is_empty());
+}
+
 int main(void)
 {
 	(void)unity_main();
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "mocks.h"
+
+#include <mock_nrf_rpc_transport.h>
+#include <net/ot_rpc.h>
+#include <ot_rpc_ids.h>
+#include <ot_rpc_types.h>
+#include <test_rpc_env.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <openthread/message.h>
+#include <openthread/udp.h>
+
+/* Staging buffer size set in prj.conf */
+#define STAGING_SIZE CONFIG_OPENTHREAD_RPC_CLIENT_MESSAGE_STAGING_SIZE
+
+static const otMessageInfo message_info = {
+	.mSockAddr = {.mFields.m8 = {ADDR_1}},
+	.mPeerAddr = {.mFields.m8 = {ADDR_2}},
+	.mSockPort = PORT_1,
+	.mPeerPort = PORT_2,
+	.mHopLimit = HOP_LIMIT,
+	.mEcn = 3,
+	.mIsHostInterface = true,
+	.mAllowZeroHopLimit = true,
+	.mMulticastLoop = true,
+};
+
+static void nrf_rpc_err_handler(const struct nrf_rpc_err_report *report)
+{
+	zassert_ok(report->code);
+}
+
+static void tc_setup(void *f)
+{
+	mock_nrf_rpc_tr_expect_add(RPC_INIT_REQ, RPC_INIT_RSP);
+	zassert_ok(nrf_rpc_init(nrf_rpc_err_handler));
+	mock_nrf_rpc_tr_expect_reset();
+}
+
+static void tc_clean(void *f)
+{
+	mock_nrf_rpc_tr_expect_reset();
+}
+
+static otMessage *new_message(void)
+{
+	otMessage *msg;
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_UDP_NEW_MESSAGE, CBOR_NULL),
+				   RPC_RSP(RESOURCE_TABLE_KEY));
+	msg = otUdpNewMessage(NULL, NULL);
+	mock_nrf_rpc_tr_expect_done();
+
+	zassert_equal(msg, (otMessage *)RESOURCE_TABLE_KEY);
+
+	return msg;
+}
+
+/*
+ * Test that the data appended to a new UDP message is kept locally and passed to the RPC server
+ * together with the otUdpSend() command.
+ */
+ZTEST(ot_rpc_message, test_staged_append_and_send)
+{
+	otUdpSocket socket;
+	otMessage *msg;
+	uint32_t round_trips;
+	uint8_t buf[4];
+
+	round_trips = ot_rpc_get_message_round_trips();
+	msg = new_message();
+
+	zassert_ok(otMessageAppend(msg, "abc", 3));
+	zassert_ok(otMessageAppend(msg, "de", 2));
+	zassert_equal(otMessageGetLength(msg), 5);
+	zassert_equal(otMessageGetOffset(msg), 0);
+	zassert_equal(otMessageRead(msg, 1, buf, sizeof(buf)), 4);
+	zassert_mem_equal(buf, "bcde", 4);
+	zassert_equal(otMessageRead(msg, 5, buf, sizeof(buf)), 0);
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_UDP_SEND_WITH_DATA,
+					   CBOR_UINT32((ot_socket_key)&socket), RESOURCE_TABLE_KEY,
+					   CBOR_BSTR(5, 'a', 'b', 'c', 'd', 'e'), CBOR_MSG_INFO),
+				   RPC_RSP(OT_ERROR_NONE));
+	zassert_ok(otUdpSend(NULL, &socket, msg, &message_info));
+	mock_nrf_rpc_tr_expect_done();
+
+	zassert_equal(ot_rpc_get_message_round_trips() - round_trips, 2);
+}
+
+/*
+ * Test that a staged message without data is sent with the regular otUdpSend() command.
+ */
+ZTEST(ot_rpc_message, test_staged_send_empty)
+{
+	otUdpSocket socket;
+	otMessage *msg;
+
+	msg = new_message();
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_UDP_SEND, CBOR_UINT32((ot_socket_key)&socket),
+					   RESOURCE_TABLE_KEY, CBOR_MSG_INFO),
+				   RPC_RSP(OT_ERROR_NONE));
+	zassert_ok(otUdpSend(NULL, &socket, msg, &message_info));
+	mock_nrf_rpc_tr_expect_done();
+}
+
+/*
+ * Test that the staged data is passed to the RPC server when the staging buffer is full and
+ * before reading the data that is partially staged, and that the message is no longer staged
+ * after it is freed.
+ */
+ZTEST(ot_rpc_message, test_staged_flush_and_free)
+{
+	otMessage *msg;
+	uint8_t buf[STAGING_SIZE];
+
+	msg = new_message();
+
+	memset(buf, 'a', sizeof(buf));
+	zassert_ok(otMessageAppend(msg, buf, 10));
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_MESSAGE_APPEND, RESOURCE_TABLE_KEY,
+					   CBOR_BSTR(10, STR_SEQUENCE(10))),
+				   RPC_RSP(OT_ERROR_NONE));
+	zassert_ok(otMessageAppend(msg, buf, 10));
+	mock_nrf_rpc_tr_expect_done();
+
+	zassert_equal(otMessageGetLength(msg), 20);
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_MESSAGE_APPEND, RESOURCE_TABLE_KEY,
+					   CBOR_BSTR(10, STR_SEQUENCE(10))),
+				   RPC_RSP(OT_ERROR_NONE));
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_MESSAGE_READ, RESOURCE_TABLE_KEY, 5, 10),
+				   RPC_RSP(CBOR_BSTR(10, STR_SEQUENCE(10))));
+	zassert_equal(otMessageRead(msg, 5, buf, 10), 10);
+	mock_nrf_rpc_tr_expect_done();
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_MESSAGE_FREE, RESOURCE_TABLE_KEY), RPC_RSP());
+	otMessageFree(msg);
+	mock_nrf_rpc_tr_expect_done();
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_MESSAGE_GET_LENGTH, RESOURCE_TABLE_KEY),
+				   RPC_RSP(0));
+	zassert_equal(otMessageGetLength(msg), 0);
+	mock_nrf_rpc_tr_expect_done();
+}
+
+/*
+ * Test that the staged data is kept if passing it to the RPC server fails, and is sent later.
+ */
+ZTEST(ot_rpc_message, test_staged_flush_failure)
+{
+	otUdpSocket socket;
+	otMessage *msg;
+	uint8_t buf[STAGING_SIZE];
+
+	msg = new_message();
+
+	memset(buf, 'a', sizeof(buf));
+	zassert_ok(otMessageAppend(msg, buf, 10));
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_MESSAGE_APPEND, RESOURCE_TABLE_KEY,
+					   CBOR_BSTR(10, STR_SEQUENCE(10))),
+				   RPC_RSP(OT_ERROR_NO_BUFS));
+	zassert_equal(otMessageAppend(msg, buf, 10), OT_ERROR_NO_BUFS);
+	mock_nrf_rpc_tr_expect_done();
+
+	zassert_equal(otMessageGetLength(msg), 10);
+
+	mock_nrf_rpc_tr_expect_add(RPC_CMD(OT_RPC_CMD_UDP_SEND_WITH_DATA,
+					   CBOR_UINT32((ot_socket_key)&socket), RESOURCE_TABLE_KEY,
+					   CBOR_BSTR(10, STR_SEQUENCE(10)), CBOR_MSG_INFO),
+				   RPC_RSP(OT_ERROR_NONE));
+	zassert_ok(otUdpSend(NULL, &socket, msg, &message_info));
+	mock_nrf_rpc_tr_expect_done();
+}
+
+ZTEST_SUITE(ot_rpc_message, NULL, NULL, tc_setup, tc_clean, NULL);
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <nfc/ndef/msg.h>
+#include <nfc/ndef/msg_parser.h>
+#include <nfc/ndef/msg_view.h>
+#include <nfc/ndef/record.h>
+
+#define MSG_BUF_SIZE	  1024
+#define MULTI_REC_COUNT	  8
+#define BENCH_ITERATIONS  1000
+#define PARSER_MAX_RECORDS 10
+
+static const uint8_t hs_type[] = {'H', 's'};
+static const uint8_t ac_type[] = {'a', 'c'};
+static const uint8_t text_type[] = {'T'};
+static const uint8_t le_oob_type[] = "application/vnd.bluetooth.le.oob";
+static const uint8_t carrier_id[] = {'0'};
+
+/* Alternative Carrier record payload: CPS, Carrier Data Reference, no Auxiliary Data References. */
+static const uint8_t ac_payload[] = {0x01, 0x01, '0', 0x00};
+
+static uint8_t le_oob_payload[32];
+static uint8_t text_payload[MULTI_REC_COUNT][48];
+static uint8_t long_payload[300];
+
+static uint8_t ch_msg[MSG_BUF_SIZE];
+static uint32_t ch_msg_len;
+static uint8_t multi_msg[MSG_BUF_SIZE];
+static uint32_t multi_msg_len;
+
+static uint8_t parser_buf[NFC_NDEF_PARSER_REQUIRED_MEM(PARSER_MAX_RECORDS)] __aligned(4);
+
+/* Handover Select payload: version byte followed by the local records message. */
+static int hs_payload_encode(struct nfc_ndef_msg_desc *local_records, uint8_t *buf, uint32_t *len)
+{
+	int err;
+
+	if (buf) {
+		if (*len < 1) {
+			return -ENOMEM;
+		}
+
+		*buf++ = 0x15;
+		*len -= 1;
+	}
+
+	err = nfc_ndef_msg_encode(local_records, buf, len);
+	if (err) {
+		return err;
+	}
+
+	*len += 1;
+
+	return 0;
+}
+
+static void ch_msg_encode(uint8_t *buf, uint32_t *len)
+{
+	NFC_NDEF_MSG_DEF(local, 1);
+	NFC_NDEF_MSG_DEF(msg, 2);
+	NFC_NDEF_RECORD_BIN_DATA_DEF(ac, TNF_WELL_KNOWN, NULL, 0, ac_type, sizeof(ac_type),
+				     ac_payload, sizeof(ac_payload));
+	NFC_NDEF_GENERIC_RECORD_DESC_DEF(hs, TNF_WELL_KNOWN, NULL, 0, hs_type, sizeof(hs_type),
+					 hs_payload_encode, &NFC_NDEF_MSG(local));
+	NFC_NDEF_RECORD_BIN_DATA_DEF(oob, TNF_MEDIA_TYPE, carrier_id, sizeof(carrier_id),
+				     le_oob_type, sizeof(le_oob_type) - 1, le_oob_payload,
+				     sizeof(le_oob_payload));
+
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(local), &NFC_NDEF_RECORD_BIN_DATA(ac)));
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(msg), &NFC_NDEF_GENERIC_RECORD_DESC(hs)));
+	zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(msg), &NFC_NDEF_RECORD_BIN_DATA(oob)));
+
+	zassert_ok(nfc_ndef_msg_encode(&NFC_NDEF_MSG(msg), buf, len));
+}
+
+static void multi_msg_encode(uint8_t *buf, uint32_t *len)
+{
+	struct nfc_ndef_bin_payload_desc payloads[MULTI_REC_COUNT + 1];
+	struct nfc_ndef_record_desc records[MULTI_REC_COUNT + 1];
+
+	NFC_NDEF_MSG_DEF(msg, MULTI_REC_COUNT + 1);
+
+	for (size_t i = 0; i <= MULTI_REC_COUNT; i++) {
+		bool last = (i == MULTI_REC_COUNT);
+
+		payloads[i].payload = last ? long_payload : text_payload[i];
+		payloads[i].payload_length = last ? sizeof(long_payload) : sizeof(text_payload[i]);
+
+		records[i] = (struct nfc_ndef_record_desc){
+			.tnf = TNF_WELL_KNOWN,
+			.type_length = sizeof(text_type),
+			.type = text_type,
+			.payload_constructor = (payload_constructor_t)nfc_ndef_bin_payload_memcopy,
+			.payload_descriptor = &payloads[i],
+		};
+
+		zassert_ok(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(msg), &records[i]));
+	}
+
+	zassert_ok(nfc_ndef_msg_encode(&NFC_NDEF_MSG(msg), buf, len));
+}
+
+static void *msg_view_setup(void)
+{
+	for (size_t i = 0; i < sizeof(le_oob_payload); i++) {
+		le_oob_payload[i] = i;
+	}
+
+	for (size_t i = 0; i < MULTI_REC_COUNT; i++) {
+		memset(text_payload[i], 'a' + i, sizeof(text_payload[i]));
+	}
+
+	memset(long_payload, 'z', sizeof(long_payload));
+
+	ch_msg_len = sizeof(ch_msg);
+	ch_msg_encode(ch_msg, &ch_msg_len);
+
+	multi_msg_len = sizeof(multi_msg);
+	multi_msg_encode(multi_msg, &multi_msg_len);
+
+	return NULL;
+}
+
+ZTEST(nfc_ndef_msg_view, test_short_record)
+{
+	/* Short record with ID: MB, ME, SR, IL, well-known type "U", ID "x", payload "ab". */
+	static const uint8_t data[] = {0xD9, 0x01, 0x02, 0x01, 'U', 'x', 'a', 'b', 0xFF};
+	struct nfc_ndef_rec_view rec;
+	uint32_t len = sizeof(data);
+
+	zassert_ok(nfc_ndef_rec_view_parse(&rec, data, &len));
+	zassert_equal(len, sizeof(data) - 1);
+	zassert_equal(rec.tnf, TNF_WELL_KNOWN);
+	zassert_equal(rec.location, NDEF_LONE_RECORD);
+	zassert_equal(rec.type_length, 1);
+	zassert_equal(rec.type, &data[4]);
+	zassert_equal(rec.id_length, 1);
+	zassert_equal(rec.id, &data[5]);
+	zassert_equal(rec.payload_length, 2);
+	zassert_equal(rec.payload, &data[6]);
+}
+
+ZTEST(nfc_ndef_msg_view, test_iterate_in_place)
+{
+	struct nfc_ndef_msg_view msg;
+	struct nfc_ndef_rec_view rec;
+	uint32_t i = 0;
+
+	nfc_ndef_msg_view_init(&msg, multi_msg, multi_msg_len);
+
+	NFC_NDEF_MSG_VIEW_FOR_EACH(&msg, &rec) {
+		zassert_true(nfc_ndef_rec_view_type_check(&rec, TNF_WELL_KNOWN, text_type,
+							  sizeof(text_type)));
+
+		if (i < MULTI_REC_COUNT) {
+			zassert_equal(rec.payload_length, sizeof(text_payload[i]));
+			zassert_mem_equal(rec.payload, text_payload[i], rec.payload_length);
+		} else {
+			zassert_equal(rec.payload_length, sizeof(long_payload));
+		}
+
+		/* The view points to the raw message. */
+		zassert_true(rec.payload > multi_msg && rec.payload < &multi_msg[multi_msg_len]);
+		i++;
+	}
+
+	zassert_equal(i, MULTI_REC_COUNT + 1);
+	zassert_equal(nfc_ndef_msg_view_record_count(&msg), MULTI_REC_COUNT + 1);
+	zassert_equal(nfc_ndef_msg_view_len(&msg), multi_msg_len);
+	zassert_equal(nfc_ndef_msg_view_next(&msg, &rec), -ENOENT);
+}
+
+ZTEST(nfc_ndef_msg_view, test_nested_records)
+{
+	struct nfc_ndef_msg_view msg;
+	struct nfc_ndef_msg_view local;
+	struct nfc_ndef_rec_view rec;
+	struct nfc_ndef_rec_view ac;
+
+	nfc_ndef_msg_view_init(&msg, ch_msg, ch_msg_len);
+
+	zassert_ok(nfc_ndef_msg_view_next(&msg, &rec));
+	zassert_true(nfc_ndef_rec_view_type_check(&rec, TNF_WELL_KNOWN, hs_type, sizeof(hs_type)));
+	zassert_equal(rec.payload[0], 0x15);
+
+	/* Local records follow the version byte. */
+	zassert_ok(nfc_ndef_msg_view_nested_init(&local, &rec, 1));
+	zassert_ok(nfc_ndef_msg_view_next(&local, &ac));
+	zassert_true(nfc_ndef_rec_view_type_check(&ac, TNF_WELL_KNOWN, ac_type, sizeof(ac_type)));
+	zassert_equal(ac.payload_length, sizeof(ac_payload));
+	zassert_mem_equal(ac.payload, ac_payload, sizeof(ac_payload));
+	zassert_equal(nfc_ndef_msg_view_next(&local, &ac), -ENOENT);
+	zassert_equal(nfc_ndef_msg_view_nested_init(&local, &rec, rec.payload_length + 1), -EINVAL);
+
+	zassert_ok(nfc_ndef_msg_view_next(&msg, &rec));
+	zassert_true(nfc_ndef_rec_view_type_check(&rec, TNF_MEDIA_TYPE, le_oob_type,
+						  sizeof(le_oob_type) - 1));
+	zassert_equal(rec.id_length, sizeof(carrier_id));
+	zassert_mem_equal(rec.id, carrier_id, sizeof(carrier_id));
+	zassert_mem_equal(rec.payload, le_oob_payload, sizeof(le_oob_payload));
+	zassert_equal(nfc_ndef_msg_view_next(&msg, &rec), -ENOENT);
+}
+
+ZTEST(nfc_ndef_msg_view, test_malformed)
+{
+	/* Long record declaring a payload that would overflow the length calculation. */
+	static const uint8_t overflow[] = {0xC1, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 'T', 0x00};
+	/* First record without the Message Begin flag. */
+	static const uint8_t no_begin[] = {0x51, 0x01, 0x00, 'T'};
+	/* Message not terminated by the Message End flag. */
+	static const uint8_t no_end[] = {0x91, 0x01, 0x00, 'T'};
+	struct nfc_ndef_msg_view msg;
+	struct nfc_ndef_rec_view rec;
+
+	nfc_ndef_msg_view_init(&msg, overflow, sizeof(overflow));
+	zassert_equal(nfc_ndef_msg_view_next(&msg, &rec), -EINVAL);
+
+	nfc_ndef_msg_view_init(&msg, no_begin, sizeof(no_begin));
+	zassert_equal(nfc_ndef_msg_view_next(&msg, &rec), -EFAULT);
+
+	nfc_ndef_msg_view_init(&msg, no_end, sizeof(no_end));
+	zassert_ok(nfc_ndef_msg_view_next(&msg, &rec));
+	zassert_equal(nfc_ndef_msg_view_next(&msg, &rec), -EFAULT);
+
+	/* Truncated message. */
+	nfc_ndef_msg_view_init(&msg, multi_msg, multi_msg_len - 1);
+
+	NFC_NDEF_MSG_VIEW_FOR_EACH(&msg, &rec) {
+	}
+
+	zassert_equal(nfc_ndef_msg_view_record_count(&msg), MULTI_REC_COUNT);
+	zassert_equal(nfc_ndef_msg_view_next(&msg, &rec), -EINVAL);
+}
+
+ZTEST(nfc_ndef_msg_view, test_view_matches_parser)
+{
+	const struct nfc_ndef_msg_desc *desc = (const struct nfc_ndef_msg_desc *)parser_buf;
+	uint32_t parser_buf_len = sizeof(parser_buf);
+	uint32_t len = multi_msg_len;
+	struct nfc_ndef_msg_view msg;
+	struct nfc_ndef_rec_view rec;
+	uint32_t i = 0;
+
+	zassert_ok(nfc_ndef_msg_parse(parser_buf, &parser_buf_len, multi_msg, &len));
+	zassert_equal(len, multi_msg_len);
+
+	nfc_ndef_msg_view_init(&msg, multi_msg, multi_msg_len);
+
+	NFC_NDEF_MSG_VIEW_FOR_EACH(&msg, &rec) {
+		const struct nfc_ndef_record_desc *rec_desc = desc->record[i];
+		const struct nfc_ndef_bin_payload_desc *payload = rec_desc->payload_descriptor;
+
+		zassert_equal(rec.tnf, rec_desc->tnf);
+		zassert_equal(rec.type, rec_desc->type);
+		zassert_equal(rec.payload, payload->payload);
+		zassert_equal(rec.payload_length, payload->payload_length);
+		i++;
+	}
+
+	zassert_equal(i, desc->record_count);
+}
+
+static uint32_t payload_sum(const uint8_t *payload, uint32_t len)
+{
+	uint32_t sum = 0;
+
+	for (uint32_t i = 0; i < len; i++) {
+		sum += payload[i];
+	}
+
+	return sum;
+}
+
+static uint32_t parser_walk(const uint8_t *data, uint32_t data_len)
+{
+	const struct nfc_ndef_msg_desc *desc = (const struct nfc_ndef_msg_desc *)parser_buf;
+	uint32_t parser_buf_len = sizeof(parser_buf);
+	uint32_t len = data_len;
+	uint32_t sum = 0;
+
+	zassert_ok(nfc_ndef_msg_parse(parser_buf, &parser_buf_len, data, &len));
+
+	for (uint32_t i = 0; i < desc->record_count; i++) {
+		const struct nfc_ndef_bin_payload_desc *payload =
+			desc->record[i]->payload_descriptor;
+
+		sum += payload_sum(payload->payload, payload->payload_length);
+	}
+
+	return sum;
+}
+
+static uint32_t view_walk(const uint8_t *data, uint32_t data_len)
+{
+	struct nfc_ndef_msg_view msg;
+	struct nfc_ndef_rec_view rec;
+	uint32_t sum = 0;
+
+	nfc_ndef_msg_view_init(&msg, data, data_len);
+
+	NFC_NDEF_MSG_VIEW_FOR_EACH(&msg, &rec) {
+		sum += payload_sum(rec.payload, rec.payload_length);
+	}
+
+	zassert_equal(nfc_ndef_msg_view_len(&msg), data_len);
+
+	return sum;
+}
+
+static void print_result(const char *name, uint64_t cycles)
+{
+	TC_PRINT("%s: %u iterations in %llu us\n", name, BENCH_ITERATIONS,
+		 k_cyc_to_us_ceil64(cycles));
+}
+
+/* Compare the parser that fills record descriptors with the in-place view when walking
+ * all record payloads, and measure the encoder on the same messages.
+ */
+ZTEST(nfc_ndef_msg_view, test_benchmark)
+{
+	static uint8_t buf[MSG_BUF_SIZE];
+	const struct {
+		const char *name;
+		const uint8_t *data;
+		uint32_t len;
+	} msgs[] = {
+		{"Connection Handover", ch_msg, ch_msg_len},
+		{"Multi-record", multi_msg, multi_msg_len},
+	};
+
+	for (size_t m = 0; m < ARRAY_SIZE(msgs); m++) {
+		uint64_t parser_cycles = 0;
+		uint64_t view_cycles = 0;
+		uint64_t encode_cycles = 0;
+		uint32_t parser_sum = 0;
+		uint32_t view_sum = 0;
+		uint32_t start;
+
+		TC_PRINT("%s message, %u bytes\n", msgs[m].name, msgs[m].len);
+
+		for (int i = 0; i < BENCH_ITERATIONS; i++) {
+			start = k_cycle_get_32();
+			parser_sum = parser_walk(msgs[m].data, msgs[m].len);
+			parser_cycles += k_cycle_get_32() - start;
+
+			start = k_cycle_get_32();
+			view_sum = view_walk(msgs[m].data, msgs[m].len);
+			view_cycles += k_cycle_get_32() - start;
+		}
+
+		zassert_equal(parser_sum, view_sum);
+
+		for (int i = 0; i < BENCH_ITERATIONS; i++) {
+			uint32_t len = sizeof(buf);
+
+			start = k_cycle_get_32();
+			if (msgs[m].data == ch_msg) {
+				ch_msg_encode(buf, &len);
+			} else {
+				multi_msg_encode(buf, &len);
+			}
+			encode_cycles += k_cycle_get_32() - start;
+
+			zassert_equal(len, msgs[m].len);
+		}
+
+		print_result("  Parser", parser_cycles);
+		print_result("  View", view_cycles);
+		print_result("  Encoder", encode_cycles);
+	}
+}
+
+ZTEST_SUITE(nfc_ndef_msg_view, NULL, msg_view_setup, NULL, NULL, NULL);
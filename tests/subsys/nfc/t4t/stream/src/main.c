@@ -0,0 +1,735 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include <nfc/t4t/apdu.h>
+#include <nfc/t4t/cc_file.h>
+#include <nfc/t4t/hl_procedure.h>
+#include <nfc/t4t/isodep.h>
+
+#define ISODEP_BUF_SIZE 512
+#define ISODEP_FSD 256
+#define ISODEP_CRC_SIZE 2
+#define ISODEP_PCB_I_BLOCK 0x02
+#define ISODEP_PCB_R_ACK 0xA2
+#define ISODEP_PCB_CHAINING BIT(4)
+#define ISODEP_PCB_R_NAK BIT(4)
+#define ISODEP_PCB_BLOCK_NUM BIT(0)
+#define ISODEP_PCB_TYPE_MASK 0xC0
+#define ISODEP_PCB_TYPE_I 0x00
+#define ISODEP_PCB_TYPE_R 0x80
+#define ISODEP_RATS_CMD 0xE0
+#define ISODEP_FSCI_256 0x08
+#define ISODEP_FSCI_RFU 0x0C
+#define ISODEP_ATS_TB_PRESENT BIT(5)
+
+#define CC_FILE_ID 0xE103
+#define NDEF_FILE_ID 0xE104
+#define NDEF_NLEN_SIZE 2
+#define NDEF_FILE_SIZE 8192
+#define NDEF_MSG_LEN 4096
+
+#define APDU_MAX_SIZE (NDEF_FILE_SIZE + 16)
+#define CAPDU_EXTENDED_HEADER_SIZE 7
+#define SW_SIZE 2
+#define SW_OK 0x9000
+#define SW_WRONG_LENGTH 0x6700
+#define SW_NOT_FOUND 0x6A82
+#define SW_INS_NOT_SUPPORTED 0x6D00
+
+#define SHORT_APDU_MAX_LEN 0xFF
+#define EXTENDED_APDU_MAX_LEN 0xFFFF
+
+/* Simple model of the air interface used to estimate the transfer time:
+ * 106 kbit/s with a parity bit for each byte, and a fixed overhead per frame
+ * covering CRC, SoF/EoF, frame delay time and poller turnaround.
+ */
+#define AIR_BYTE_TIME_NS 84956
+#define AIR_FRAME_OVERHEAD_US 400
+
+static const uint16_t fsd_value_map[] = {16, 24, 32, 40, 48, 64, 96, 128, 256};
+
+NFC_T4T_CC_DESC_DEF(t4t_cc, 4);
+
+/* Simulated Type 4 Tag. */
+static struct {
+	uint8_t cc[15];
+	uint8_t file[NDEF_FILE_SIZE];
+	uint8_t capdu[APDU_MAX_SIZE];
+	size_t capdu_len;
+	uint8_t rapdu[APDU_MAX_SIZE];
+	size_t rapdu_len;
+	size_t rapdu_sent;
+	uint8_t frame[ISODEP_FSD];
+	size_t frame_len;
+	const uint8_t *selected;
+	size_t selected_size;
+	uint16_t mle;
+	uint16_t mlc;
+	uint16_t fsd;
+	uint8_t fsci;
+	uint32_t apdus;
+	uint32_t extended_apdus;
+	bool nlen_not_cleared;
+} tag;
+
+/* Reader/Writer. */
+static uint8_t isodep_tx[ISODEP_BUF_SIZE];
+static uint8_t isodep_rx[ISODEP_BUF_SIZE];
+static uint8_t reader_frame[ISODEP_BUF_SIZE];
+static size_t reader_frame_len;
+static bool reader_frame_pending;
+static uint32_t air_frames;
+static uint32_t air_bytes;
+
+static struct nfc_t4t_isodep_tag isodep_tag;
+static bool isodep_selected;
+static int isodep_err;
+static int hl_err;
+static bool hl_done;
+static size_t hl_len;
+
+static uint8_t ndef_msg[NDEF_MSG_LEN];
+static uint8_t read_buf[NDEF_FILE_SIZE];
+static uint32_t sink_offset;
+static uint32_t sink_calls;
+static uint32_t sink_abort_at;
+
+static void tag_sw_append(uint16_t sw)
+{
+	sys_put_be16(sw, &tag.rapdu[tag.rapdu_len]);
+	tag.rapdu_len += SW_SIZE;
+}
+
+static uint16_t tag_select(uint16_t p1p2, const uint8_t *data, size_t lc)
+{
+	uint16_t file_id;
+
+	if (p1p2 == NFC_T4T_APDU_SELECT_BY_NAME) {
+		return SW_OK;
+	}
+
+	if (lc != sizeof(file_id)) {
+		return SW_WRONG_LENGTH;
+	}
+
+	file_id = sys_get_be16(data);
+
+	if (file_id == CC_FILE_ID) {
+		tag.selected = tag.cc;
+		tag.selected_size = sizeof(tag.cc);
+	} else if (file_id == NDEF_FILE_ID) {
+		tag.selected = tag.file;
+		tag.selected_size = sizeof(tag.file);
+	} else {
+		return SW_NOT_FOUND;
+	}
+
+	return SW_OK;
+}
+
+static uint16_t tag_read(uint16_t offset, uint32_t le)
+{
+	size_t len;
+
+	if ((le > tag.mle) || !tag.selected || (offset >= tag.selected_size)) {
+		return SW_WRONG_LENGTH;
+	}
+
+	len = MIN(le, tag.selected_size - offset);
+
+	memcpy(tag.rapdu, tag.selected + offset, len);
+	tag.rapdu_len = len;
+
+	return SW_OK;
+}
+
+static uint16_t tag_update(uint16_t offset, const uint8_t *data, size_t lc)
+{
+	if ((lc > tag.mlc) || (tag.selected != tag.file) || (offset + lc > sizeof(tag.file))) {
+		return SW_WRONG_LENGTH;
+	}
+
+	/* The NLEN field must be cleared while the NDEF message is updated. */
+	if ((offset >= NDEF_NLEN_SIZE) && (sys_get_be16(tag.file) != 0)) {
+		tag.nlen_not_cleared = true;
+	}
+
+	memcpy(tag.file + offset, data, lc);
+
+	return SW_OK;
+}
+
+static void tag_apdu_process(void)
+{
+	const uint8_t *body = &tag.capdu[4];
+	size_t body_len = tag.capdu_len - 4;
+	const uint8_t *data = NULL;
+	uint16_t p1p2 = sys_get_be16(&tag.capdu[2]);
+	uint32_t le = 0;
+	size_t lc = 0;
+	uint16_t sw;
+
+	tag.apdus++;
+	tag.rapdu_len = 0;
+	tag.rapdu_sent = 0;
+
+	/* Decode the Lc and Le fields in the short or extended format. */
+	if (body_len == 1) {
+		le = body[0] ? body[0] : 256;
+	} else if ((body_len == 3) && (body[0] == 0)) {
+		le = sys_get_be16(&body[1]);
+		le = le ? le : 65536;
+		tag.extended_apdus++;
+	} else if ((body_len > 3) && (body[0] == 0)) {
+		lc = sys_get_be16(&body[1]);
+		data = &body[3];
+
+		if (body_len - 3 - lc == 2) {
+			le = sys_get_be16(&body[3 + lc]);
+		}
+
+		tag.extended_apdus++;
+	} else if (body_len > 1) {
+		lc = body[0];
+		data = &body[1];
+
+		if (body_len - 1 - lc == 1) {
+			le = body[1 + lc] ? body[1 + lc] : 256;
+		}
+	}
+
+	/* The tag accepts extended APDUs only if it announces it in the CC file. */
+	if (((tag.mle <= SHORT_APDU_MAX_LEN) && (le > SHORT_APDU_MAX_LEN + 1)) ||
+	    ((tag.mlc <= SHORT_APDU_MAX_LEN) && (lc > SHORT_APDU_MAX_LEN))) {
+		tag_sw_append(SW_WRONG_LENGTH);
+		return;
+	}
+
+	switch (tag.capdu[1]) {
+	case NFC_T4T_APDU_COMM_INS_SELECT:
+		sw = tag_select(p1p2, data, lc);
+		break;
+
+	case NFC_T4T_APDU_COMM_INS_READ:
+		sw = tag_read(p1p2, le);
+		break;
+
+	case NFC_T4T_APDU_COMM_INS_UPDATE:
+		sw = tag_update(p1p2, data, lc);
+		break;
+
+	default:
+		sw = SW_INS_NOT_SUPPORTED;
+		break;
+	}
+
+	if (sw != SW_OK) {
+		tag.rapdu_len = 0;
+	}
+
+	tag_sw_append(sw);
+}
+
+static void tag_i_block_send(uint8_t block_num)
+{
+	size_t len = MIN(tag.rapdu_len - tag.rapdu_sent, tag.fsd - ISODEP_CRC_SIZE - 1);
+
+	tag.frame[0] = ISODEP_PCB_I_BLOCK | block_num;
+
+	if (tag.rapdu_sent + len < tag.rapdu_len) {
+		tag.frame[0] |= ISODEP_PCB_CHAINING;
+	}
+
+	memcpy(&tag.frame[1], &tag.rapdu[tag.rapdu_sent], len);
+	tag.rapdu_sent += len;
+	tag.frame_len = len + 1;
+}
+
+static void tag_frame_process(const uint8_t *frame, size_t len)
+{
+	uint8_t pcb = frame[0];
+	uint8_t block_num = pcb & ISODEP_PCB_BLOCK_NUM;
+
+	if (pcb == ISODEP_RATS_CMD) {
+		tag.fsd = fsd_value_map[MIN(frame[1] >> 4, ARRAY_SIZE(fsd_value_map) - 1)];
+
+		/* ATS with the shortest Frame Waiting Time. */
+		tag.frame[0] = 3;
+		tag.frame[1] = ISODEP_ATS_TB_PRESENT | tag.fsci;
+		tag.frame[2] = 0x00;
+		tag.frame_len = 3;
+
+		return;
+	}
+
+	if ((pcb & ISODEP_PCB_TYPE_MASK) == ISODEP_PCB_TYPE_I) {
+		zassert_true(tag.capdu_len + len - 1 <= sizeof(tag.capdu));
+
+		memcpy(&tag.capdu[tag.capdu_len], &frame[1], len - 1);
+		tag.capdu_len += len - 1;
+
+		if (pcb & ISODEP_PCB_CHAINING) {
+			tag.frame[0] = ISODEP_PCB_R_ACK | block_num;
+			tag.frame_len = 1;
+
+			return;
+		}
+
+		tag_apdu_process();
+		tag.capdu_len = 0;
+		tag_i_block_send(block_num);
+
+		return;
+	}
+
+	zassert_equal(pcb & ISODEP_PCB_TYPE_MASK, ISODEP_PCB_TYPE_R, "Unexpected frame");
+	zassert_equal(pcb & ISODEP_PCB_R_NAK, 0, "Unexpected R(NAK)");
+
+	tag_i_block_send(block_num);
+}
+
+static void tag_init(uint16_t mle, uint16_t mlc)
+{
+	const uint8_t cc[] = {
+		0x00, sizeof(tag.cc), 0x20,
+		mle >> 8, mle & 0xFF,
+		mlc >> 8, mlc & 0xFF,
+		0x04, 0x06,
+		NDEF_FILE_ID >> 8, NDEF_FILE_ID & 0xFF,
+		NDEF_FILE_SIZE >> 8, NDEF_FILE_SIZE & 0xFF,
+		0x00, 0x00
+	};
+
+	memset(&tag, 0, sizeof(tag));
+	memcpy(tag.cc, cc, sizeof(cc));
+
+	tag.mle = mle;
+	tag.mlc = mlc;
+	tag.fsci = ISODEP_FSCI_256;
+
+	sys_put_be16(NDEF_MSG_LEN, tag.file);
+	memcpy(&tag.file[NDEF_NLEN_SIZE], ndef_msg, sizeof(ndef_msg));
+}
+
+static void exchange(void)
+{
+	while (reader_frame_pending && !hl_err && !isodep_err) {
+		reader_frame_pending = false;
+
+		tag_frame_process(reader_frame, reader_frame_len);
+
+		air_frames++;
+		air_bytes += tag.frame_len;
+
+		zassert_ok(nfc_t4t_isodep_data_received(tag.frame, tag.frame_len, 0));
+	}
+}
+
+static void isodep_data_received(const uint8_t *data, size_t data_len)
+{
+	hl_err = nfc_t4t_hl_procedure_on_data_received(data, data_len);
+}
+
+static void isodep_selected_cb(const struct nfc_t4t_isodep_tag *t4t_tag)
+{
+	isodep_tag = *t4t_tag;
+	isodep_selected = true;
+}
+
+static void isodep_ready_to_send(uint8_t *data, size_t data_len, uint32_t ftd)
+{
+	zassert_true(data_len <= sizeof(reader_frame));
+
+	memcpy(reader_frame, data, data_len);
+	reader_frame_len = data_len;
+	reader_frame_pending = true;
+
+	air_frames++;
+	air_bytes += data_len;
+}
+
+static void isodep_error(int err)
+{
+	isodep_err = err;
+}
+
+static const struct nfc_t4t_isodep_cb isodep_cb = {
+	.data_received = isodep_data_received,
+	.chained_data_received = nfc_t4t_hl_procedure_on_chained_data_received,
+	.selected = isodep_selected_cb,
+	.ready_to_send = isodep_ready_to_send,
+	.error = isodep_error,
+};
+
+static void hl_cc_read(struct nfc_t4t_cc_file *cc)
+{
+}
+
+static void hl_ndef_read(uint16_t file_id, const uint8_t *data, size_t len)
+{
+	hl_done = true;
+	hl_len = len;
+}
+
+static void hl_ndef_updated(uint16_t file_id)
+{
+	hl_done = true;
+}
+
+static void hl_ndef_streamed(uint16_t file_id, size_t len)
+{
+	hl_done = true;
+	hl_len = len;
+}
+
+static const struct nfc_t4t_hl_procedure_cb hl_cb = {
+	.cc_read = hl_cc_read,
+	.ndef_read = hl_ndef_read,
+	.ndef_updated = hl_ndef_updated,
+	.ndef_streamed = hl_ndef_streamed,
+};
+
+static int ndef_sink(uint32_t offset, const uint8_t *data, size_t len, void *user_data)
+{
+	zassert_equal(offset, sink_offset, "Chunks are not consecutive");
+	zassert_true(offset + len <= sizeof(read_buf));
+
+	sink_calls++;
+
+	if (sink_calls == sink_abort_at) {
+		return -ECANCELED;
+	}
+
+	memcpy(&read_buf[offset], data, len);
+	sink_offset += len;
+
+	return 0;
+}
+
+static int ndef_source(uint32_t offset, uint8_t *data, size_t len, void *user_data)
+{
+	const uint8_t *msg = user_data;
+
+	zassert_true(offset + len <= NDEF_MSG_LEN);
+
+	memcpy(data, &msg[offset], len);
+
+	return 0;
+}
+
+static void procedure_run(int err)
+{
+	zassert_ok(err);
+	exchange();
+	zassert_ok(hl_err);
+	zassert_ok(isodep_err);
+}
+
+static void tag_activate(uint16_t mle, uint16_t mlc)
+{
+	tag_init(mle, mlc);
+
+	isodep_selected = false;
+	zassert_ok(nfc_t4t_isodep_rats_send(NFC_T4T_ISODEP_FSD_256, 0));
+	exchange();
+	zassert_true(isodep_selected);
+
+	/* Wait for the Frame Waiting Time after the ATS. */
+	k_msleep(2);
+
+	procedure_run(nfc_t4t_hl_procedure_ndef_tag_app_select());
+	procedure_run(nfc_t4t_hl_procedure_cc_select());
+	procedure_run(nfc_t4t_hl_procedure_cc_read(&NFC_T4T_CC_DESC(t4t_cc)));
+	procedure_run(nfc_t4t_hl_procedure_ndef_file_select(NDEF_FILE_ID));
+
+	zassert_equal(NFC_T4T_CC_DESC(t4t_cc).max_rapdu_size, mle);
+	zassert_equal(NFC_T4T_CC_DESC(t4t_cc).max_capdu_size, mlc);
+
+	tag.apdus = 0;
+	tag.extended_apdus = 0;
+	air_frames = 0;
+	air_bytes = 0;
+}
+
+static void stream_read_verify(uint16_t mle)
+{
+	tag_activate(mle, SHORT_APDU_MAX_LEN);
+
+	procedure_run(nfc_t4t_hl_procedure_ndef_read_stream(&NFC_T4T_CC_DESC(t4t_cc),
+							    ndef_sink, NULL));
+
+	zassert_true(hl_done);
+	zassert_equal(hl_len, NDEF_MSG_LEN);
+	zassert_equal(sink_offset, NDEF_MSG_LEN);
+	zassert_mem_equal(read_buf, ndef_msg, NDEF_MSG_LEN);
+
+	/* Chained data received after the stream has ended is not taken by the stream. */
+	zassert_false(nfc_t4t_hl_procedure_on_chained_data_received(ndef_msg, 1));
+}
+
+static void *suite_setup(void)
+{
+	for (size_t i = 0; i < sizeof(ndef_msg); i++) {
+		ndef_msg[i] = (uint8_t)(i * 7 + (i >> 8));
+	}
+
+	zassert_ok(nfc_t4t_isodep_init(isodep_tx, sizeof(isodep_tx),
+				       isodep_rx, sizeof(isodep_rx), &isodep_cb));
+	zassert_ok(nfc_t4t_hl_procedure_cb_register(&hl_cb));
+
+	return NULL;
+}
+
+static void tc_setup(void *f)
+{
+	hl_err = 0;
+	isodep_err = 0;
+	hl_done = false;
+	hl_len = 0;
+	sink_offset = 0;
+	sink_calls = 0;
+	sink_abort_at = 0;
+	reader_frame_pending = false;
+
+	memset(read_buf, 0, sizeof(read_buf));
+}
+
+/*
+ * Test that the ISO-DEP reserved FSCI values are interpreted as the largest
+ * valid frame size.
+ */
+ZTEST(nfc_t4t_stream, test_isodep_fsci_rfu)
+{
+	tag_init(SHORT_APDU_MAX_LEN, SHORT_APDU_MAX_LEN);
+	tag.fsci = ISODEP_FSCI_RFU;
+
+	isodep_selected = false;
+	zassert_ok(nfc_t4t_isodep_rats_send(NFC_T4T_ISODEP_FSD_256, 0));
+	exchange();
+
+	zassert_true(isodep_selected);
+	zassert_equal(isodep_tag.fsc, ISODEP_FSD - ISODEP_CRC_SIZE);
+}
+
+/*
+ * Test that the NDEF file is streamed with short APDUs if the tag does not
+ * support extended length APDUs.
+ */
+ZTEST(nfc_t4t_stream, test_read_stream_short)
+{
+	stream_read_verify(SHORT_APDU_MAX_LEN);
+
+	zassert_equal(tag.extended_apdus, 0);
+	zassert_equal(tag.apdus, 1 + DIV_ROUND_UP(NDEF_MSG_LEN, SHORT_APDU_MAX_LEN));
+}
+
+/*
+ * Test that the NDEF file is streamed with extended length APDUs, limited by
+ * the configured maximum response length, and that the chained blocks are not
+ * stored in the ISO-DEP Rx buffer.
+ */
+ZTEST(nfc_t4t_stream, test_read_stream_extended)
+{
+	BUILD_ASSERT(CONFIG_NFC_T4T_HL_PROCEDURE_STREAM_MAX_LE > ISODEP_BUF_SIZE);
+
+	stream_read_verify(EXTENDED_APDU_MAX_LEN);
+
+	zassert_equal(tag.apdus,
+		      1 + DIV_ROUND_UP(NDEF_MSG_LEN, CONFIG_NFC_T4T_HL_PROCEDURE_STREAM_MAX_LE));
+	zassert_equal(tag.extended_apdus, tag.apdus - 1);
+}
+
+/*
+ * Test that the error returned by the sink aborts the procedure.
+ */
+ZTEST(nfc_t4t_stream, test_read_stream_abort)
+{
+	tag_activate(EXTENDED_APDU_MAX_LEN, SHORT_APDU_MAX_LEN);
+
+	sink_abort_at = 2;
+
+	zassert_ok(nfc_t4t_hl_procedure_ndef_read_stream(&NFC_T4T_CC_DESC(t4t_cc),
+							 ndef_sink, NULL));
+	exchange();
+
+	zassert_equal(hl_err, -ECANCELED);
+	zassert_false(hl_done);
+	zassert_equal(tag.apdus, 2);
+	zassert_false(nfc_t4t_hl_procedure_on_chained_data_received(ndef_msg, 1));
+}
+
+/*
+ * Test that the NDEF file is updated with extended length APDUs, and that
+ * the NLEN field is cleared during the update.
+ */
+ZTEST(nfc_t4t_stream, test_update_stream)
+{
+	static uint8_t new_msg[NDEF_MSG_LEN];
+	const uint16_t nlen = NDEF_MSG_LEN - 100;
+
+	for (size_t i = 0; i < sizeof(new_msg); i++) {
+		new_msg[i] = ~ndef_msg[i];
+	}
+
+	tag_activate(SHORT_APDU_MAX_LEN, EXTENDED_APDU_MAX_LEN);
+
+	procedure_run(nfc_t4t_hl_procedure_ndef_update_stream(&NFC_T4T_CC_DESC(t4t_cc), nlen,
+							      ndef_source, new_msg));
+
+	zassert_true(hl_done);
+	zassert_false(tag.nlen_not_cleared);
+	zassert_equal(sys_get_be16(tag.file), nlen);
+	zassert_mem_equal(&tag.file[NDEF_NLEN_SIZE], new_msg, nlen);
+	zassert_true(tag.extended_apdus > 0);
+	zassert_equal(tag.apdus, 2 + DIV_ROUND_UP(nlen, CONFIG_NFC_T4T_HL_PROCEDURE_APDU_BUF_SIZE -
+							  CAPDU_EXTENDED_HEADER_SIZE));
+}
+
+/*
+ * Test that the update is rejected if the NDEF message does not fit in the file.
+ */
+ZTEST(nfc_t4t_stream, test_update_stream_too_long)
+{
+	tag_activate(SHORT_APDU_MAX_LEN, EXTENDED_APDU_MAX_LEN);
+
+	zassert_equal(nfc_t4t_hl_procedure_ndef_update_stream(&NFC_T4T_CC_DESC(t4t_cc),
+							      NDEF_FILE_SIZE - 1, ndef_source,
+							      ndef_msg),
+		      -ENOMEM);
+}
+
+static void bench_print(const char *name, uint32_t cycles)
+{
+	uint64_t cpu_us = k_cyc_to_us_floor64(cycles);
+	uint64_t air_us = (uint64_t)air_bytes * AIR_BYTE_TIME_NS / NSEC_PER_USEC +
+			  (uint64_t)air_frames * AIR_FRAME_OVERHEAD_US;
+	uint32_t kb = NDEF_MSG_LEN / 1024;
+
+	TC_PRINT("%s: %u APDUs, %u frames, %u bytes, CPU %llu us/KB, est. air %llu us/KB\n",
+		 name, tag.apdus, air_frames, air_bytes, cpu_us / kb, air_us / kb);
+}
+
+/*
+ * Benchmark the NDEF file transfer time per KB with buffered short APDUs and
+ * streamed extended length APDUs.
+ */
+ZTEST(nfc_t4t_stream, test_benchmark)
+{
+	static uint8_t ndef_file[NDEF_MSG_LEN + NDEF_NLEN_SIZE];
+	uint32_t start;
+	uint32_t cycles;
+
+	TC_PRINT("NDEF message, %u bytes\n", NDEF_MSG_LEN);
+
+	tag_activate(SHORT_APDU_MAX_LEN, SHORT_APDU_MAX_LEN);
+	start = k_cycle_get_32();
+	procedure_run(nfc_t4t_hl_procedure_ndef_read(&NFC_T4T_CC_DESC(t4t_cc), ndef_file,
+						     sizeof(ndef_file)));
+	cycles = k_cycle_get_32() - start;
+	zassert_true(hl_done);
+	zassert_mem_equal(&ndef_file[NDEF_NLEN_SIZE], ndef_msg, NDEF_MSG_LEN);
+	bench_print("Read, short APDU", cycles);
+
+	tag_activate(EXTENDED_APDU_MAX_LEN, EXTENDED_APDU_MAX_LEN);
+	hl_done = false;
+	start = k_cycle_get_32();
+	procedure_run(nfc_t4t_hl_procedure_ndef_read_stream(&NFC_T4T_CC_DESC(t4t_cc),
+							    ndef_sink, NULL));
+	cycles = k_cycle_get_32() - start;
+	zassert_true(hl_done);
+	zassert_mem_equal(read_buf, ndef_msg, NDEF_MSG_LEN);
+	bench_print("Read, extended APDU stream", cycles);
+
+	tag_activate(SHORT_APDU_MAX_LEN, SHORT_APDU_MAX_LEN);
+	hl_done = false;
+	start = k_cycle_get_32();
+	procedure_run(nfc_t4t_hl_procedure_ndef_update(&NFC_T4T_CC_DESC(t4t_cc), ndef_file,
+						       sizeof(ndef_file)));
+	cycles = k_cycle_get_32() - start;
+	zassert_true(hl_done);
+	bench_print("Update, short APDU", cycles);
+
+	tag_activate(EXTENDED_APDU_MAX_LEN, EXTENDED_APDU_MAX_LEN);
+	hl_done = false;
+	start = k_cycle_get_32();
+	procedure_run(nfc_t4t_hl_procedure_ndef_update_stream(&NFC_T4T_CC_DESC(t4t_cc),
+							      NDEF_MSG_LEN, ndef_source,
+							      ndef_msg));
+	cycles = k_cycle_get_32() - start;
+	zassert_true(hl_done);
+	zassert_mem_equal(&tag.file[NDEF_NLEN_SIZE], ndef_msg, NDEF_MSG_LEN);
+	bench_print("Update, extended APDU stream", cycles);
+}
+
+ZTEST_SUITE(nfc_t4t_stream, NULL, suite_setup, tc_setup, NULL, NULL);
+
+/*
+ * Test the encoding of extended length C-APDUs.
+ */
+ZTEST(nfc_t4t_apdu, test_comm_encode_extended)
+{
+	static uint8_t data[300];
+	uint8_t raw[sizeof(data) + 16];
+	struct nfc_t4t_apdu_comm comm;
+	uint16_t len;
+
+	/* Short Le of 256 bytes. */
+	nfc_t4t_apdu_comm_clear(&comm);
+	comm.instruction = NFC_T4T_APDU_COMM_INS_READ;
+	comm.resp_len = 256;
+	len = sizeof(raw);
+	zassert_ok(nfc_t4t_apdu_comm_encode(&comm, raw, &len));
+	zassert_equal(len, 5);
+	zassert_mem_equal(raw, ((uint8_t[]){0x00, 0xB0, 0x00, 0x00, 0x00}), len);
+
+	/* Extended Le without Lc. */
+	comm.parameter = 0x0102;
+	comm.resp_len = 0x0400;
+	len = sizeof(raw);
+	zassert_ok(nfc_t4t_apdu_comm_encode(&comm, raw, &len));
+	zassert_equal(len, 7);
+	zassert_mem_equal(raw, ((uint8_t[]){0x00, 0xB0, 0x01, 0x02, 0x00, 0x04, 0x00}), len);
+
+	/* Extended Le forces extended Lc. */
+	nfc_t4t_apdu_comm_clear(&comm);
+	comm.instruction = NFC_T4T_APDU_COMM_INS_SELECT;
+	comm.data.buff = data;
+	comm.data.len = 2;
+	comm.resp_len = 300;
+	len = sizeof(raw);
+	zassert_ok(nfc_t4t_apdu_comm_encode(&comm, raw, &len));
+	zassert_equal(len, 4 + 3 + 2 + 2);
+	zassert_mem_equal(&raw[4], ((uint8_t[]){0x00, 0x00, 0x02}), 3);
+	zassert_mem_equal(&raw[9], ((uint8_t[]){0x01, 0x2C}), 2);
+
+	/* Extended Lc encoded in place. */
+	nfc_t4t_apdu_comm_clear(&comm);
+	comm.instruction = NFC_T4T_APDU_COMM_INS_UPDATE;
+	memset(&raw[7], 0xA5, sizeof(data));
+	comm.data.buff = &raw[7];
+	comm.data.len = sizeof(data);
+	len = sizeof(raw);
+	zassert_ok(nfc_t4t_apdu_comm_encode(&comm, raw, &len));
+	zassert_equal(len, 7 + sizeof(data));
+	zassert_mem_equal(raw, ((uint8_t[]){0x00, 0xD6, 0x00, 0x00, 0x00, 0x01, 0x2C}), 7);
+	zassert_equal(raw[7], 0xA5);
+	zassert_equal(raw[len - 1], 0xA5);
+
+	/* Not enough memory for the extended Le field. */
+	nfc_t4t_apdu_comm_clear(&comm);
+	comm.resp_len = 0x0400;
+	len = 6;
+	zassert_equal(nfc_t4t_apdu_comm_encode(&comm, raw, &len), -ENOMEM);
+}
+
+ZTEST_SUITE(nfc_t4t_apdu, NULL, NULL, NULL, NULL, NULL);
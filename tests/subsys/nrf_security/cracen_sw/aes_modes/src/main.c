@@ -0,0 +1,684 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Known-answer tests for the software-assisted AES modes of the CRACEN driver. Every vector is
+ * processed in chunks of several sizes, so that partial blocks, block boundaries and AES-ECB batch
+ * boundaries are all crossed in the middle of an update.
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/util.h>
+#include <psa/crypto.h>
+#include <cracen_psa_primitives.h>
+#include <cracen_sw_common.h>
+#include <cracen_sw_aes_ctr.h>
+#include <cracen_sw_aes_ccm.h>
+#include <cracen_sw_aes_gcm.h>
+
+#include "cracen_stub.h"
+
+#define AES_BLOCK_SIZE 16
+
+/* Size of the generated plaintext and additional data of the long vectors */
+#define LONG_PT_SIZE 200
+#define LONG_AD_SIZE 37
+
+/* Chunk sizes used to split the input, SIZE_MAX means a single update */
+static const size_t chunk_sizes[] = {1, 5, 15, 16, 17, 31, 48, 129, SIZE_MAX};
+
+/* Chunk sizes used to split the additional data */
+static const size_t ad_chunk_sizes[] = {1, 5, 16, SIZE_MAX};
+
+struct aead_vector {
+	psa_algorithm_t alg;
+	const uint8_t *key;
+	size_t key_len;
+	const uint8_t *nonce;
+	size_t nonce_len;
+	const uint8_t *ad;
+	size_t ad_len;
+	const uint8_t *pt;
+	size_t pt_len;
+	const uint8_t *ct;
+	const uint8_t *tag;
+	size_t tag_len;
+};
+
+static uint8_t long_pt[LONG_PT_SIZE];
+static uint8_t long_ad[LONG_AD_SIZE];
+
+/* FIPS-197, appendix C */
+static const uint8_t fips197_key[] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+	0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+	0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+static const uint8_t fips197_pt[] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb,
+	0xcc, 0xdd, 0xee, 0xff
+};
+
+static const uint8_t fips197_ct[][AES_BLOCK_SIZE] = {
+	{0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80,
+	 0x70, 0xb4, 0xc5, 0x5a},
+	{0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0, 0x6e, 0xaf, 0x70, 0xa0,
+	 0xec, 0x0d, 0x71, 0x91},
+	{0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90,
+	 0x4b, 0x49, 0x60, 0x89},
+};
+
+/* NIST SP 800-38A, F.5.1 */
+static const uint8_t ctr_key[] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88,
+	0x09, 0xcf, 0x4f, 0x3c
+};
+
+static const uint8_t ctr_iv[] = {
+	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb,
+	0xfc, 0xfd, 0xfe, 0xff
+};
+
+static const uint8_t ctr_pt[] = {
+	0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11,
+	0x73, 0x93, 0x17, 0x2a, 0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+	0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51, 0x30, 0xc8, 0x1c, 0x46,
+	0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+	0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b,
+	0xe6, 0x6c, 0x37, 0x10
+};
+
+static const uint8_t ctr_ct[] = {
+	0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64,
+	0x99, 0x0d, 0xb6, 0xce, 0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+	0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff, 0x5a, 0xe4, 0xdf, 0x3e,
+	0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+	0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1, 0x79, 0x21, 0x70, 0xa0,
+	0xf3, 0x00, 0x9c, 0xee
+};
+
+/* Counter that wraps around to zero after the first block */
+static const uint8_t ctr_wrap_iv[] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff
+};
+
+/* The GCM specification, test cases 2 and 4 */
+static const uint8_t gcm_zero[AES_BLOCK_SIZE];
+
+static const uint8_t gcm_tc2_ct[] = {
+	0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2, 0xb9,
+	0x71, 0xb2, 0xfe, 0x78
+};
+
+static const uint8_t gcm_tc2_tag[] = {
+	0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd, 0xf5, 0x3a, 0x67, 0xb2,
+	0x12, 0x57, 0xbd, 0xdf
+};
+
+static const uint8_t gcm_key[] = {
+	0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94,
+	0x67, 0x30, 0x83, 0x08
+};
+
+static const uint8_t gcm_iv[] = {
+	0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+};
+
+static const uint8_t gcm_tc4_pt[] = {
+	0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5,
+	0xaf, 0xf5, 0x26, 0x9a, 0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+	0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72, 0x1c, 0x3c, 0x0c, 0x95,
+	0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+	0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39
+};
+
+static const uint8_t gcm_tc4_ad[] = {
+	0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce,
+	0xde, 0xad, 0xbe, 0xef, 0xab, 0xad, 0xda, 0xd2
+};
+
+static const uint8_t gcm_tc4_ct[] = {
+	0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7,
+	0x84, 0xd0, 0xd4, 0x9c, 0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+	0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e, 0x21, 0xd5, 0x14, 0xb2,
+	0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+	0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91
+};
+
+static const uint8_t gcm_tc4_tag[] = {
+	0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a,
+	0xe7, 0x12, 0x1a, 0x47
+};
+
+/* RFC 3610, packet vector #1 */
+static const uint8_t ccm_key[] = {
+	0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb,
+	0xcc, 0xcd, 0xce, 0xcf
+};
+
+static const uint8_t ccm_nonce[] = {
+	0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4,
+	0xa5
+};
+
+static const uint8_t ccm_ad[] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+};
+
+static const uint8_t ccm_pt[] = {
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13,
+	0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e
+};
+
+static const uint8_t ccm_ct[] = {
+	0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2, 0xf0, 0x66, 0xd0, 0xc2,
+	0xc0, 0xf9, 0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84
+};
+
+static const uint8_t ccm_tag[] = {
+	0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0
+};
+
+/* Long vectors, computed with an independent implementation over long_pt and long_ad */
+
+static const uint8_t ctr_long_ct[] = {
+	0xef, 0x86, 0xce, 0x6b, 0x87, 0x46, 0x51, 0x84, 0xc9, 0x90, 0x5f, 0x25,
+	0xbd, 0xc0, 0xc4, 0x88, 0x45, 0x51, 0xfd, 0xb4, 0xe8, 0xe5, 0xcc, 0xc7,
+	0xb3, 0x12, 0xce, 0x17, 0x3b, 0x9e, 0xa6, 0x72, 0x89, 0xc6, 0x32, 0x80,
+	0x87, 0x8f, 0x3a, 0x5b, 0xa5, 0x96, 0xe1, 0x2b, 0x20, 0x84, 0x29, 0x08,
+	0xbb, 0xc6, 0x58, 0xf7, 0x9f, 0x87, 0xe5, 0x42, 0x5f, 0x98, 0xa8, 0x7b,
+	0xb2, 0xc2, 0x1e, 0x42, 0x73, 0xc7, 0x96, 0x20, 0xcb, 0x6c, 0x7c, 0xfa,
+	0x0b, 0x6a, 0x39, 0x87, 0x87, 0x55, 0x80, 0x2e, 0x6b, 0xa3, 0x05, 0x12,
+	0x02, 0xb7, 0x5c, 0x91, 0x78, 0xb8, 0xa8, 0x18, 0xfa, 0x07, 0x7c, 0x87,
+	0x98, 0x73, 0x1d, 0xc1, 0xf6, 0x18, 0xe6, 0x2d, 0xbe, 0x8b, 0x45, 0xc8,
+	0xb4, 0x06, 0x77, 0x4e, 0x6e, 0x80, 0xef, 0xa8, 0x68, 0xf5, 0x6e, 0x4d,
+	0x5e, 0x08, 0xe1, 0xc8, 0x97, 0xeb, 0xe2, 0xcd, 0x34, 0x16, 0x28, 0xbe,
+	0xdf, 0x48, 0xe5, 0x23, 0x2e, 0x6d, 0xff, 0xc5, 0xfd, 0x6d, 0x13, 0xd7,
+	0x89, 0xb8, 0x6e, 0x7e, 0x82, 0xaf, 0xf8, 0xcc, 0x37, 0x87, 0xf1, 0x0e,
+	0x30, 0x03, 0x98, 0x71, 0xce, 0xca, 0x3c, 0x9f, 0x57, 0xab, 0x0e, 0x4a,
+	0xc3, 0xcc, 0x7d, 0x35, 0xbd, 0x2d, 0x4a, 0xd9, 0x9e, 0xf8, 0x50, 0x09,
+	0x3d, 0x47, 0xd5, 0x90, 0xf1, 0xb3, 0xe6, 0x86, 0xf3, 0xa2, 0x55, 0x0f,
+	0x46, 0x90, 0xcf, 0xa7, 0x96, 0x84, 0x13, 0x93
+};
+
+static const uint8_t ctr_wrap_ct[] = {
+	0x89, 0xf8, 0x97, 0x19, 0x5d, 0xd1, 0xab, 0xc0, 0x32, 0x72, 0x35, 0x4a,
+	0x68, 0x20, 0xcf, 0xc0, 0x0e, 0x8d, 0xea, 0x84, 0x95, 0x2e, 0x04, 0x17,
+	0x95, 0xf0, 0x49, 0x87, 0x7e, 0xd5, 0x81, 0xb3, 0xb4, 0xf8, 0x8c, 0xb8,
+	0xcb, 0xb7, 0xb3, 0xab, 0xb5, 0xd6, 0x4f, 0x89, 0xf0, 0x4c, 0x2a, 0x8a,
+	0xc4, 0x65, 0x4f, 0x9b, 0x27, 0x0f, 0x9f, 0x86
+};
+
+static const uint8_t gcm_long_ct[] = {
+	0x98, 0xb8, 0x3d, 0xff, 0xc6, 0xd5, 0x5f, 0xf5, 0xd5, 0x69, 0x61, 0x22,
+	0x7c, 0x7b, 0x97, 0x6a, 0x16, 0x77, 0x09, 0xf4, 0xb6, 0xa0, 0xce, 0x9e,
+	0xb0, 0x3f, 0xf7, 0xde, 0x64, 0x53, 0xfe, 0x80, 0xde, 0x03, 0xe9, 0xdf,
+	0x3e, 0x08, 0x97, 0x5b, 0x49, 0x62, 0x4d, 0x4e, 0xd2, 0x1c, 0x5a, 0x6c,
+	0xf9, 0x93, 0x87, 0xa4, 0xaf, 0x71, 0x37, 0x44, 0x0c, 0xa9, 0x02, 0x08,
+	0xfa, 0x3e, 0x3e, 0x6c, 0x1e, 0x62, 0xb6, 0x1c, 0x11, 0x14, 0x5c, 0x05,
+	0x43, 0xab, 0xf6, 0x59, 0xdd, 0x3e, 0xae, 0x4d, 0x25, 0xe2, 0xb5, 0xb9,
+	0x8c, 0x9f, 0x7a, 0x5b, 0x48, 0xa5, 0x21, 0x9c, 0x44, 0xfd, 0x71, 0xfd,
+	0x53, 0xb4, 0xed, 0x07, 0x1a, 0xe9, 0x8d, 0x26, 0x8b, 0xee, 0xee, 0x34,
+	0xe8, 0xc9, 0x74, 0x7d, 0xd2, 0xa7, 0xd5, 0x9d, 0x4f, 0x50, 0xbe, 0x34,
+	0xcf, 0xd8, 0xf3, 0x56, 0x61, 0x74, 0xe2, 0x24, 0x7d, 0x5c, 0x6c, 0x29,
+	0x77, 0x9d, 0x09, 0xab, 0x98, 0xbb, 0xff, 0x7b, 0x91, 0xbe, 0xc0, 0x2c,
+	0x33, 0x4c, 0xdd, 0x8e, 0x2d, 0x53, 0x95, 0x1e, 0xb9, 0xe1, 0xc1, 0x94,
+	0x7c, 0x77, 0xf3, 0x77, 0x11, 0x07, 0x37, 0x6e, 0xd2, 0x2f, 0x69, 0x25,
+	0x9a, 0xe5, 0x37, 0x31, 0x83, 0xbc, 0xe3, 0x73, 0x52, 0x66, 0x9a, 0x29,
+	0x4a, 0x3f, 0xca, 0x2d, 0x78, 0xfe, 0xa7, 0xa2, 0xbd, 0xd1, 0x62, 0x1c,
+	0xe7, 0xf9, 0x55, 0xa6, 0xc5, 0xf7, 0xc4, 0xda
+};
+
+static const uint8_t gcm_long_tag[] = {
+	0x41, 0xb0, 0x40, 0x3f, 0xcd, 0xdb, 0xcf, 0xa4, 0x55, 0x99, 0x1b, 0x9d,
+	0x76, 0xf4, 0x3e, 0x81
+};
+
+static const uint8_t ccm_long_ct[] = {
+	0x53, 0x8f, 0x8c, 0x89, 0x72, 0xed, 0x40, 0xe9, 0xdb, 0x35, 0x8b, 0x81,
+	0x83, 0xb2, 0xfa, 0xfb, 0x06, 0x3c, 0xf0, 0xf2, 0x49, 0x48, 0x07, 0x5b,
+	0xcf, 0xbe, 0x25, 0xc6, 0x19, 0xa3, 0xd8, 0x53, 0xfd, 0xc8, 0x64, 0xd2,
+	0x13, 0x39, 0x66, 0x9f, 0xa9, 0x8c, 0x3b, 0x6f, 0xc0, 0xdd, 0xdd, 0x20,
+	0x3f, 0xee, 0x8b, 0xe2, 0x3a, 0x67, 0xaf, 0xe5, 0x5e, 0x76, 0xb0, 0xab,
+	0x20, 0x2d, 0x3b, 0x65, 0x4c, 0x11, 0x03, 0x0e, 0xb5, 0xd6, 0x89, 0xab,
+	0xa0, 0x82, 0xf4, 0xf0, 0x6f, 0xb3, 0xfc, 0x95, 0xb3, 0x5e, 0xbf, 0xb3,
+	0xb3, 0x2d, 0x5f, 0x29, 0xf8, 0xdc, 0x0e, 0x62, 0xea, 0x96, 0x97, 0x6f,
+	0x3a, 0x4c, 0x16, 0xcb, 0xdd, 0xaa, 0xe5, 0xf3, 0xde, 0xaf, 0xd4, 0xfe,
+	0xbe, 0x0e, 0xbd, 0x81, 0x4d, 0xae, 0xa9, 0xfe, 0x02, 0x9b, 0xb7, 0x64,
+	0x92, 0x89, 0x79, 0xe1, 0xe2, 0x00, 0x45, 0x56, 0x41, 0xf9, 0x9c, 0xc2,
+	0x03, 0x06, 0x5a, 0xdb, 0x67, 0xae, 0xa5, 0x5f, 0xed, 0xfc, 0x6d, 0x66,
+	0x5d, 0x75, 0x34, 0xad, 0x6a, 0xec, 0xfc, 0x2c, 0xaa, 0xfa, 0xe5, 0xf6,
+	0x80, 0xec, 0xdf, 0x3c, 0x7f, 0x6b, 0xdf, 0xe3, 0xc9, 0x45, 0x8e, 0x8f,
+	0x2a, 0x9e, 0xca, 0x58, 0x54, 0x7c, 0x0e, 0x7b, 0x42, 0xb4, 0xa8, 0x39,
+	0xe9, 0xcc, 0x72, 0xc2, 0x0e, 0xbf, 0x33, 0x5a, 0x14, 0x14, 0xf5, 0xd3,
+	0x48, 0x49, 0x27, 0x42, 0x90, 0x56, 0xd7, 0x0e
+};
+
+static const uint8_t ccm_long_tag[] = {
+	0x67, 0x25, 0xc2, 0x1e, 0xa1, 0x93, 0x46, 0x20, 0x5c, 0x66, 0x7e, 0xb5,
+	0x00, 0xc2, 0x4a, 0xe9
+};
+
+static void attributes_init(psa_key_attributes_t *attributes, size_t key_len)
+{
+	*attributes = psa_key_attributes_init();
+	psa_set_key_type(attributes, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(attributes, PSA_BYTES_TO_BITS(key_len));
+}
+
+static size_t chunk_len(size_t chunk, size_t remaining)
+{
+	return MIN(chunk, remaining);
+}
+
+static void ctr_check(const uint8_t *key, size_t key_len, const uint8_t *iv, const uint8_t *input,
+		      size_t input_len, const uint8_t *expected)
+{
+	psa_key_attributes_t attributes;
+	uint8_t output[LONG_PT_SIZE];
+	size_t output_len;
+	size_t len;
+
+	attributes_init(&attributes, key_len);
+
+	for (size_t i = 0; i < ARRAY_SIZE(chunk_sizes); i++) {
+		cracen_cipher_operation_t operation = {0};
+		size_t done = 0;
+
+		memset(output, 0, sizeof(output));
+
+		zassert_equal(cracen_sw_aes_ctr_setup(&operation, &attributes, key, key_len),
+			      PSA_SUCCESS);
+		zassert_equal(cracen_sw_aes_ctr_set_iv(&operation, iv, AES_BLOCK_SIZE),
+			      PSA_SUCCESS);
+
+		while (done < input_len) {
+			len = chunk_len(chunk_sizes[i], input_len - done);
+			zassert_equal(cracen_sw_aes_ctr_update(&operation, &input[done], len,
+							       &output[done],
+							       sizeof(output) - done, &output_len),
+				      PSA_SUCCESS);
+			zassert_equal(output_len, len);
+			done += len;
+		}
+
+		zassert_equal(cracen_sw_aes_ctr_finish(&operation, &output_len), PSA_SUCCESS);
+		zassert_equal(output_len, 0);
+		zassert_mem_equal(output, expected, input_len, "chunk size %zu", chunk_sizes[i]);
+	}
+}
+
+static void gcm_encrypt_check(const struct aead_vector *v, size_t ad_chunk, size_t chunk)
+{
+	cracen_aead_operation_t operation = {0};
+	psa_key_attributes_t attributes;
+	uint8_t output[LONG_PT_SIZE];
+	uint8_t tag[AES_BLOCK_SIZE];
+	size_t output_len;
+	size_t tag_len;
+	size_t done;
+	size_t len;
+
+	attributes_init(&attributes, v->key_len);
+
+	zassert_equal(cracen_sw_aes_gcm_encrypt_setup(&operation, &attributes, v->key, v->key_len,
+						      v->alg),
+		      PSA_SUCCESS);
+	zassert_equal(cracen_sw_aes_gcm_set_nonce(&operation, v->nonce, v->nonce_len),
+		      PSA_SUCCESS);
+
+	for (done = 0; done < v->ad_len; done += len) {
+		len = chunk_len(ad_chunk, v->ad_len - done);
+		zassert_equal(cracen_sw_aes_gcm_update_ad(&operation, &v->ad[done], len),
+			      PSA_SUCCESS);
+	}
+
+	for (done = 0; done < v->pt_len; done += len) {
+		len = chunk_len(chunk, v->pt_len - done);
+		zassert_equal(cracen_sw_aes_gcm_update(&operation, &v->pt[done], len, &output[done],
+						       sizeof(output) - done, &output_len),
+			      PSA_SUCCESS);
+		zassert_equal(output_len, len);
+	}
+
+	zassert_equal(cracen_sw_aes_gcm_finish(&operation, NULL, 0, &output_len, tag,
+					       sizeof(tag), &tag_len),
+		      PSA_SUCCESS);
+	zassert_equal(tag_len, v->tag_len);
+	zassert_mem_equal(output, v->ct, v->pt_len, "AD chunk %zu, chunk %zu", ad_chunk, chunk);
+	zassert_mem_equal(tag, v->tag, v->tag_len, "AD chunk %zu, chunk %zu", ad_chunk, chunk);
+}
+
+static void gcm_decrypt_check(const struct aead_vector *v, size_t ad_chunk, size_t chunk,
+			      const uint8_t *tag, psa_status_t expected_status)
+{
+	cracen_aead_operation_t operation = {0};
+	psa_key_attributes_t attributes;
+	uint8_t output[LONG_PT_SIZE];
+	size_t output_len;
+	size_t done;
+	size_t len;
+
+	attributes_init(&attributes, v->key_len);
+
+	zassert_equal(cracen_sw_aes_gcm_decrypt_setup(&operation, &attributes, v->key, v->key_len,
+						      v->alg),
+		      PSA_SUCCESS);
+	zassert_equal(cracen_sw_aes_gcm_set_nonce(&operation, v->nonce, v->nonce_len),
+		      PSA_SUCCESS);
+	zassert_equal(cracen_sw_aes_gcm_set_lengths(&operation, v->ad_len, v->pt_len),
+		      PSA_SUCCESS);
+
+	for (done = 0; done < v->ad_len; done += len) {
+		len = chunk_len(ad_chunk, v->ad_len - done);
+		zassert_equal(cracen_sw_aes_gcm_update_ad(&operation, &v->ad[done], len),
+			      PSA_SUCCESS);
+	}
+
+	for (done = 0; done < v->pt_len; done += len) {
+		len = chunk_len(chunk, v->pt_len - done);
+		zassert_equal(cracen_sw_aes_gcm_update(&operation, &v->ct[done], len, &output[done],
+						       sizeof(output) - done, &output_len),
+			      PSA_SUCCESS);
+		zassert_equal(output_len, len);
+	}
+
+	zassert_equal(cracen_sw_aes_gcm_verify(&operation, NULL, 0, &output_len, tag,
+					       v->tag_len),
+		      expected_status);
+	zassert_mem_equal(output, v->pt, v->pt_len, "AD chunk %zu, chunk %zu", ad_chunk, chunk);
+}
+
+static void gcm_check(const struct aead_vector *v)
+{
+	uint8_t bad_tag[AES_BLOCK_SIZE];
+
+	memcpy(bad_tag, v->tag, v->tag_len);
+	bad_tag[v->tag_len - 1] ^= 0x01;
+
+	for (size_t i = 0; i < ARRAY_SIZE(ad_chunk_sizes); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(chunk_sizes); j++) {
+			gcm_encrypt_check(v, ad_chunk_sizes[i], chunk_sizes[j]);
+			gcm_decrypt_check(v, ad_chunk_sizes[i], chunk_sizes[j], v->tag,
+					  PSA_SUCCESS);
+		}
+	}
+
+	gcm_decrypt_check(v, SIZE_MAX, SIZE_MAX, bad_tag, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+static void ccm_multipart_check(const struct aead_vector *v, size_t ad_chunk, size_t chunk,
+				bool encrypt)
+{
+	cracen_aead_operation_t operation = {0};
+	psa_key_attributes_t attributes;
+	const uint8_t *input = encrypt ? v->pt : v->ct;
+	const uint8_t *expected = encrypt ? v->ct : v->pt;
+	uint8_t output[LONG_PT_SIZE];
+	uint8_t tag[AES_BLOCK_SIZE];
+	size_t output_len;
+	size_t tag_len;
+	size_t done;
+	size_t len;
+
+	attributes_init(&attributes, v->key_len);
+
+	if (encrypt) {
+		zassert_equal(cracen_sw_aes_ccm_encrypt_setup(&operation, &attributes, v->key,
+							      v->key_len, v->alg),
+			      PSA_SUCCESS);
+	} else {
+		zassert_equal(cracen_sw_aes_ccm_decrypt_setup(&operation, &attributes, v->key,
+							      v->key_len, v->alg),
+			      PSA_SUCCESS);
+	}
+	zassert_equal(cracen_sw_aes_ccm_set_lengths(&operation, v->ad_len, v->pt_len),
+		      PSA_SUCCESS);
+	zassert_equal(cracen_sw_aes_ccm_set_nonce(&operation, v->nonce, v->nonce_len),
+		      PSA_SUCCESS);
+
+	for (done = 0; done < v->ad_len; done += len) {
+		len = chunk_len(ad_chunk, v->ad_len - done);
+		zassert_equal(cracen_sw_aes_ccm_update_ad(&operation, &v->ad[done], len),
+			      PSA_SUCCESS);
+	}
+
+	for (done = 0; done < v->pt_len; done += len) {
+		len = chunk_len(chunk, v->pt_len - done);
+		zassert_equal(cracen_sw_aes_ccm_update(&operation, &input[done], len, &output[done],
+						       sizeof(output) - done, &output_len),
+			      PSA_SUCCESS);
+		zassert_equal(output_len, len);
+	}
+
+	if (encrypt) {
+		zassert_equal(cracen_sw_aes_ccm_finish(&operation, NULL, 0, &output_len, tag,
+						       sizeof(tag), &tag_len),
+			      PSA_SUCCESS);
+		zassert_equal(tag_len, v->tag_len);
+		zassert_mem_equal(tag, v->tag, v->tag_len, "AD chunk %zu, chunk %zu", ad_chunk,
+				  chunk);
+	} else {
+		zassert_equal(cracen_sw_aes_ccm_verify(&operation, NULL, 0, &output_len, v->tag,
+						       v->tag_len),
+			      PSA_SUCCESS);
+	}
+
+	zassert_mem_equal(output, expected, v->pt_len, "AD chunk %zu, chunk %zu", ad_chunk, chunk);
+}
+
+static void ccm_check(const struct aead_vector *v)
+{
+	psa_key_attributes_t attributes;
+	uint8_t output[LONG_PT_SIZE + AES_BLOCK_SIZE];
+	size_t output_len;
+
+	for (size_t i = 0; i < ARRAY_SIZE(ad_chunk_sizes); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(chunk_sizes); j++) {
+			ccm_multipart_check(v, ad_chunk_sizes[i], chunk_sizes[j], true);
+			ccm_multipart_check(v, ad_chunk_sizes[i], chunk_sizes[j], false);
+		}
+	}
+
+	attributes_init(&attributes, v->key_len);
+
+	zassert_equal(cracen_sw_aes_ccm_encrypt(&attributes, v->key, v->key_len, v->alg, v->nonce,
+						v->nonce_len, v->ad, v->ad_len, v->pt, v->pt_len,
+						output, sizeof(output), &output_len),
+		      PSA_SUCCESS);
+	zassert_equal(output_len, v->pt_len + v->tag_len);
+	zassert_mem_equal(output, v->ct, v->pt_len);
+	zassert_mem_equal(&output[v->pt_len], v->tag, v->tag_len);
+
+	output[v->pt_len] ^= 0x01;
+	zassert_equal(cracen_sw_aes_ccm_decrypt(&attributes, v->key, v->key_len, v->alg, v->nonce,
+						v->nonce_len, v->ad, v->ad_len, output, output_len,
+						output, sizeof(output), &output_len),
+		      PSA_ERROR_INVALID_SIGNATURE);
+}
+
+ZTEST(cracen_sw_aes_modes, test_aes_block)
+{
+	uint8_t output[AES_BLOCK_SIZE];
+
+	/* AES-128, AES-192 and AES-256 of the software AES-ECB engine */
+	for (size_t i = 0; i < ARRAY_SIZE(fips197_ct); i++) {
+		cracen_stub_aes_encrypt(fips197_key, 16 + i * 8, fips197_pt, output);
+		zassert_mem_equal(output, fips197_ct[i], sizeof(output), "key size %zu",
+				  16 + i * 8);
+	}
+}
+
+ZTEST(cracen_sw_aes_modes, test_ctr)
+{
+	ctr_check(ctr_key, sizeof(ctr_key), ctr_iv, ctr_pt, sizeof(ctr_pt), ctr_ct);
+	ctr_check(ctr_key, sizeof(ctr_key), ctr_iv, long_pt, sizeof(long_pt), ctr_long_ct);
+}
+
+ZTEST(cracen_sw_aes_modes, test_ctr_counter_wrap)
+{
+	ctr_check(ctr_key, sizeof(ctr_key), ctr_wrap_iv, long_pt, sizeof(ctr_wrap_ct),
+		  ctr_wrap_ct);
+}
+
+ZTEST(cracen_sw_aes_modes, test_ctr_jobs)
+{
+	psa_key_attributes_t attributes;
+	uint8_t output[LONG_PT_SIZE];
+	size_t output_len;
+
+	attributes_init(&attributes, sizeof(ctr_key));
+	cracen_stub_counters_reset();
+
+	zassert_equal(cracen_sw_aes_ctr_crypt(&attributes, ctr_key, sizeof(ctr_key), ctr_iv,
+					      sizeof(ctr_iv), long_pt, sizeof(long_pt), output,
+					      sizeof(output), &output_len),
+		      PSA_SUCCESS);
+	zassert_mem_equal(output, ctr_long_ct, sizeof(ctr_long_ct));
+
+	/* Full blocks are batched, the trailing partial block takes a job of its own */
+	zassert_equal(cracen_stub_job_count_get(),
+		      DIV_ROUND_UP(LONG_PT_SIZE / AES_BLOCK_SIZE, CRACEN_SW_CTR_BATCH_MAX_BLOCKS) +
+			      1);
+	zassert_equal(cracen_stub_block_count_get(), DIV_ROUND_UP(LONG_PT_SIZE, AES_BLOCK_SIZE));
+}
+
+ZTEST(cracen_sw_aes_modes, test_gcm)
+{
+	const struct aead_vector tc2 = {
+		.alg = PSA_ALG_GCM,
+		.key = gcm_zero,
+		.key_len = sizeof(gcm_zero),
+		.nonce = gcm_zero,
+		.nonce_len = 12,
+		.pt = gcm_zero,
+		.pt_len = sizeof(gcm_zero),
+		.ct = gcm_tc2_ct,
+		.tag = gcm_tc2_tag,
+		.tag_len = sizeof(gcm_tc2_tag),
+	};
+	const struct aead_vector tc4 = {
+		.alg = PSA_ALG_GCM,
+		.key = gcm_key,
+		.key_len = sizeof(gcm_key),
+		.nonce = gcm_iv,
+		.nonce_len = sizeof(gcm_iv),
+		.ad = gcm_tc4_ad,
+		.ad_len = sizeof(gcm_tc4_ad),
+		.pt = gcm_tc4_pt,
+		.pt_len = sizeof(gcm_tc4_pt),
+		.ct = gcm_tc4_ct,
+		.tag = gcm_tc4_tag,
+		.tag_len = sizeof(gcm_tc4_tag),
+	};
+
+	gcm_check(&tc2);
+	gcm_check(&tc4);
+}
+
+ZTEST(cracen_sw_aes_modes, test_gcm_long)
+{
+	/* The additional data does not end on a block boundary */
+	const struct aead_vector v = {
+		.alg = PSA_ALG_GCM,
+		.key = gcm_key,
+		.key_len = sizeof(gcm_key),
+		.nonce = gcm_iv,
+		.nonce_len = sizeof(gcm_iv),
+		.ad = long_ad,
+		.ad_len = sizeof(long_ad),
+		.pt = long_pt,
+		.pt_len = sizeof(long_pt),
+		.ct = gcm_long_ct,
+		.tag = gcm_long_tag,
+		.tag_len = sizeof(gcm_long_tag),
+	};
+
+	gcm_check(&v);
+}
+
+ZTEST(cracen_sw_aes_modes, test_gcm_jobs)
+{
+	const struct aead_vector v = {
+		.alg = PSA_ALG_GCM,
+		.key = gcm_key,
+		.key_len = sizeof(gcm_key),
+		.nonce = gcm_iv,
+		.nonce_len = sizeof(gcm_iv),
+		.ad = long_ad,
+		.ad_len = sizeof(long_ad),
+		.pt = long_pt,
+		.pt_len = sizeof(long_pt),
+		.ct = gcm_long_ct,
+		.tag = gcm_long_tag,
+		.tag_len = sizeof(gcm_long_tag),
+	};
+
+	cracen_stub_counters_reset();
+	gcm_encrypt_check(&v, SIZE_MAX, SIZE_MAX);
+
+	/* The hash subkey, the batched full blocks, the trailing partial block and the tag */
+	zassert_equal(cracen_stub_job_count_get(),
+		      DIV_ROUND_UP(LONG_PT_SIZE / AES_BLOCK_SIZE, CRACEN_SW_CTR_BATCH_MAX_BLOCKS) +
+			      3);
+}
+
+ZTEST(cracen_sw_aes_modes, test_ccm)
+{
+	const struct aead_vector v = {
+		.alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, sizeof(ccm_tag)),
+		.key = ccm_key,
+		.key_len = sizeof(ccm_key),
+		.nonce = ccm_nonce,
+		.nonce_len = sizeof(ccm_nonce),
+		.ad = ccm_ad,
+		.ad_len = sizeof(ccm_ad),
+		.pt = ccm_pt,
+		.pt_len = sizeof(ccm_pt),
+		.ct = ccm_ct,
+		.tag = ccm_tag,
+		.tag_len = sizeof(ccm_tag),
+	};
+
+	ccm_check(&v);
+}
+
+ZTEST(cracen_sw_aes_modes, test_ccm_long)
+{
+	const struct aead_vector v = {
+		.alg = PSA_ALG_CCM,
+		.key = ccm_key,
+		.key_len = sizeof(ccm_key),
+		.nonce = ccm_nonce,
+		.nonce_len = sizeof(ccm_nonce),
+		.ad = long_ad,
+		.ad_len = sizeof(long_ad),
+		.pt = long_pt,
+		.pt_len = sizeof(long_pt),
+		.ct = ccm_long_ct,
+		.tag = ccm_long_tag,
+		.tag_len = sizeof(ccm_long_tag),
+	};
+
+	ccm_check(&v);
+}
+
+static void *aes_modes_setup(void)
+{
+	for (size_t i = 0; i < sizeof(long_pt); i++) {
+		long_pt[i] = (uint8_t)(i * 7 + 3);
+	}
+
+	for (size_t i = 0; i < sizeof(long_ad); i++) {
+		long_ad[i] = (uint8_t)(0xa5 ^ i);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(cracen_sw_aes_modes, NULL, aes_modes_setup, NULL, NULL, NULL);
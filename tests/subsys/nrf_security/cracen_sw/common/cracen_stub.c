@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Implements the parts of the sxsymcrypt and CRACEN driver APIs used by the software-assisted
+ * AES modes. Each sx_blkcipher_run() call counts as one AES-ECB job of the engine.
+ */
+
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+#include <psa/crypto.h>
+#include <sxsymcrypt/aes.h>
+#include <sxsymcrypt/blkcipher.h>
+#include <sxsymcrypt/internal.h>
+#include <sxsymcrypt/keyref.h>
+#include <cracen/statuscodes.h>
+#include <cracen/common.h>
+
+#include "cracen_stub.h"
+
+LOG_MODULE_REGISTER(cracen, CONFIG_CRACEN_LOG_LEVEL);
+
+#define AES_BLOCK_SIZE	  16
+#define AES_MAX_ROUNDS	  14
+#define AES_ROUND_KEYS_SZ ((AES_MAX_ROUNDS + 1) * AES_BLOCK_SIZE)
+
+#define ROTL8(x, shift) ((uint8_t)((x) << (shift)) | ((x) >> (8 - (shift))))
+
+static uint8_t sbox[256];
+static uint32_t job_count;
+static uint32_t block_count;
+
+static uint8_t xtime(uint8_t x)
+{
+	return (x << 1) ^ ((x & 0x80) ? 0x1b : 0);
+}
+
+/* The S-box is computed rather than tabulated, the AES known-answer tests check the result. */
+static void sbox_init(void)
+{
+	uint8_t p = 1;
+	uint8_t q = 1;
+
+	/* p * q == 1 in GF(2^8) at each step */
+	do {
+		/* Multiply p by 3 */
+		p = p ^ xtime(p);
+
+		/* Divide q by 3 */
+		q ^= q << 1;
+		q ^= q << 2;
+		q ^= q << 4;
+		q ^= (q & 0x80) ? 0x09 : 0;
+
+		/* Affine transformation of the inverse */
+		sbox[p] = q ^ ROTL8(q, 1) ^ ROTL8(q, 2) ^ ROTL8(q, 3) ^ ROTL8(q, 4) ^ 0x63;
+	} while (p != 1);
+
+	/* Zero has no inverse */
+	sbox[0] = 0x63;
+}
+
+static size_t aes_key_expand(const uint8_t *key, size_t key_size, uint8_t *round_keys)
+{
+	size_t nk = key_size / 4;
+	size_t rounds = nk + 6;
+	uint8_t rcon = 1;
+	uint8_t word[4];
+
+	memcpy(round_keys, key, key_size);
+
+	for (size_t i = nk; i < 4 * (rounds + 1); i++) {
+		memcpy(word, &round_keys[(i - 1) * 4], sizeof(word));
+
+		if ((i % nk) == 0) {
+			uint8_t first = word[0];
+
+			word[0] = sbox[word[1]] ^ rcon;
+			word[1] = sbox[word[2]];
+			word[2] = sbox[word[3]];
+			word[3] = sbox[first];
+			rcon = xtime(rcon);
+		} else if ((nk > 6) && ((i % nk) == 4)) {
+			for (size_t j = 0; j < sizeof(word); j++) {
+				word[j] = sbox[word[j]];
+			}
+		}
+
+		for (size_t j = 0; j < sizeof(word); j++) {
+			round_keys[i * 4 + j] = round_keys[(i - nk) * 4 + j] ^ word[j];
+		}
+	}
+
+	return rounds;
+}
+
+static void aes_mix_columns(uint8_t *state)
+{
+	for (size_t c = 0; c < 4; c++) {
+		uint8_t *col = &state[c * 4];
+		uint8_t a0 = col[0];
+		uint8_t a1 = col[1];
+		uint8_t a2 = col[2];
+		uint8_t a3 = col[3];
+
+		col[0] = xtime(a0) ^ xtime(a1) ^ a1 ^ a2 ^ a3;
+		col[1] = a0 ^ xtime(a1) ^ xtime(a2) ^ a2 ^ a3;
+		col[2] = a0 ^ a1 ^ xtime(a2) ^ xtime(a3) ^ a3;
+		col[3] = xtime(a0) ^ a0 ^ a1 ^ a2 ^ xtime(a3);
+	}
+}
+
+void cracen_stub_aes_encrypt(const uint8_t *key, size_t key_size, const uint8_t *input,
+			     uint8_t *output)
+{
+	uint8_t round_keys[AES_ROUND_KEYS_SZ];
+	uint8_t state[AES_BLOCK_SIZE];
+	uint8_t shifted[AES_BLOCK_SIZE];
+	size_t rounds;
+
+	if (sbox[0] == 0) {
+		sbox_init();
+	}
+
+	rounds = aes_key_expand(key, key_size, round_keys);
+
+	for (size_t i = 0; i < AES_BLOCK_SIZE; i++) {
+		state[i] = input[i] ^ round_keys[i];
+	}
+
+	for (size_t round = 1; round <= rounds; round++) {
+		/* SubBytes and ShiftRows, the state is stored column by column */
+		for (size_t c = 0; c < 4; c++) {
+			for (size_t r = 0; r < 4; r++) {
+				shifted[c * 4 + r] = sbox[state[((c + r) % 4) * 4 + r]];
+			}
+		}
+		memcpy(state, shifted, sizeof(state));
+
+		if (round != rounds) {
+			aes_mix_columns(state);
+		}
+
+		for (size_t i = 0; i < AES_BLOCK_SIZE; i++) {
+			state[i] ^= round_keys[round * AES_BLOCK_SIZE + i];
+		}
+	}
+
+	memcpy(output, state, sizeof(state));
+}
+
+uint32_t cracen_stub_job_count_get(void)
+{
+	return job_count;
+}
+
+uint32_t cracen_stub_block_count_get(void)
+{
+	return block_count;
+}
+
+void cracen_stub_counters_reset(void)
+{
+	job_count = 0;
+	block_count = 0;
+}
+
+psa_status_t silex_statuscodes_to_psa(int sx_status)
+{
+	switch (sx_status) {
+	case SX_OK:
+		return PSA_SUCCESS;
+	case SX_ERR_INVALID_ARG:
+	case SX_ERR_INVALID_KEY_SZ:
+	case SX_ERR_TOO_BIG:
+	case SX_ERR_WRONG_SIZE_GRANULARITY:
+		return PSA_ERROR_INVALID_ARGUMENT;
+	case SX_ERR_INCOMPATIBLE_HW:
+		return PSA_ERROR_NOT_SUPPORTED;
+	default:
+		return PSA_ERROR_HARDWARE_FAILURE;
+	}
+}
+
+psa_status_t cracen_load_keyref(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
+				size_t key_buffer_size, struct sxkeyref *k)
+{
+	ARG_UNUSED(attributes);
+
+	memset(k, 0, sizeof(*k));
+	k->key = key_buffer;
+	k->sz = key_buffer_size;
+
+	return PSA_SUCCESS;
+}
+
+void cracen_xorbytes(uint8_t *a, const uint8_t *b, size_t sz)
+{
+	for (size_t i = 0; i < sz; i++) {
+		a[i] ^= b[i];
+	}
+}
+
+int sx_hw_reserve(struct sx_dmactl *dma, sx_hw_reserve_flags_t flags)
+{
+	ARG_UNUSED(dma);
+	ARG_UNUSED(flags);
+
+	return SX_OK;
+}
+
+void sx_hw_release(struct sx_dmactl *dma)
+{
+	ARG_UNUSED(dma);
+}
+
+int sx_blkcipher_create_aesecb_enc(struct sxblkcipher *c, const struct sxkeyref *key)
+{
+	if ((key->sz != 16) && (key->sz != 24) && (key->sz != 32)) {
+		return SX_ERR_INVALID_KEY_SZ;
+	}
+
+	c->cfg = NULL;
+	c->key = key;
+	c->textsz = 0;
+
+	return SX_OK;
+}
+
+int sx_blkcipher_create_aesecb_dec(struct sxblkcipher *c, const struct sxkeyref *key)
+{
+	ARG_UNUSED(c);
+	ARG_UNUSED(key);
+
+	/* Not used by the counter based modes */
+	return SX_ERR_INCOMPATIBLE_HW;
+}
+
+/* ECB has no state between blocks, so the data is processed right away. */
+int sx_blkcipher_crypt(struct sxblkcipher *c, const uint8_t *datain, size_t sz, uint8_t *dataout)
+{
+	if ((sz == 0) || ((sz % AES_BLOCK_SIZE) != 0)) {
+		return SX_ERR_WRONG_SIZE_GRANULARITY;
+	}
+
+	for (size_t i = 0; i < sz; i += AES_BLOCK_SIZE) {
+		cracen_stub_aes_encrypt(c->key->key, c->key->sz, &datain[i], &dataout[i]);
+	}
+
+	c->textsz += sz;
+
+	return SX_OK;
+}
+
+int sx_blkcipher_run(struct sxblkcipher *c)
+{
+	job_count++;
+	block_count += c->textsz / AES_BLOCK_SIZE;
+
+	return SX_OK;
+}
+
+int sx_blkcipher_wait(struct sxblkcipher *c)
+{
+	ARG_UNUSED(c);
+
+	return SX_OK;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Software stand-in for the CRACEN AES-ECB engine, used to run the software-assisted AES modes
+ * of the CRACEN driver on targets without CRACEN.
+ */
+
+#ifndef CRACEN_STUB_H__
+#define CRACEN_STUB_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Encrypt a single block with AES.
+ *
+ * @param[in] key Key of 16, 24 or 32 bytes.
+ * @param[in] key_size Key size in bytes.
+ * @param[in] input 16-byte input block.
+ * @param[out] output 16-byte output block.
+ */
+void cracen_stub_aes_encrypt(const uint8_t *key, size_t key_size, const uint8_t *input,
+			     uint8_t *output);
+
+/** @brief Get the number of AES-ECB jobs run since the last reset. */
+uint32_t cracen_stub_job_count_get(void);
+
+/** @brief Get the number of AES blocks encrypted since the last reset. */
+uint32_t cracen_stub_block_count_get(void);
+
+/** @brief Reset the job and block counters. */
+void cracen_stub_counters_reset(void);
+
+#endif /* CRACEN_STUB_H__ */
@@ -0,0 +1,47 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+# Builds the software-assisted AES modes of the CRACEN driver into the application, on top of
+# a software AES-ECB engine, so that they can run on targets without CRACEN.
+
+set(CRACEN_DRIVER_DIR ${ZEPHYR_NRF_MODULE_DIR}/subsys/nrf_security/src/drivers/cracen)
+
+# Number of counter blocks per AES-ECB job, CONFIG_CRACEN_SW_CTR_BATCH_BLOCKS is only available
+# with CRACEN.
+if(NOT DEFINED CRACEN_SW_CTR_BATCH_BLOCKS)
+  set(CRACEN_SW_CTR_BATCH_BLOCKS 8)
+endif()
+
+target_sources(app PRIVATE
+  ${CRACEN_DRIVER_DIR}/cracen_sw/src/cracen_sw_common.c
+  ${CRACEN_DRIVER_DIR}/cracen_sw/src/cracen_sw_aes_ctr.c
+  ${CRACEN_DRIVER_DIR}/cracen_sw/src/cracen_sw_aes_ccm.c
+  ${CRACEN_DRIVER_DIR}/cracen_sw/src/cracen_sw_aes_gcm.c
+  ${CRACEN_DRIVER_DIR}/cracen_sw/ext/gcm_ext.c
+  ${CMAKE_CURRENT_LIST_DIR}/cracen_stub.c
+)
+
+target_include_directories(app PRIVATE
+  ${CMAKE_CURRENT_LIST_DIR}
+  ${CRACEN_DRIVER_DIR}/common/include
+  ${CRACEN_DRIVER_DIR}/cracenpsa/include
+  ${CRACEN_DRIVER_DIR}/sxsymcrypt/include
+  ${CRACEN_DRIVER_DIR}/silexpk/include
+  ${CRACEN_DRIVER_DIR}/cracen_sw/include
+  ${CRACEN_DRIVER_DIR}/cracen_sw/ext
+  ${ZEPHYR_NRF_MODULE_DIR}/subsys/nrf_security/src/utils
+  $<TARGET_PROPERTY:psa_crypto_library_config,INTERFACE_INCLUDE_DIRECTORIES>
+)
+
+target_compile_definitions(app PRIVATE
+  PSA_NEED_CRACEN_MULTIPART_WORKAROUNDS
+  PSA_NEED_CRACEN_CTR_SIZE_WORKAROUNDS
+  PSA_NEED_CRACEN_CTR_AES
+  PSA_NEED_CRACEN_CCM_AES
+  PSA_NEED_CRACEN_GCM_AES
+  CONFIG_CRACEN_SW_CTR_BATCH_BLOCKS=${CRACEN_SW_CTR_BATCH_BLOCKS}
+  CONFIG_CRACEN_LOG_LEVEL=0
+)
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+#include <psa/crypto.h>
+#include <psa/protected_storage.h>
+#include <hw_unique_key.h>
+
+#include "aead_key.h"
+#include "aead_crypt.h"
+
+#define TEST_UID	    0x5200
+#define TEST_UID_OTHER	    0x5201
+/* Write once objects cannot be removed, so this one is kept between runs */
+#define TEST_UID_WRITE_ONCE 0x5202
+#define TEST_DATA_SIZE	    300
+#define MAX_OBJECT_SIZE	    CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE
+#define SEGMENT_SIZE	    CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_SEGMENT_SIZE
+#define AEAD_NONCE_SIZE	    12
+#define AEAD_TAG_SIZE	    16
+#define OBJECT_PATH_SIZE    33
+
+/* Set in the stored create flags of segmented objects, see trusted_backend_aead.c */
+#define OBJECT_FLAG_SEGMENTED BIT(31)
+
+/* Stored layout of objects, see trusted_backend_aead.c */
+struct legacy_header {
+	psa_storage_create_flags_t create_flags;
+	size_t data_size;
+};
+
+struct segmented_header {
+	struct legacy_header header;
+	uint32_t segment_size;
+};
+
+#define SEGMENTS_OFFSET	      (sizeof(struct segmented_header) + AEAD_NONCE_SIZE + AEAD_TAG_SIZE)
+#define SEGMENT_STORED_SIZE   (AEAD_NONCE_SIZE + SEGMENT_SIZE + AEAD_TAG_SIZE)
+#define SEGMENT_OFFSET(i)     (SEGMENTS_OFFSET + (i) * SEGMENT_STORED_SIZE)
+#define SEGMENT_TAG_OFFSET(i) (SEGMENT_OFFSET(i) + AEAD_NONCE_SIZE + SEGMENT_SIZE)
+
+BUILD_ASSERT(TEST_DATA_SIZE > 4 * SEGMENT_SIZE && TEST_DATA_SIZE % SEGMENT_SIZE != 0,
+	     "The test object must have several segments and a short last one");
+
+struct raw_object {
+	uint8_t data[SEGMENT_OFFSET(MAX_OBJECT_SIZE / SEGMENT_SIZE + 1)];
+	size_t len;
+};
+
+static uint8_t data[TEST_DATA_SIZE];
+static uint8_t expected[TEST_DATA_SIZE];
+static uint8_t out[TEST_DATA_SIZE];
+static struct raw_object raw;
+static struct raw_object raw_other;
+
+static uint32_t key_derivations;
+
+psa_status_t __real_trusted_storage_get_key(psa_storage_uid_t uid, uint8_t *key_buf,
+					    size_t key_length);
+
+psa_status_t __wrap_trusted_storage_get_key(psa_storage_uid_t uid, uint8_t *key_buf,
+					    size_t key_length)
+{
+	key_derivations++;
+
+	return __real_trusted_storage_get_key(uid, key_buf, key_length);
+}
+
+static void object_path_get(psa_storage_uid_t uid, char *path)
+{
+	snprintf(path, OBJECT_PATH_SIZE, "%s/%08x%08x", CONFIG_PSA_PROTECTED_STORAGE_PREFIX,
+		 (unsigned int)(uid >> 32), (unsigned int)(uid & 0xffffffff));
+}
+
+static int raw_object_load_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			      void *param)
+{
+	struct raw_object *object = param;
+	ssize_t ret;
+
+	ARG_UNUSED(key);
+
+	ret = read_cb(cb_arg, object->data, MIN(len, sizeof(object->data)));
+	zassert_true(ret >= 0, "Failed to read the stored object: %d", (int)ret);
+	object->len = ret;
+
+	return 0;
+}
+
+/* Read the object as stored, bypassing the trusted storage. */
+static void raw_object_get(psa_storage_uid_t uid, struct raw_object *object)
+{
+	char path[OBJECT_PATH_SIZE];
+
+	object_path_get(uid, path);
+	object->len = 0;
+
+	zassert_ok(settings_load_subtree_direct(path, raw_object_load_cb, object));
+	zassert_true(object->len > 0, "Object %s not found", path);
+}
+
+/* Overwrite the stored object, bypassing the trusted storage. */
+static void raw_object_set(psa_storage_uid_t uid, const struct raw_object *object)
+{
+	char path[OBJECT_PATH_SIZE];
+
+	object_path_get(uid, path);
+
+	zassert_ok(settings_save_one(path, object->data, object->len));
+}
+
+static void object_verify(psa_storage_uid_t uid, const uint8_t *ref, size_t size)
+{
+	size_t out_length;
+	psa_status_t status;
+
+	status = psa_ps_get(uid, 0, size, out, &out_length);
+	zassert_equal(status, PSA_SUCCESS, "psa_ps_get failed: %d", status);
+	zassert_equal(out_length, size, "Invalid length");
+	zassert_mem_equal(out, ref, size, "Invalid data");
+}
+
+static void set_extended_verify(size_t offset, size_t length)
+{
+	psa_status_t status;
+
+	for (size_t i = 0; i < length; i++) {
+		expected[offset + i] = 0xA0 ^ i;
+	}
+
+	status = psa_ps_set_extended(TEST_UID, offset, length, &expected[offset]);
+	zassert_equal(status, PSA_SUCCESS, "psa_ps_set_extended at %zu, %zu bytes failed: %d",
+		      offset, length, status);
+
+	object_verify(TEST_UID, expected, sizeof(expected));
+}
+
+static void *setup(void)
+{
+	zassert_ok(settings_subsys_init(), "Failed to initialize settings");
+	zassert_equal(psa_crypto_init(), PSA_SUCCESS, "Failed to initialize PSA Crypto");
+
+	if (!hw_unique_key_are_any_written()) {
+		zassert_equal(hw_unique_key_write_random(), HW_UNIQUE_KEY_SUCCESS,
+			      "Failed to write the HUK");
+	}
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	return NULL;
+}
+
+static void before_fn(void *f)
+{
+	ARG_UNUSED(f);
+
+	memcpy(expected, data, sizeof(expected));
+
+	zassert_equal(psa_ps_set(TEST_UID, sizeof(data), data, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS, "psa_ps_set failed");
+}
+
+static void after_fn(void *f)
+{
+	ARG_UNUSED(f);
+
+	psa_ps_remove(TEST_UID);
+	psa_ps_remove(TEST_UID_OTHER);
+}
+
+ZTEST(trusted_storage_aead_backend, test_get_support)
+{
+	/* psa_ps_create() is not supported, so set_extended is not advertised */
+	zassert_equal(psa_ps_get_support(), 0, "Unsupported features reported");
+	zassert_equal(psa_ps_create(TEST_UID, TEST_DATA_SIZE, PSA_STORAGE_FLAG_NONE),
+		      PSA_ERROR_NOT_SUPPORTED, "psa_ps_create() supported");
+}
+
+ZTEST(trusted_storage_aead_backend, test_set_extended_partial_segment)
+{
+	/* Inside the first segment */
+	set_extended_verify(10, 20);
+
+	/* Inside the short last segment, up to the end of the object */
+	set_extended_verify(TEST_DATA_SIZE - 5, 5);
+
+	/* Exactly one segment, which is not decrypted before it is written */
+	set_extended_verify(SEGMENT_SIZE, SEGMENT_SIZE);
+}
+
+ZTEST(trusted_storage_aead_backend, test_set_extended_cross_segment)
+{
+	/* Across three segments, starting and ending inside a segment */
+	set_extended_verify(SEGMENT_SIZE - 14, SEGMENT_SIZE + 28);
+
+	/* Across the boundary to the short last segment */
+	set_extended_verify((TEST_DATA_SIZE / SEGMENT_SIZE) * SEGMENT_SIZE - 3, 6);
+
+	/* The whole object */
+	set_extended_verify(0, TEST_DATA_SIZE);
+}
+
+ZTEST(trusted_storage_aead_backend, test_set_extended_invalid)
+{
+	psa_status_t status;
+
+	status = psa_ps_set_extended(TEST_UID, TEST_DATA_SIZE - 4, 8, data);
+	zassert_equal(status, PSA_ERROR_INVALID_ARGUMENT, "Write past the end: %d", status);
+
+	status = psa_ps_set_extended(TEST_UID, TEST_DATA_SIZE + 1, 0, data);
+	zassert_equal(status, PSA_ERROR_INVALID_ARGUMENT, "Offset past the end: %d", status);
+
+	status = psa_ps_set_extended(TEST_UID_OTHER, 0, 8, data);
+	zassert_equal(status, PSA_ERROR_DOES_NOT_EXIST, "Missing object: %d", status);
+
+	/* Failed writes leave the object unchanged */
+	object_verify(TEST_UID, data, sizeof(data));
+
+	status = psa_ps_set(TEST_UID_WRITE_ONCE, sizeof(data), data, PSA_STORAGE_FLAG_WRITE_ONCE);
+	zassert_true(status == PSA_SUCCESS || status == PSA_ERROR_NOT_PERMITTED,
+		     "psa_ps_set failed: %d", status);
+
+	status = psa_ps_set_extended(TEST_UID_WRITE_ONCE, 0, 8, data);
+	zassert_equal(status, PSA_ERROR_NOT_PERMITTED, "Write once object written: %d", status);
+}
+
+ZTEST(trusted_storage_aead_backend, test_tampered_segment)
+{
+	size_t out_length;
+	psa_status_t status;
+
+	raw_object_get(TEST_UID, &raw);
+	zassert_equal(raw.len, SEGMENT_OFFSET(TEST_DATA_SIZE / SEGMENT_SIZE) + AEAD_NONCE_SIZE +
+				       TEST_DATA_SIZE % SEGMENT_SIZE + AEAD_TAG_SIZE,
+		      "Unexpected stored size %zu", raw.len);
+
+	/* Modified data of the second segment */
+	raw.data[SEGMENT_OFFSET(1) + AEAD_NONCE_SIZE] ^= 0x01;
+	raw_object_set(TEST_UID, &raw);
+
+	/* Only the segments covering the read range are decrypted */
+	status = psa_ps_get(TEST_UID, 0, SEGMENT_SIZE, out, &out_length);
+	zassert_equal(status, PSA_SUCCESS, "Untouched segment not readable: %d", status);
+
+	status = psa_ps_get(TEST_UID, SEGMENT_SIZE, 1, out, &out_length);
+	zassert_equal(status, PSA_ERROR_INVALID_SIGNATURE, "Modified segment read: %d", status);
+
+	status = psa_ps_set_extended(TEST_UID, SEGMENT_SIZE + 1, 1, data);
+	zassert_equal(status, PSA_ERROR_INVALID_SIGNATURE, "Modified segment written: %d",
+		      status);
+
+	/* Modified tag of the second segment, caught by the object tag */
+	raw.data[SEGMENT_OFFSET(1) + AEAD_NONCE_SIZE] ^= 0x01;
+	raw.data[SEGMENT_TAG_OFFSET(1)] ^= 0x01;
+	raw_object_set(TEST_UID, &raw);
+
+	status = psa_ps_get(TEST_UID, 0, 1, out, &out_length);
+	zassert_equal(status, PSA_ERROR_INVALID_SIGNATURE, "Modified tag not detected: %d",
+		      status);
+
+	/* Truncated object */
+	raw.data[SEGMENT_TAG_OFFSET(1)] ^= 0x01;
+	raw.len -= 1;
+	raw_object_set(TEST_UID, &raw);
+
+	status = psa_ps_get(TEST_UID, 0, 1, out, &out_length);
+	zassert_equal(status, PSA_ERROR_DATA_CORRUPT, "Truncated object read: %d", status);
+}
+
+ZTEST(trusted_storage_aead_backend, test_swapped_segment)
+{
+	uint8_t segment[SEGMENT_STORED_SIZE];
+	size_t out_length;
+	psa_status_t status;
+
+	raw_object_get(TEST_UID, &raw);
+
+	/* Segments swapped within the object */
+	memcpy(segment, &raw.data[SEGMENT_OFFSET(0)], sizeof(segment));
+	memcpy(&raw.data[SEGMENT_OFFSET(0)], &raw.data[SEGMENT_OFFSET(1)], sizeof(segment));
+	memcpy(&raw.data[SEGMENT_OFFSET(1)], segment, sizeof(segment));
+	raw_object_set(TEST_UID, &raw);
+
+	status = psa_ps_get(TEST_UID, 0, 1, out, &out_length);
+	zassert_equal(status, PSA_ERROR_INVALID_SIGNATURE, "Swapped segments read: %d", status);
+
+	/* Segment taken from an older version of the same object */
+	zassert_equal(psa_ps_set(TEST_UID, sizeof(data), data, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS, "psa_ps_set failed");
+	raw_object_get(TEST_UID, &raw);
+	memcpy(segment, &raw.data[SEGMENT_OFFSET(1)], sizeof(segment));
+
+	zassert_equal(psa_ps_set_extended(TEST_UID, SEGMENT_SIZE, 1, "x"), PSA_SUCCESS,
+		      "psa_ps_set_extended failed");
+	raw_object_get(TEST_UID, &raw);
+	memcpy(&raw.data[SEGMENT_OFFSET(1)], segment, sizeof(segment));
+	raw_object_set(TEST_UID, &raw);
+
+	status = psa_ps_get(TEST_UID, SEGMENT_SIZE, 1, out, &out_length);
+	zassert_equal(status, PSA_ERROR_INVALID_SIGNATURE, "Old segment read: %d", status);
+
+	/* Segment taken from another object with the same size */
+	zassert_equal(psa_ps_set(TEST_UID, sizeof(data), data, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS, "psa_ps_set failed");
+	zassert_equal(psa_ps_set(TEST_UID_OTHER, sizeof(data), data, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS, "psa_ps_set failed");
+	raw_object_get(TEST_UID, &raw);
+	raw_object_get(TEST_UID_OTHER, &raw_other);
+	memcpy(&raw.data[SEGMENT_OFFSET(1)], &raw_other.data[SEGMENT_OFFSET(1)], sizeof(segment));
+	raw_object_set(TEST_UID, &raw);
+
+	status = psa_ps_get(TEST_UID, SEGMENT_SIZE, 1, out, &out_length);
+	zassert_equal(status, PSA_ERROR_INVALID_SIGNATURE, "Foreign segment read: %d", status);
+}
+
+ZTEST(trusted_storage_aead_backend, test_legacy_format_read)
+{
+	static const uint8_t nonce[AEAD_NONCE_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+	struct legacy_header header;
+	struct psa_storage_info_t info;
+	uint8_t key[AEAD_KEY_SIZE];
+	size_t out_length;
+	psa_status_t status;
+
+	zassert_equal(__real_trusted_storage_get_key(TEST_UID, key, sizeof(key)), PSA_SUCCESS,
+		      "Failed to get the key");
+
+	/* Object stored by the unsegmented backend: header, nonce, encrypted data and tag */
+	memset(&header, 0, sizeof(header));
+	header.create_flags = PSA_STORAGE_FLAG_NONE;
+	header.data_size = sizeof(data);
+
+	memcpy(raw.data, &header, sizeof(header));
+	memcpy(&raw.data[sizeof(header)], nonce, sizeof(nonce));
+
+	status = trusted_storage_aead_encrypt(key, sizeof(key), nonce, sizeof(nonce), &header,
+					      sizeof(header), data, sizeof(data),
+					      &raw.data[sizeof(header) + sizeof(nonce)],
+					      sizeof(raw.data) - sizeof(header) - sizeof(nonce),
+					      &out_length);
+	zassert_equal(status, PSA_SUCCESS, "Failed to encrypt: %d", status);
+	raw.len = sizeof(header) + sizeof(nonce) + out_length;
+	raw_object_set(TEST_UID, &raw);
+
+	zassert_equal(psa_ps_get_info(TEST_UID, &info), PSA_SUCCESS, "psa_ps_get_info failed");
+	zassert_equal(info.size, sizeof(data), "Invalid size");
+	zassert_equal(info.flags, PSA_STORAGE_FLAG_NONE, "Invalid flags");
+
+	object_verify(TEST_UID, data, sizeof(data));
+
+	status = psa_ps_get(TEST_UID, SEGMENT_SIZE + 3, 10, out, &out_length);
+	zassert_equal(status, PSA_SUCCESS, "Partial read failed: %d", status);
+	zassert_mem_equal(out, &data[SEGMENT_SIZE + 3], 10, "Invalid data");
+
+	/* Legacy objects must be rewritten as a whole before they can be partially written */
+	status = psa_ps_set_extended(TEST_UID, 0, 1, data);
+	zassert_equal(status, PSA_ERROR_NOT_SUPPORTED, "Legacy object written: %d", status);
+
+	zassert_equal(psa_ps_set(TEST_UID, sizeof(data), data, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS, "psa_ps_set failed");
+	raw_object_get(TEST_UID, &raw);
+	memcpy(&header, raw.data, sizeof(header));
+	zassert_true(header.create_flags & OBJECT_FLAG_SEGMENTED, "Object not segmented");
+
+	object_verify(TEST_UID, data, sizeof(data));
+}
+
+ZTEST(trusted_storage_aead_backend, test_key_cache)
+{
+	size_t out_length;
+
+#if CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE_TIMEOUT_MS > 0
+	/* Let the key derived when setting up the test expire */
+	k_msleep(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE_TIMEOUT_MS + 10);
+	key_derivations = 0;
+
+	/* Consecutive accesses to the same object derive the key once */
+	object_verify(TEST_UID, data, sizeof(data));
+	zassert_equal(psa_ps_get(TEST_UID, 0, 1, out, &out_length), PSA_SUCCESS);
+	zassert_equal(psa_ps_set_extended(TEST_UID, 0, 1, data), PSA_SUCCESS);
+	zassert_equal(key_derivations, 1, "Key derived %u times", key_derivations);
+
+	/* Accessing another object replaces the cached key */
+	zassert_equal(psa_ps_set(TEST_UID_OTHER, sizeof(data), data, PSA_STORAGE_FLAG_NONE),
+		      PSA_SUCCESS);
+	zassert_equal(key_derivations, 2, "Key derived %u times", key_derivations);
+
+	object_verify(TEST_UID, data, sizeof(data));
+	zassert_equal(key_derivations, 3, "Key derived %u times", key_derivations);
+
+	/* The cached key expires */
+	k_msleep(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE_TIMEOUT_MS + 10);
+
+	object_verify(TEST_UID, data, sizeof(data));
+	zassert_equal(key_derivations, 4, "Key derived %u times", key_derivations);
+#else
+	key_derivations = 0;
+
+	object_verify(TEST_UID, data, sizeof(data));
+	zassert_equal(psa_ps_get(TEST_UID, 0, 1, out, &out_length), PSA_SUCCESS);
+	zassert_equal(key_derivations, 2, "Key derived %u times", key_derivations);
+#endif
+}
+
+ZTEST_SUITE(trusted_storage_aead_backend, NULL, setup, before_fn, after_fn, NULL);
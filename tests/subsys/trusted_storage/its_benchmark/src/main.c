@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+#include <psa/crypto.h>
+#include <psa/internal_trusted_storage.h>
+#include <hw_unique_key.h>
+
+#define TEST_UID	 0x5100
+#define READ_ITERATIONS	 20
+#define MAX_OBJECT_SIZE	 CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE
+
+static const size_t object_sizes[] = {256, 1024, MAX_OBJECT_SIZE};
+static const size_t access_sizes[] = {16, 64, 0 /* Whole object */};
+
+static uint8_t data[MAX_OBJECT_SIZE];
+static uint8_t out[MAX_OBJECT_SIZE];
+
+static void *setup(void)
+{
+	zassert_ok(settings_subsys_init(), "Failed to initialize settings");
+	zassert_equal(psa_crypto_init(), PSA_SUCCESS, "Failed to initialize PSA Crypto");
+
+	if (!hw_unique_key_are_any_written()) {
+		zassert_equal(hw_unique_key_write_random(), HW_UNIQUE_KEY_SUCCESS,
+			      "Failed to write the HUK");
+	}
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	return NULL;
+}
+
+static void after_fn(void *f)
+{
+	ARG_UNUSED(f);
+
+	psa_its_remove(TEST_UID);
+}
+
+static uint32_t read_cycles(size_t offset, size_t length)
+{
+	size_t out_length;
+	uint32_t start;
+	uint32_t cycles;
+	psa_status_t status;
+
+	start = k_cycle_get_32();
+	status = psa_its_get(TEST_UID, offset, length, out, &out_length);
+	cycles = k_cycle_get_32() - start;
+
+	zassert_equal(status, PSA_SUCCESS, "psa_its_get failed: %d", status);
+	zassert_equal(out_length, length, "Invalid length");
+	zassert_mem_equal(out, &data[offset], length, "Invalid data at offset %zu", offset);
+
+	return cycles;
+}
+
+ZTEST(trusted_storage_its_benchmark, test_its_get)
+{
+	psa_status_t status;
+	uint64_t total;
+	uint32_t start;
+
+	for (size_t i = 0; i < ARRAY_SIZE(object_sizes); i++) {
+		size_t object_size = object_sizes[i];
+
+		start = k_cycle_get_32();
+		status = psa_its_set(TEST_UID, object_size, data, PSA_STORAGE_FLAG_NONE);
+		TC_PRINT("psa_its_set, %zu bytes: %u cycles\n", object_size,
+			 k_cycle_get_32() - start);
+		zassert_equal(status, PSA_SUCCESS, "psa_its_set failed: %d", status);
+
+		for (size_t j = 0; j < ARRAY_SIZE(access_sizes); j++) {
+			size_t length = access_sizes[j] ? access_sizes[j] : object_size;
+
+			total = 0;
+			for (size_t k = 0; k < READ_ITERATIONS; k++) {
+				/* Spread the accesses over the object. */
+				size_t offset = (k * 97) % (object_size - length + 1);
+
+				total += read_cycles(offset, length);
+			}
+
+			TC_PRINT("psa_its_get, %zu of %zu bytes: %llu cycles\n", length,
+				 object_size, total / READ_ITERATIONS);
+		}
+	}
+}
+
+ZTEST_SUITE(trusted_storage_its_benchmark, NULL, setup, NULL, after_fn, NULL);